@@ -22,16 +22,19 @@ $(TEST_OUTPUT)_SRC := \
 	$(QUANTUM_PATH)/keymap_introspection.c \
 	tests/test_common/matrix.c \
 	tests/test_common/pointing_device_driver.c \
+	tests/test_common/rgb_matrix_driver.c \
 	tests/test_common/test_driver.cpp \
 	tests/test_common/keyboard_report_util.cpp \
 	tests/test_common/mouse_report_util.cpp \
 	tests/test_common/test_fixture.cpp \
 	tests/test_common/test_keymap_key.cpp \
+	tests/test_common/test_benchmark.cpp \
+	tests/test_common/test_rolls.cpp \
 	tests/test_common/test_logger.cpp \
 	$(patsubst $(ROOTDIR)/%,%,$(wildcard $(TEST_PATH)/*.cpp))
 
 $(TEST_OUTPUT)_DEFS := $(OPT_DEFS) "-DKEYMAP_C=\"keymap.c\""
 
-$(TEST_OUTPUT)_CONFIG := $(TEST_PATH)/config.h
+$(TEST_OUTPUT)_CONFIG := $(TEST_PATH)/config.h $(POST_CONFIG_H)
 
 VPATH += $(TOP_DIR)/tests/test_common
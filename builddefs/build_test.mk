@@ -67,6 +67,7 @@ include $(QUANTUM_PATH)/debounce/tests/rules.mk
 include $(QUANTUM_PATH)/encoder/tests/rules.mk
 include $(QUANTUM_PATH)/os_detection/tests/rules.mk
 include $(QUANTUM_PATH)/sequencer/tests/rules.mk
+include $(QUANTUM_PATH)/split_common/tests/rules.mk
 include $(QUANTUM_PATH)/wear_leveling/tests/rules.mk
 include $(QUANTUM_PATH)/logging/print.mk
 include $(PLATFORM_PATH)/test/rules.mk
@@ -76,7 +77,9 @@ endif
 
 $(TEST_OUTPUT)_SRC += \
 	tests/test_common/main.cpp \
+	tests/test_common/benchmark_util.cpp \
 	$(QUANTUM_PATH)/logging/print.c
+$(TEST_OUTPUT)_INC += tests/test_common
 
 ifneq ($(strip $(INTROSPECTION_KEYMAP_C)),)
 $(TEST_OUTPUT)_DEFS += -DINTROSPECTION_KEYMAP_C=\"$(strip $(INTROSPECTION_KEYMAP_C))\"
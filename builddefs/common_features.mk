@@ -649,6 +649,17 @@ ifeq ($(strip $(DYNAMIC_KEYMAP_ENABLE)), yes)
     SEND_STRING_ENABLE := yes
 endif
 
+ifeq ($(strip $(SEND_STRING_ASYNC_ENABLE)), yes)
+    OPT_DEFS += -DSEND_STRING_ASYNC_ENABLE
+    SEND_STRING_ENABLE := yes
+    DEFERRED_EXEC_ENABLE := yes
+endif
+
+ifeq ($(strip $(DYNAMIC_MACRO_ENABLE)), yes)
+    # Saved macros are checked against a CRC when loaded
+    CRC_ENABLE := yes
+endif
+
 VALID_CUSTOM_MATRIX_TYPES:= yes lite no
 
 CUSTOM_MATRIX ?= no
@@ -866,6 +877,34 @@ ifeq ($(strip $(JOYSTICK_ENABLE)), yes)
     endif
 endif
 
+SLIDER_ENABLE ?= no
+VALID_SLIDER_DRIVER_TYPES := analog custom
+SLIDER_DRIVER ?= analog
+ifeq ($(strip $(SLIDER_ENABLE)), yes)
+    ifeq ($(filter $(SLIDER_DRIVER),$(VALID_SLIDER_DRIVER_TYPES)),)
+        $(call CATASTROPHIC_ERROR,Invalid SLIDER_DRIVER,SLIDER_DRIVER="$(SLIDER_DRIVER)" is not a valid slider driver)
+    endif
+    OPT_DEFS += -DSLIDER_ENABLE
+    OPT_DEFS += -DSLIDER_$(strip $(shell echo $(SLIDER_DRIVER) | tr '[:lower:]' '[:upper:]'))
+    SRC += $(QUANTUM_DIR)/slider.c
+
+    ifeq ($(strip $(SLIDER_DRIVER)), analog)
+        ANALOG_DRIVER_REQUIRED = yes
+    endif
+
+    # Sends the sliders as MIDI controllers
+    ifeq ($(strip $(SLIDER_MIDI_ENABLE)), yes)
+        ifneq ($(strip $(MIDI_ENABLE)), yes)
+            # The unit tests link the MIDI library without its USB transport
+            ifneq ($(PLATFORM_KEY), test)
+                $(call CATASTROPHIC_ERROR,Invalid SLIDER_MIDI_ENABLE,SLIDER_MIDI_ENABLE="yes" requires MIDI_ENABLE="yes")
+            endif
+        endif
+        OPT_DEFS += -DSLIDER_MIDI_ENABLE
+        SRC += $(QUANTUM_DIR)/slider_midi.c
+    endif
+endif
+
 USBPD_ENABLE ?= no
 VALID_USBPD_DRIVER_TYPES = custom vendor
 USBPD_DRIVER ?= vendor
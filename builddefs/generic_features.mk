@@ -53,6 +53,8 @@ GENERIC_FEATURES = \
     SPACE_CADET \
     SWAP_HANDS \
     TAP_DANCE \
+    TASK_DEADLINE \
+    TASK_PROFILE \
     TRI_LAYER \
     VIA \
     VIRTSER \
@@ -6,6 +6,21 @@
 #include "eeprom_driver.h"
 #include "wear_leveling.h"
 
+#ifdef WEAR_LEVELING_WRITE_BEHIND
+#    include "keyboard.h"
+#    include "timer.h"
+
+#    ifndef WEAR_LEVELING_WRITE_BEHIND_IDLE_MS
+#        define WEAR_LEVELING_WRITE_BEHIND_IDLE_MS 500
+#    endif
+#    ifndef WEAR_LEVELING_WRITE_BEHIND_TIMEOUT_MS
+#        define WEAR_LEVELING_WRITE_BEHIND_TIMEOUT_MS 5000
+#    endif
+
+static uint32_t staged_time;
+static uint32_t last_write_time;
+#endif // WEAR_LEVELING_WRITE_BEHIND
+
 void eeprom_driver_init(void) {
     wear_leveling_init();
 }
@@ -25,5 +40,29 @@ void eeprom_read_block(void *buf, const void *addr, size_t len) {
 }
 
 void eeprom_write_block(const void *buf, void *addr, size_t len) {
+#ifdef WEAR_LEVELING_WRITE_BEHIND
+    last_write_time = timer_read32();
+    if (wear_leveling_pending() == 0) {
+        staged_time = last_write_time;
+    }
+#endif // WEAR_LEVELING_WRITE_BEHIND
     wear_leveling_write((uint32_t)addr, buf, len);
 }
+
+void eeprom_driver_flush(void) {
+    wear_leveling_flush();
+}
+
+#ifdef WEAR_LEVELING_WRITE_BEHIND
+void eeprom_driver_task(void) {
+    if (wear_leveling_pending() == 0) {
+        return;
+    }
+
+    // Write out staged data once writes and input have settled, so that consolidation doesn't stall typing -- unless it's been waiting too long
+    bool idle = timer_elapsed32(last_write_time) >= WEAR_LEVELING_WRITE_BEHIND_IDLE_MS && last_input_activity_elapsed() >= WEAR_LEVELING_WRITE_BEHIND_IDLE_MS;
+    if (idle || timer_elapsed32(staged_time) >= WEAR_LEVELING_WRITE_BEHIND_TIMEOUT_MS) {
+        wear_leveling_housekeeping();
+    }
+}
+#endif // WEAR_LEVELING_WRITE_BEHIND
@@ -93,5 +93,8 @@ void ws2812_init(void);
 void ws2812_set_color(int index, uint8_t red, uint8_t green, uint8_t blue);
 void ws2812_set_color_all(uint8_t red, uint8_t green, uint8_t blue);
 void ws2812_flush(void);
+// Sends the LEDs before end, only implemented by the bitbang drivers. The chain is always written
+// from its first LED, and the LEDs after the last one written keep their colours.
+void ws2812_flush_range(int start, int end);
 
 void ws2812_rgb_to_rgbw(ws2812_led_t *led);
@@ -5,3 +5,6 @@
 #define LED3_PIN 27
 
 #define LAYER_SWITCH_PIN GP0
+
+#define SLIDER_PINS { GP29 }
+#define SLIDER_RESOLUTION 12
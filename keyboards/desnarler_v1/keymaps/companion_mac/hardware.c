@@ -1,17 +1,10 @@
 // Hardware callbacks: LEDs, toggle switch, slider.
 // Compiled as a regular source file — has full QMK platform headers.
 #include QMK_KEYBOARD_H
-#include "analog.h"
 #include "gpio.h"
 
-#define SLIDER_PIN 29
-
-static uint32_t last_vol_change = 0;
-static bool     switch_on       = false;
-static int32_t  slider_smooth   = -1;  // exponential moving average (-1 = uninitialized)
-static int16_t  slider_ref      = -1;  // reference point; only resets when we fire
-
-#define SLIDER_DEAD_ZONE 80  // increase if still too sensitive
+static bool    switch_on     = false;
+static uint8_t last_position = 0;
 
 void matrix_init_user(void) {
     gpio_set_pin_input_high(LAYER_SWITCH_PIN);
@@ -45,29 +38,21 @@ void matrix_scan_user(void) {
         switch_on = new_mode;
         layer_move(switch_on ? 1 : 0);
     }
+}
 
-    if (timer_elapsed(last_vol_change) < 60) return;
-    last_vol_change = timer_read32();
-
-    int16_t raw = analogReadPin(SLIDER_PIN);
+void keyboard_post_init_user(void) {
+    last_position = slider_get_position(0);
+}
 
-    // Exponential moving average (7/8 old + 1/8 new) to kill ADC noise.
-    if (slider_smooth == -1) {
-        slider_smooth = raw;
-        slider_ref    = raw;
-        return;
+// One volume step per slider position; the slider subsystem filters the ADC noise.
+bool slider_update_user(uint8_t index, uint8_t position) {
+    while (last_position < position) {
+        tap_code(KC_AUDIO_VOL_UP);
+        last_position++;
     }
-    slider_smooth = (slider_smooth * 7 + raw) / 8;
-
-    // Only fire when smoothed value has moved significantly from the last
-    // reference point. Reference only resets after a trigger — not every tick —
-    // so ADC noise cannot accumulate into a false event.
-    int16_t delta = (int16_t)slider_smooth - slider_ref;
-    if (delta < -SLIDER_DEAD_ZONE) {
+    while (last_position > position) {
         tap_code(KC_AUDIO_VOL_DOWN);
-        slider_ref = (int16_t)slider_smooth;
-    } else if (delta > SLIDER_DEAD_ZONE) {
-        tap_code(KC_AUDIO_VOL_UP);
-        slider_ref = (int16_t)slider_smooth;
+        last_position--;
     }
+    return true;
 }
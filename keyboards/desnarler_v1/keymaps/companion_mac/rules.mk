@@ -1 +1,2 @@
 SRC += hardware.c
+SLIDER_ENABLE = yes
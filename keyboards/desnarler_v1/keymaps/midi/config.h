@@ -2,3 +2,9 @@
 #define MIDI_BASIC
 #define ANALOG_INPUTS 1
 #define MIDI_DEVICE 0
+
+#define SLIDER_PINS { GP26 } // works on your hardware
+#define SLIDER_RESOLUTION 85
+// Your slider's actual range (from earlier testing), until it is calibrated
+#define SLIDER_CALIBRATION_DEFAULT_MIN 24
+#define SLIDER_CALIBRATION_DEFAULT_MAX 993
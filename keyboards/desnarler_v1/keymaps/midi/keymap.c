@@ -1,9 +1,7 @@
-#include "analog.h"
 #include QMK_KEYBOARD_H
 // ---------------------
 // Hardware definitions
 // ---------------------
-#define SLIDER_PIN 26  // works on your hardware
 #define SWITCH_PIN GP3 // mode switch pin
 // ---------------------
 // MIDI setup
@@ -22,23 +20,13 @@ void matrix_init_user(void) {
 // ---------------------
 void matrix_scan_user(void) {
     midi_mode = !readPin(SWITCH_PIN); // active-low toggle
+}
+bool slider_update_user(uint8_t index, uint8_t position) {
+    // One slider position per semitone: C1 (24) to C8 (108) = 84 semitones (7 octaves)
     if (midi_mode) {
-        uint16_t raw = analogReadPin(SLIDER_PIN);
-
-        // Your slider's actual range (from earlier testing)
-        const uint16_t min_val = 24;
-        const uint16_t max_val = 993;
-
-        // Clamp to range
-        if (raw < min_val) raw = min_val;
-        if (raw > max_val) raw = max_val;
-
-        // Remap to full 0-4095 range for calculations
-        uint16_t scaled = ((raw - min_val) * 4095UL) / (max_val - min_val);
-
-        // Map to wide note range: C1 (24) to C8 (108) = 84 semitones (7 octaves)
-        base_note = 24 + (scaled * 84 / 4095);
+        base_note = 24 + position;
     }
+    return true;
 }
 // ---------------------
 // Key actions
@@ -0,0 +1 @@
+SLIDER_ENABLE = yes
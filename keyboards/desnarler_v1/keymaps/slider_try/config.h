@@ -0,0 +1,7 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#define SLIDER_PINS { GP29 }
+#define SLIDER_RESOLUTION 101 // volume steps 0 to 100
@@ -1,18 +1,13 @@
 // Copyright 2023 QMK
 // SPDX-License-Identifier: GPL-2.0-or-later
 
-#include "analog.h"
 #include QMK_KEYBOARD_H
 
 // ----------------------
 // Slider setup
 // ----------------------
-#define SLIDER_PIN 29
-#define MAX_VOLUME_STEPS 100
-#define SLIDER_DEADBAND 2 // ignore <2 steps of change
+// SLIDER_PINS and SLIDER_RESOLUTION (one position per volume step) are set in config.h
 static bool     volume_init_done = false;
-static bool     slider_ready     = false;
-static uint32_t slider_timer     = 0;
 static uint32_t init_timer       = 0;
 static int16_t  last_val         = 0;
 
@@ -122,6 +117,20 @@ layer_state_t layer_state_set_user(layer_state_t state) {
     return state;
 }
 
+// ----------------------
+// Volume: tap up or down until it matches the slider
+// ----------------------
+static void set_volume(int16_t target) {
+    if (target > last_val) {
+        for (int i = last_val; i < target; i++)
+            tap_code(KC_AUDIO_VOL_UP);
+    } else {
+        for (int i = target; i < last_val; i++)
+            tap_code(KC_AUDIO_VOL_DOWN);
+    }
+    last_val = target;
+}
+
 // ----------------------
 // matrix_scan_user: repeated loop
 // ----------------------
@@ -148,35 +157,19 @@ void matrix_scan_user(void) {
                 tap_code_delay(KC_VOLD, 5);
             last_val         = 0;
             volume_init_done = true;
-            slider_timer     = timer_read32();
+            set_volume(slider_get_position(0));
         }
-        return;
-    }
-
-    // ------ slider ready delay ------
-    if (!slider_ready) {
-        if (timer_elapsed32(slider_timer) > 500)
-            slider_ready = true;
-        else
-            return;
     }
+}
 
-    // ------ slider processing ------
-    int16_t raw    = analogReadPin(SLIDER_PIN);
-    int     target = (int)(raw * MAX_VOLUME_STEPS / 4095.0f);
-    if (target < 0) target = 0;
-    if (target > MAX_VOLUME_STEPS) target = MAX_VOLUME_STEPS;
-
-    if (abs(target - last_val) <= SLIDER_DEADBAND) return; // noise filter
-
-    if (target > last_val) {
-        for (int i = last_val; i < target; i++)
-            tap_code(KC_AUDIO_VOL_UP);
-    } else {
-        for (int i = target; i < last_val; i++)
-            tap_code(KC_AUDIO_VOL_DOWN);
+// ----------------------
+// Slider: filtered by the slider subsystem, called when its position changes
+// ----------------------
+bool slider_update_user(uint8_t index, uint8_t position) {
+    if (volume_init_done) {
+        set_volume(position);
     }
-    last_val = target;
+    return true;
 }
 
 // ----------------------
@@ -1,14 +1,11 @@
 // Copyright 2023 QMK
 // SPDX-License-Identifier: GPL-2.0-or-later
 
-#include "analog.h"
 #include QMK_KEYBOARD_H
 
 // ----------------------
-// Slider setup
+// Slider setup, SLIDER_PINS is set in config.h
 // ----------------------
-#define SLIDER_PIN 29
-
 static uint32_t last_vol_change = 0;
 static bool slider_ready = false;
 const int16_t center = 512;
@@ -162,8 +159,8 @@ void matrix_scan_user(void) {
         return ;
     }
 
-    // ------ read slider --------
-    int16_t raw = analogReadPin(SLIDER_PIN);
+    // ------ read filtered slider --------
+    int16_t raw = slider_get_value(0);
     if (timer_elapsed32(last_vol_change) < 100){
         return ;
     }
@@ -1,19 +1,14 @@
 // Copyright 2023 QMK
 // SPDX-License-Identifier: GPL-2.0-or-later
 
-#include "analog.h"
 #include QMK_KEYBOARD_H
 
 // ----------------------
-// Slider setup
+// Slider setup, SLIDER_PINS and one position per zone are set in config.h
 // ----------------------
-#define SLIDER_PIN 29
-
 static int8_t   last_zone    = -1;
 static int8_t   pending_zone = -1;
-static bool     slider_ready = false;
-static uint32_t slider_timer  = 0;
-static uint32_t settle_timer  = 0;
+static uint32_t settle_timer = 0;
 #define SLIDER_SETTLE_MS 300
 
 // ----------------------
@@ -143,22 +138,13 @@ void matrix_scan_user(void) {
     }
 
     // ------ slider: send 1-9 based on position ------
-    if (!slider_ready) {
-        if (!slider_timer) slider_timer = timer_read32();
-        if (timer_elapsed32(slider_timer) >= 500) slider_ready = true;
-    }
-    if (slider_ready) {
-        int16_t raw  = analogReadPin(SLIDER_PIN);
-        int8_t  zone = (int8_t)(raw * 9 / 4096);
-        if (zone < 0) zone = 0;
-        if (zone > 8) zone = 8;
-        if (zone != pending_zone) {
-            pending_zone = zone;
-            settle_timer = timer_read32();
-        } else if (zone != last_zone && timer_elapsed32(settle_timer) >= SLIDER_SETTLE_MS) {
-            tap_code(KC_1 + zone);
-            last_zone = zone;
-        }
+    int8_t zone = slider_get_position(0);
+    if (zone != pending_zone) {
+        pending_zone = zone;
+        settle_timer = timer_read32();
+    } else if (zone != last_zone && timer_elapsed32(settle_timer) >= SLIDER_SETTLE_MS) {
+        tap_code(KC_1 + zone);
+        last_zone = zone;
     }
 }
 
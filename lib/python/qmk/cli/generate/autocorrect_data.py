@@ -165,15 +165,19 @@ def check_typo_against_dictionary(typo: str, line_number: int, correct_words) ->
                 cli.log.warning('{fg_yellow}Warning:%d:{fg_reset} Typo "{fg_cyan}%s{fg_reset}" would falsely trigger on correctly spelled word "{fg_cyan}%s{fg_reset}".', line_number, typo, word)
 
 
-def serialize_trie(autocorrections: List[Tuple[str, str]], trie: Dict[str, Any]) -> List[int]:
+def serialize_trie(autocorrections: List[Tuple[str, str]], trie: Dict[str, Any], large: bool = False) -> List[int]:
     """Serializes trie and correction data in a form readable by the C code.
   Args:
     autocorrections: List of (typo, correction) tuples.
     trie: Dict of dicts.
+    large: Whether to use the large dictionary format, where branch nodes list
+      their children sorted by keycode for binary search and links are 24-bit.
   Returns:
     List of ints in the range 0-255.
   """
     table = []
+    link_size = 3 if large else 2
+    max_offset = (1 << (8 * link_size)) - 1
 
     # Traverse trie in depth first order.
     def traverse(trie_node):
@@ -205,7 +209,8 @@ def serialize_trie(autocorrections: List[Tuple[str, str]], trie: Dict[str, Any])
             table.append(entry)
             entry['links'] = [traverse(trie_node)]
         else:  # Handle trie node with multiple children.
-            entry = {'chars': ''.join(sorted(trie_node.keys())), 'byte_offset': 0}
+            chars = sorted(trie_node.keys(), key=TYPO_CHARS.get) if large else sorted(trie_node.keys())
+            entry = {'chars': ''.join(chars), 'byte_offset': 0}
             table.append(entry)
             entry['links'] = [traverse(trie_node[c]) for c in entry['chars']]
         return entry
@@ -217,28 +222,38 @@ def serialize_trie(autocorrections: List[Tuple[str, str]], trie: Dict[str, Any])
             return e['data']
         elif len(e['links']) == 1:  # Handle a chain table entry.
             return [TYPO_CHARS[c] for c in e['chars']] + [0]  # + encode_link(e['links'][0]))
+        elif large:  # Handle a branch table entry: count, sorted keycodes, then links.
+            data = [64 | len(e['chars'])] + [TYPO_CHARS[c] for c in e['chars']]
+            for link in e['links']:
+                data += encode_link(link, link_size)
+            return data
         else:  # Handle a branch table entry.
             data = []
             for c, link in zip(e['chars'], e['links']):
-                data += [TYPO_CHARS[c] | (0 if data else 64)] + encode_link(link)
+                data += [TYPO_CHARS[c] | (0 if data else 64)] + encode_link(link, link_size)
             return data + [0]
 
     byte_offset = 0
     for e in table:  # To encode links, first compute byte offset of each entry.
         e['byte_offset'] = byte_offset
         byte_offset += len(serialize(e))
-        assert 0 <= byte_offset <= 0xffff
+        if byte_offset > max_offset:
+            if large:
+                cli.log.error('{fg_red}Error:{fg_reset} The autocorrection table is too large, it exceeds the 16MB limit of the large format.')
+            else:
+                cli.log.error('{fg_red}Error:{fg_reset} The autocorrection table is too large, a node link exceeds 64KB limit. Try reducing the autocorrection dict to fewer entries, or pass --large.')
+            maybe_exit(1)
 
     return [b for e in table for b in serialize(e)]  # Serialize final table.
 
 
-def encode_link(link: Dict[str, Any]) -> List[int]:
-    """Encodes a node link as two bytes."""
+def encode_link(link: Dict[str, Any], link_size: int = 2) -> List[int]:
+    """Encodes a node link as `link_size` little-endian bytes."""
     byte_offset = link['byte_offset']
-    if not (0 <= byte_offset <= 0xffff):
-        cli.log.error('{fg_red}Error:{fg_reset} The autocorrection table is too large, a node link exceeds 64KB limit. Try reducing the autocorrection dict to fewer entries.')
+    if not (0 <= byte_offset < 1 << (8 * link_size)):
+        cli.log.error('{fg_red}Error:{fg_reset} The autocorrection table is too large, a node link exceeds %dKB limit. Try reducing the autocorrection dict to fewer entries.', (1 << (8 * link_size)) // 1024)
         maybe_exit(1)
-    return [byte_offset & 255, byte_offset >> 8]
+    return [(byte_offset >> (8 * i)) & 255 for i in range(link_size)]
 
 
 def typo_len(e: Tuple[str, str]) -> int:
@@ -254,11 +269,12 @@ def to_hex(b: int) -> str:
 @cli.argument('-km', '--keymap', completer=keymap_completer, help='The keymap to build a firmware for. Ignored when a configurator export is supplied.')
 @cli.argument('-o', '--output', arg_only=True, type=normpath, help='File to write to')
 @cli.argument('-q', '--quiet', arg_only=True, action='store_true', help="Quiet mode, only output error messages")
+@cli.argument('-l', '--large', arg_only=True, action='store_true', help="Use the large dictionary format, with binary-searched nodes and 24-bit offsets")
 @cli.subcommand('Generate the autocorrection data file from a dictionary file.')
 def generate_autocorrect_data(cli):
     autocorrections = parse_file(cli.args.filename)
     trie = make_trie(autocorrections)
-    data = serialize_trie(autocorrections, trie)
+    data = serialize_trie(autocorrections, trie, cli.args.large)
 
     current_keyboard = cli.args.keyboard or cli.config.user.keyboard or cli.config.generate_autocorrect_data.keyboard
     current_keymap = cli.args.keymap or cli.config.user.keymap or cli.config.generate_autocorrect_data.keymap
@@ -282,6 +298,8 @@ def generate_autocorrect_data(cli):
     autocorrect_data_h_lines.append(f'#define AUTOCORRECT_MIN_LENGTH {len(min_typo)} // "{min_typo}"')
     autocorrect_data_h_lines.append(f'#define AUTOCORRECT_MAX_LENGTH {len(max_typo)} // "{max_typo}"')
     autocorrect_data_h_lines.append(f'#define DICTIONARY_SIZE {len(data)}')
+    if cli.args.large:
+        autocorrect_data_h_lines.append('#define AUTOCORRECT_LARGE_DICTIONARY')
     autocorrect_data_h_lines.append('')
     autocorrect_data_h_lines.append('static const uint8_t autocorrect_data[DICTIONARY_SIZE] PROGMEM = {')
     autocorrect_data_h_lines.append(textwrap.fill('    %s' % (', '.join(map(to_hex, data))), width=100, subsequent_indent='    '))
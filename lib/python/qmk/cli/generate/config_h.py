@@ -11,7 +11,7 @@ from qmk.json_schema import json_load
 from qmk.keyboard import keyboard_completer, keyboard_folder
 from qmk.commands import dump_lines, parse_configurator_json
 from qmk.path import normpath, FileType
-from qmk.constants import GPL2_HEADER_C_LIKE, GENERATED_HEADER_C_LIKE
+from qmk.constants import GPL2_HEADER_C_LIKE, GENERATED_HEADER_C_LIKE, TYPING_HEATMAP_NEIGHBOURS_SPREAD
 
 
 def generate_define(define, value=None):
@@ -204,6 +204,10 @@ def generate_config_h(cli):
     if 'rgb_matrix' in kb_info_json:
         generate_led_animations_config('rgb_matrix', kb_info_json['rgb_matrix'], config_h_lines, 'ENABLE_RGB_MATRIX_', 'RGB_MATRIX_')
 
+        # keyboard.c lists the keys near every key, see _gen_typing_heatmap_neighbours()
+        if 'layout' in kb_info_json['rgb_matrix']:
+            config_h_lines.append(generate_define('RGB_MATRIX_TYPING_HEATMAP_NEIGHBOURS_SPREAD', TYPING_HEATMAP_NEIGHBOURS_SPREAD))
+
     if 'rgblight' in kb_info_json:
         generate_led_animations_config('rgblight', kb_info_json['rgblight'], config_h_lines, 'RGBLIGHT_EFFECT_', 'RGBLIGHT_MODE_')
 
@@ -2,6 +2,7 @@
 """
 import bisect
 import dataclasses
+import math
 from typing import Optional
 
 from milc import cli
@@ -10,7 +11,7 @@ from qmk.info import info_json
 from qmk.commands import dump_lines
 from qmk.keyboard import keyboard_completer, keyboard_folder
 from qmk.path import normpath
-from qmk.constants import GPL2_HEADER_C_LIKE, GENERATED_HEADER_C_LIKE, JOYSTICK_AXES
+from qmk.constants import GPL2_HEADER_C_LIKE, GENERATED_HEADER_C_LIKE, JOYSTICK_AXES, TYPING_HEATMAP_NEIGHBOURS_SPREAD
 
 
 def _gen_led_configs(info_data):
@@ -60,12 +61,53 @@ def _gen_led_config(info_data, config_type):
     lines.append(f'  {{ {", ".join(pos)} }},')
     lines.append(f'  {{ {", ".join(flags)} }},')
     lines.append('};')
+    if config_type == 'rgb_matrix':
+        lines.extend(_gen_typing_heatmap_neighbours(info_data))
     lines.append('#endif')
     lines.append('')
 
     return lines
 
 
+def _gen_typing_heatmap_neighbours(info_data):
+    """List the keys near every key of the rgb_matrix layout, so the typing heatmap does not have to measure every key on every keypress
+    """
+    cols = info_data['matrix_size']['cols']
+    rows = info_data['matrix_size']['rows']
+
+    points = [None] * (rows * cols)
+    for led_data in info_data['rgb_matrix']['layout']:
+        if 'matrix' in led_data:
+            row, col = led_data['matrix']
+            points[row * cols + col] = (led_data.get('x', 0), led_data.get('y', 0))
+
+    start = [0]
+    neighbours = []
+    for point in points:
+        if point is not None:
+            for key, other in enumerate(points):
+                if other is None:
+                    continue
+                # Same as sqrt16() of the squared distance
+                distance = math.isqrt((point[0] - other[0])**2 + (point[1] - other[1])**2)
+                if distance < TYPING_HEATMAP_NEIGHBOURS_SPREAD:
+                    neighbours.append(f'{{{key // cols}, {key % cols}, RGB_MATRIX_TYPING_HEATMAP_AMOUNT({distance})}}')
+        start.append(len(neighbours))
+
+    lines = []
+    lines.append('#ifdef RGB_MATRIX_TYPING_HEATMAP_NEIGHBOURS')
+    lines.append(f'__attribute__ ((weak)) const uint16_t g_typing_heatmap_neighbours_start[] PROGMEM = {{ {", ".join(map(str, start))} }};')
+    lines.append('__attribute__ ((weak)) const typing_heatmap_neighbour_t g_typing_heatmap_neighbours[] PROGMEM = {')
+    for key in range(rows * cols):
+        if start[key] != start[key + 1]:
+            lines.append(f'  // {key // cols}, {key % cols}')
+            lines.append(f'  {", ".join(neighbours[start[key]:start[key + 1]])},')
+    lines.append('};')
+    lines.append('#endif')
+
+    return lines
+
+
 def _gen_matrix_mask(info_data):
     """Convert info.json content to matrix_mask
     """
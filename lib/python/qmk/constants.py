@@ -325,3 +325,6 @@ LICENSE_TEXTS = [
 ]
 
 JOYSTICK_AXES = ['x', 'y', 'z', 'rx', 'ry', 'rz']
+
+# Keys closer than this are listed as neighbours for the typing heatmap, the default RGB_MATRIX_TYPING_HEATMAP_SPREAD
+TYPING_HEATMAP_NEIGHBOURS_SPREAD = 40
@@ -0,0 +1,55 @@
+from pathlib import Path
+
+from qmk.cli.generate.keyboard_c import _gen_typing_heatmap_neighbours
+
+# The layout of tests/rgb_matrix/rgb_matrix_layout.c: 16 by 8 LEDs, with the 4 by 10 matrix on the LEDs of rows 1 to 4, columns 3 to 12
+LED_X = [0, 14, 29, 44, 59, 74, 89, 104, 119, 134, 149, 164, 179, 194, 209, 224]
+LED_Y = [0, 9, 18, 27, 36, 45, 54, 64]
+
+
+def _rgb_matrix_test_info():
+    layout = []
+    for led_row, y in enumerate(LED_Y):
+        for led_col, x in enumerate(LED_X):
+            led = {'x': x, 'y': y, 'flags': 2}
+            if 1 <= led_row <= 4 and 3 <= led_col <= 12:
+                led['matrix'] = [led_row - 1, led_col - 3]
+            layout.append(led)
+
+    return {'matrix_size': {'rows': 4, 'cols': 10}, 'rgb_matrix': {'layout': layout}}
+
+
+def test_typing_heatmap_neighbours_spread():
+    info_data = {
+        'matrix_size': {'rows': 1, 'cols': 4},
+        'rgb_matrix': {
+            'layout': [
+                {'matrix': [0, 0], 'x': 0, 'y': 0},
+                {'matrix': [0, 1], 'x': 30, 'y': 0},
+                {'x': 45, 'y': 0},
+                {'matrix': [0, 3], 'x': 69, 'y': 0},
+            ],
+        },
+    }
+    assert _gen_typing_heatmap_neighbours(info_data) == [
+        '#ifdef RGB_MATRIX_TYPING_HEATMAP_NEIGHBOURS',
+        '__attribute__ ((weak)) const uint16_t g_typing_heatmap_neighbours_start[] PROGMEM = { 0, 2, 5, 5, 7 };',
+        '__attribute__ ((weak)) const typing_heatmap_neighbour_t g_typing_heatmap_neighbours[] PROGMEM = {',
+        '  // 0, 0',
+        '  {0, 0, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(0)}, {0, 1, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)},',
+        '  // 0, 1',
+        '  {0, 0, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {0, 1, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(0)}, {0, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(39)},',
+        '  // 0, 3',
+        '  {0, 1, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(39)}, {0, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(0)},',
+        '};',
+        '#endif',
+    ]
+
+
+def test_typing_heatmap_neighbours_match_unit_tests():
+    lines = _gen_typing_heatmap_neighbours(_rgb_matrix_test_info())
+
+    neighbours = Path(__file__).parents[4] / 'tests' / 'rgb_matrix' / 'rgb_matrix_neighbours.c'
+    checked_in = neighbours.read_text().splitlines()
+    start = checked_in.index(lines[0])
+    assert checked_in[start:start + len(lines)] == lines
@@ -10,6 +10,20 @@
 static inline bool initiate_transaction(uint8_t transaction_id);
 static inline bool react_to_transaction(void);
 
+/**
+ * @brief Receives a transaction buffer. Framed buffers announce their length
+ * in the first byte, and only that many bytes follow.
+ */
+static inline bool receive_transaction_buffer(split_transaction_desc_t* transaction, uint8_t* buffer, uint8_t size) {
+    if (!transaction->framed) {
+        return serial_transport_receive(buffer, size);
+    }
+    if (unlikely(!serial_transport_receive(buffer, 1) || buffer[0] >= size)) {
+        return false;
+    }
+    return buffer[0] == 0 || serial_transport_receive(buffer + 1, buffer[0]);
+}
+
 /**
  * @brief This thread runs on the slave and responds to transactions initiated
  * by the master.
@@ -73,7 +87,7 @@ static inline bool react_to_transaction(void) {
 
     /* Receive transaction buffer from the master. If this transaction requires it.*/
     if (transaction->initiator2target_buffer_size) {
-        if (unlikely(!serial_transport_receive(split_trans_initiator2target_buffer(transaction), transaction->initiator2target_buffer_size))) {
+        if (unlikely(!receive_transaction_buffer(transaction, split_trans_initiator2target_buffer(transaction), transaction->initiator2target_buffer_size))) {
             return false;
         }
     }
@@ -85,7 +99,7 @@ static inline bool react_to_transaction(void) {
 
     /* Send transaction buffer to the master. If this transaction requires it. */
     if (transaction->target2initiator_buffer_size) {
-        if (unlikely(!serial_transport_send(split_trans_target2initiator_buffer(transaction), transaction->target2initiator_buffer_size))) {
+        if (unlikely(!serial_transport_send(split_trans_target2initiator_buffer(transaction), split_trans_target2initiator_size(transaction)))) {
             return false;
         }
     }
@@ -140,7 +154,7 @@ static inline bool initiate_transaction(uint8_t transaction_id) {
 
     /* Send transaction buffer to the slave. If this transaction requires it. */
     if (transaction->initiator2target_buffer_size) {
-        if (unlikely(!serial_transport_send(split_trans_initiator2target_buffer(transaction), transaction->initiator2target_buffer_size))) {
+        if (unlikely(!serial_transport_send(split_trans_initiator2target_buffer(transaction), split_trans_initiator2target_size(transaction)))) {
             serial_dprintf("SPLIT: sending buffer failed\n");
             return false;
         }
@@ -148,7 +162,7 @@ static inline bool initiate_transaction(uint8_t transaction_id) {
 
     /* Receive transaction buffer from the slave. If this transaction requires it. */
     if (transaction->target2initiator_buffer_size) {
-        if (unlikely(!serial_transport_receive(split_trans_target2initiator_buffer(transaction), transaction->target2initiator_buffer_size))) {
+        if (unlikely(!receive_transaction_buffer(transaction, split_trans_target2initiator_buffer(transaction), transaction->target2initiator_buffer_size))) {
             serial_dprintf("SPLIT: receiving buffer failed\n");
             return false;
         }
@@ -97,11 +97,11 @@ void ws2812_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
     }
 }
 
-void ws2812_flush(void) {
+void ws2812_flush_range(int start, int end) {
     // this code is very time dependent, so we need to disable interrupts
     chSysLock();
 
-    for (int i = 0; i < WS2812_LED_COUNT; i++) {
+    for (int i = 0; i < end; i++) {
         // WS2812 protocol dictates grb order
 #if (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_GRB)
         sendByte(ws2812_leds[i].g);
@@ -126,3 +126,7 @@ void ws2812_flush(void) {
 
     chSysUnlock();
 }
+
+void ws2812_flush(void) {
+    ws2812_flush_range(0, WS2812_LED_COUNT);
+}
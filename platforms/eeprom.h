@@ -70,8 +70,8 @@ void     eeprom_update_block(const void *__src, void *__dst, size_t __n);
 #    define TOTAL_EEPROM_BYTE_COUNT 4096
 #elif defined(EEPROM_TEST_HARNESS)
 #    ifndef LEGACY_FLASH_OPS_MOCKED
-// Normal tests
-#        define TOTAL_EEPROM_BYTE_COUNT 32
+// Normal tests, large enough for the whole of eeconfig
+#        define TOTAL_EEPROM_BYTE_COUNT 512
 #    else
 // Flash wear-leveling testing
 #        include "eeprom_legacy_emulated_flash_tests.h"
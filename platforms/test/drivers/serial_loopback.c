@@ -0,0 +1,157 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/*
+Loopback serial transport: both halves live in the same process, each with its
+own copy of the split shared memory. A transaction moves the same bytes as the
+serial protocol does between them, and runs the target's callback in between.
+
+The link can be given a speed, a latency for every change of direction and a
+bit error rate. Corrupted bytes are delivered like the hardware would: only the
+transaction id, the handshake and frame lengths are checked along the way.
+*/
+
+#include <string.h>
+
+#include "serial.h"
+#include "serial_loopback.h"
+
+static split_shared_memory_t   target_memory;
+static split_shared_memory_t   initiator_memory;
+static serial_loopback_stats_t loopback_stats;
+static serial_loopback_link_t  loopback_link;
+static bool                    loopback_connected = true;
+static bool                    link_to_target     = true;
+static uint64_t                link_time_ns;
+static uint32_t                link_rng;
+
+void soft_serial_initiator_init(void) {}
+
+void soft_serial_target_init(void) {}
+
+void serial_loopback_reset(void) {
+    memset(&target_memory, 0, sizeof(target_memory));
+    memset(&loopback_link, 0, sizeof(loopback_link));
+    serial_loopback_clear_stats();
+    loopback_connected = true;
+    link_to_target     = true;
+    link_rng           = 0;
+}
+
+void serial_loopback_get_stats(serial_loopback_stats_t *stats) {
+    *stats              = loopback_stats;
+    stats->link_time_us = link_time_ns / 1000;
+}
+
+void serial_loopback_clear_stats(void) {
+    memset(&loopback_stats, 0, sizeof(loopback_stats));
+    link_time_ns = 0;
+}
+
+void serial_loopback_set_connected(bool connected) {
+    loopback_connected = connected;
+}
+
+void serial_loopback_set_link(const serial_loopback_link_t *link) {
+    loopback_link = *link;
+    link_rng      = link->seed;
+}
+
+void serial_loopback_run_as_target(void (*fn)(void *), void *arg) {
+    memcpy(&initiator_memory, split_shmem, sizeof(initiator_memory));
+    memcpy(split_shmem, &target_memory, sizeof(target_memory));
+    fn(arg);
+    memcpy(&target_memory, split_shmem, sizeof(target_memory));
+    memcpy(split_shmem, &initiator_memory, sizeof(initiator_memory));
+}
+
+static void link_turn(bool to_target) {
+    if (link_to_target != to_target) {
+        link_to_target = to_target;
+        link_time_ns += (uint64_t)loopback_link.latency_us * 1000;
+    }
+}
+
+static uint8_t link_send_byte(uint8_t byte) {
+    uint8_t received = byte;
+
+    loopback_stats.bytes++;
+    if (loopback_link.baud_rate) {
+        link_time_ns += 10 * 1000000000ULL / loopback_link.baud_rate;
+    }
+    if (loopback_link.bit_error_ppm) {
+        for (uint8_t bit = 0; bit < 8; bit++) {
+            link_rng = link_rng * 1664525 + 1013904223;
+            if ((link_rng >> 8) % 1000000 < loopback_link.bit_error_ppm) {
+                received ^= 1 << bit;
+            }
+        }
+    }
+    if (received != byte) {
+        loopback_stats.corrupted_bytes++;
+    }
+    return received;
+}
+
+static bool link_send(uint8_t *destination, const uint8_t *source, uint8_t size, bool framed) {
+    for (uint8_t i = 0; i < size; i++) {
+        destination[i] = link_send_byte(source[i]);
+    }
+    // A corrupted frame length leaves the receiver waiting for more bytes, or with bytes left over
+    return !framed || destination[0] == source[0];
+}
+
+static void target_callback(void *arg) {
+    split_transaction_desc_t *trans = arg;
+    if (trans->slave_callback) {
+        trans->slave_callback(trans->initiator2target_buffer_size, split_trans_initiator2target_buffer(trans), trans->target2initiator_buffer_size, split_trans_target2initiator_buffer(trans));
+    }
+}
+
+static bool loopback_transaction(uint8_t index) {
+    split_transaction_desc_t *trans  = &split_transaction_table[index];
+    uint8_t                  *target = (uint8_t *)&target_memory;
+
+    // A corrupted transaction id or handshake leaves one of the halves waiting until it times out
+    link_turn(true);
+    if (link_send_byte(index) != index || !loopback_connected) {
+        return false;
+    }
+    link_turn(false);
+    if (link_send_byte(index ^ NUM_TOTAL_TRANSACTIONS) != (index ^ NUM_TOTAL_TRANSACTIONS)) {
+        return false;
+    }
+
+    if (trans->initiator2target_buffer_size) {
+        link_turn(true);
+        if (!link_send(&target[trans->initiator2target_offset], split_trans_initiator2target_buffer(trans), split_trans_initiator2target_size(trans), trans->framed)) {
+            return false;
+        }
+    }
+
+    serial_loopback_run_as_target(target_callback, trans);
+
+    if (trans->target2initiator_buffer_size) {
+        uint8_t size = split_trans_frame_size(trans, &target[trans->target2initiator_offset], trans->target2initiator_buffer_size);
+        link_turn(false);
+        if (!link_send(split_trans_target2initiator_buffer(trans), &target[trans->target2initiator_offset], size, trans->framed)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool soft_serial_transaction(int index) {
+    if (index < 0 || index >= NUM_TOTAL_TRANSACTIONS) {
+        return false;
+    }
+
+    loopback_stats.transactions++;
+    if (!loopback_transaction((uint8_t)index)) {
+        loopback_stats.failures++;
+        link_time_ns += (uint64_t)loopback_link.timeout_us * 1000;
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,54 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct serial_loopback_link_t {
+    uint32_t baud_rate;      // 10 bits are sent per byte, 0 for an instant link
+    uint32_t latency_us;     // added every time the link changes direction
+    uint32_t bit_error_ppm;  // flipped bits per million bits sent
+    uint32_t timeout_us;     // waited for by the initiator when a transaction fails
+    uint32_t seed;           // seeds the bit errors, so that runs repeat
+} serial_loopback_link_t;
+
+typedef struct serial_loopback_stats_t {
+    uint32_t transactions;    // round trips started by the initiator
+    uint32_t failures;        // transactions the initiator saw fail
+    uint32_t bytes;           // bytes on the wire, handshakes included
+    uint32_t corrupted_bytes; // bytes hit by a bit error
+    uint64_t link_time_us;    // time spent on the wire
+} serial_loopback_stats_t;
+
+/**
+ * \brief Clears the shared memory of the target half, the statistics and the link settings.
+ */
+void serial_loopback_reset(void);
+
+void serial_loopback_get_stats(serial_loopback_stats_t *stats);
+void serial_loopback_clear_stats(void);
+
+/**
+ * \brief Fails every transaction after sending the transaction id while disconnected.
+ */
+void serial_loopback_set_connected(bool connected);
+
+/**
+ * \brief Sets the speed, latency and bit error rate of the link.
+ */
+void serial_loopback_set_link(const serial_loopback_link_t *link);
+
+/**
+ * \brief Runs `fn` as the target half, with the target's copy of the split shared memory in place.
+ */
+void serial_loopback_run_as_target(void (*fn)(void *), void *arg);
+
+#ifdef __cplusplus
+}
+#endif
@@ -20,12 +20,18 @@ static uint8_t buffer[TOTAL_EEPROM_BYTE_COUNT];
 
 uint8_t eeprom_read_byte(const uint8_t *addr) {
     uintptr_t offset = (uintptr_t)addr;
+    if (offset >= sizeof(buffer)) {
+        return 0xFF;
+    }
     return buffer[offset];
 }
 
 void eeprom_write_byte(uint8_t *addr, uint8_t value) {
     uintptr_t offset = (uintptr_t)addr;
-    buffer[offset]   = value;
+    if (offset >= sizeof(buffer)) {
+        return;
+    }
+    buffer[offset] = value;
 }
 
 uint16_t eeprom_read_word(const uint16_t *addr) {
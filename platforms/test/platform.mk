@@ -12,6 +12,9 @@ EEP =
 BIN =
 
 
+# Tell QMK that we are hosting it on the test platform.
+COMPILEFLAGS += -DPROTOCOL_TEST
+
 COMPILEFLAGS += -funsigned-char
 ifeq ($(findstring clang, ${GCC_VERSION}),)
 COMPILEFLAGS += -funsigned-bitfields
@@ -31,6 +31,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "keycode_config.h"
 #include "debug.h"
 #include "quantum.h"
+#include "task_deadline.h"
 
 #ifdef BACKLIGHT_ENABLE
 #    include "backlight.h"
@@ -81,6 +82,9 @@ void action_exec(keyevent_t event) {
         ac_dprintf("EVENT: ");
         debug_event(event);
         ac_dprintf("\n");
+        // Any key event may change state that a sleeping task depends on, even while combos or the tapping buffer hold it back.
+        // Events replayed later through process_record() wake the tasks whose state they change themselves.
+        task_deadline_wake_all();
 #if defined(RETRO_TAPPING) || defined(RETRO_TAPPING_PER_KEY) || (defined(AUTO_SHIFT_ENABLE) && defined(RETRO_SHIFT))
         uint16_t event_keycode = get_event_keycode(event, false);
         if (event.pressed) {
@@ -1,5 +1,6 @@
 #include <limits.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "keyboard.h"
 #include "action.h"
@@ -335,6 +336,24 @@ action_t store_or_get_action(bool pressed, keypos_t key) {
 #endif
 }
 
+#if !defined(NO_ACTION_LAYER) && defined(LAYER_RESOLUTION_CACHE)
+/** \brief layer resolution cache
+ *
+ * Holds the layer each key resolves to, plus one, for resolved_layers_state.
+ * Zero until the key is first resolved.
+ */
+static uint8_t       resolved_layers[MATRIX_ROWS * MATRIX_COLS];
+static layer_state_t resolved_layers_state = 0;
+
+/** \brief clear layer resolution cache
+ *
+ * Forgets every resolved layer. Needs to be called when the keymap itself changes.
+ */
+void layer_resolution_cache_clear(void) {
+    memset(resolved_layers, 0, sizeof(resolved_layers));
+}
+#endif
+
 /** \brief Layer switch get layer
  *
  * Gets the layer based on key info
@@ -345,17 +364,37 @@ uint8_t layer_switch_get_layer(keypos_t key) {
     action.code = ACTION_TRANSPARENT;
 
     layer_state_t layers = layer_state | default_layer_state;
-    /* check top layer first */
+#    ifdef LAYER_RESOLUTION_CACHE
+    uint8_t *resolved = NULL;
+    if (key.row < MATRIX_ROWS && key.col < MATRIX_COLS) {
+        /* the cache is only valid for the layer state it was filled with */
+        if (layers != resolved_layers_state) {
+            layer_resolution_cache_clear();
+            resolved_layers_state = layers;
+        }
+        resolved = &resolved_layers[key.row * MATRIX_COLS + key.col];
+        if (*resolved) {
+            return *resolved - 1;
+        }
+    }
+#    endif
+    /* check top layer first, and fall back to layer 0 */
+    uint8_t layer = 0;
     for (int8_t i = MAX_LAYER - 1; i >= 0; i--) {
         if (layers & ((layer_state_t)1 << i)) {
             action = action_for_key(i, key);
             if (action.code != ACTION_TRANSPARENT) {
-                return i;
+                layer = i;
+                break;
             }
         }
     }
-    /* fall back to layer 0 */
-    return 0;
+#    ifdef LAYER_RESOLUTION_CACHE
+    if (resolved) {
+        *resolved = layer + 1;
+    }
+#    endif
+    return layer;
 #else
     return get_highest_layer(default_layer_state);
 #endif
@@ -169,5 +169,10 @@ action_t store_or_get_action(bool pressed, keypos_t key);
 /* return the topmost non-transparent layer currently associated with key */
 uint8_t layer_switch_get_layer(keypos_t key);
 
+#if !defined(NO_ACTION_LAYER) && defined(LAYER_RESOLUTION_CACHE)
+/* forget the layers keys resolved to, after the keymap changed */
+void layer_resolution_cache_clear(void);
+#endif
+
 /* return action depending on current layer status */
 action_t layer_switch_get_action(keypos_t key);
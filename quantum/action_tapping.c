@@ -1,5 +1,6 @@
 #include <stdint.h>
 #include <stdbool.h>
+#include <string.h>
 
 #include "action.h"
 #include "action_layer.h"
@@ -8,6 +9,7 @@
 #include "keycode.h"
 #include "quantum_keycodes.h"
 #include "timer.h"
+#include "compiler_support.h"
 
 #ifndef NO_ACTION_TAPPING
 
@@ -115,12 +117,30 @@ static keyrecord_t waiting_buffer[WAITING_BUFFER_SIZE] = {};
 static uint8_t     waiting_buffer_head                 = 0;
 static uint8_t     waiting_buffer_tail                 = 0;
 
+// The per key counters below hold up to 15 events each
+STATIC_ASSERT(WAITING_BUFFER_SIZE >= 2 && WAITING_BUFFER_SIZE <= 16, "WAITING_BUFFER_SIZE must be between 2 and 16");
+// Number of buffered presses (high nibble) and releases (low nibble) of each
+// matrix key, kept up to date on enqueue and dequeue so that lookups by key
+// don't rescan the buffer. Keys outside the matrix fall back to a scan.
+// Two walks remain linear in the number of buffered events: the chordal hold
+// search, which has to ask get_chordal_hold() about every pair of consecutive
+// presses, and the replay of the buffer once the tapping key settles, which
+// processes every event it visits.
+static uint8_t waiting_buffer_key_events[MATRIX_ROWS][MATRIX_COLS] = {};
+static uint8_t waiting_buffer_presses                              = 0;
+
 static bool process_tapping(keyrecord_t *record);
 static bool waiting_buffer_enq(keyrecord_t record);
+static void waiting_buffer_deq(void);
+#    ifndef TAPPING_BUFFER_LOSSLESS
 static void waiting_buffer_clear(void);
+#    endif
 static bool waiting_buffer_typed(keyevent_t event);
 static bool waiting_buffer_has_anykey_pressed(void);
 static void waiting_buffer_scan_tap(void);
+#    ifdef TAPPING_BUFFER_LOSSLESS
+static void waiting_buffer_settle_oldest(void);
+#    endif
 static void debug_tapping_key(void);
 static void debug_waiting_buffer(void);
 
@@ -137,11 +157,19 @@ void action_tapping_process(keyrecord_t record) {
         }
     } else {
         if (!waiting_buffer_enq(record)) {
+#    ifdef TAPPING_BUFFER_LOSSLESS
+            // make room by settling the oldest pending decision.
+            ac_dprintf("OVERFLOW: SETTLE OLDEST\n");
+            do {
+                waiting_buffer_settle_oldest();
+            } while (!waiting_buffer_enq(record));
+#    else
             // clear all in case of overflow.
             ac_dprintf("OVERFLOW: CLEAR ALL STATES\n");
             clear_keyboard();
             waiting_buffer_clear();
             tapping_key = (keyrecord_t){0};
+#    endif
         }
     }
 
@@ -149,7 +177,7 @@ void action_tapping_process(keyrecord_t record) {
     if (IS_EVENT(record.event) && waiting_buffer_head != waiting_buffer_tail) {
         ac_dprintf("---- action_exec: process waiting_buffer -----\n");
     }
-    for (; waiting_buffer_tail != waiting_buffer_head; waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE) {
+    for (; waiting_buffer_tail != waiting_buffer_head; waiting_buffer_deq()) {
         if (process_tapping(&waiting_buffer[waiting_buffer_tail])) {
             ac_dprintf("processed: waiting_buffer[%u] =", waiting_buffer_tail);
             debug_record(waiting_buffer[waiting_buffer_tail]);
@@ -293,7 +321,7 @@ bool process_tapping(keyrecord_t *keyp) {
                     // Now that tapping_key has settled as tapped, check whether
                     // Flow Tap applies to following yet-unsettled keys.
                     uint16_t prev_time = tapping_key.event.time;
-                    for (; waiting_buffer_tail != waiting_buffer_head; waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE) {
+                    for (; waiting_buffer_tail != waiting_buffer_head; waiting_buffer_deq()) {
                         keyrecord_t *record = &waiting_buffer[waiting_buffer_tail];
                         if (!record->event.pressed) {
                             break;
@@ -353,7 +381,7 @@ bool process_tapping(keyrecord_t *keyp) {
                     uint8_t first_tap = waiting_buffer_find_chordal_hold_tap();
                     ac_dprintf("first_tap = %u\n", first_tap);
                     if (first_tap < WAITING_BUFFER_SIZE) {
-                        for (; waiting_buffer_tail != first_tap; waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE) {
+                        for (; waiting_buffer_tail != first_tap; waiting_buffer_deq()) {
                             ac_dprintf("Processing [%u]\n", waiting_buffer_tail);
                             process_record(&waiting_buffer[waiting_buffer_tail]);
                         }
@@ -453,7 +481,7 @@ bool process_tapping(keyrecord_t *keyp) {
                             if (waiting_buffer_tail != waiting_buffer_head && is_tap_record(&waiting_buffer[waiting_buffer_tail])) {
                                 tapping_key = waiting_buffer[waiting_buffer_tail];
                                 // Pop tail from the queue.
-                                waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE;
+                                waiting_buffer_deq();
                                 debug_waiting_buffer();
                             } else
 #    endif // CHORDAL_HOLD
@@ -620,6 +648,20 @@ bool process_tapping(keyrecord_t *keyp) {
     }
 }
 
+static inline bool waiting_buffer_in_matrix(keypos_t key) {
+    return key.row < MATRIX_ROWS && key.col < MATRIX_COLS;
+}
+
+/** \brief Adds `delta` to the buffered press or release count of the key of `event`. */
+static void waiting_buffer_count(const keyevent_t *event, int8_t delta) {
+    if (event->pressed) {
+        waiting_buffer_presses += delta;
+    }
+    if (waiting_buffer_in_matrix(event->key)) {
+        waiting_buffer_key_events[event->key.row][event->key.col] += event->pressed ? delta * 0x10 : delta;
+    }
+}
+
 /** \brief Waiting buffer enq
  *
  * FIXME: Needs docs
@@ -636,26 +678,42 @@ bool waiting_buffer_enq(keyrecord_t record) {
 
     waiting_buffer[waiting_buffer_head] = record;
     waiting_buffer_head                 = (waiting_buffer_head + 1) % WAITING_BUFFER_SIZE;
+    waiting_buffer_count(&record.event, 1);
 
     ac_dprintf("waiting_buffer_enq: ");
     debug_waiting_buffer();
     return true;
 }
 
+#    ifndef TAPPING_BUFFER_LOSSLESS
 /** \brief Waiting buffer clear
  *
  * FIXME: Needs docs
  */
 void waiting_buffer_clear(void) {
-    waiting_buffer_head = 0;
-    waiting_buffer_tail = 0;
+    waiting_buffer_head    = 0;
+    waiting_buffer_tail    = 0;
+    waiting_buffer_presses = 0;
+    memset(waiting_buffer_key_events, 0, sizeof(waiting_buffer_key_events));
+}
+#    endif
+
+/** \brief Pops the tail of the waiting buffer. */
+void waiting_buffer_deq(void) {
+    waiting_buffer_count(&waiting_buffer[waiting_buffer_tail].event, -1);
+    waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE;
 }
 
 /** \brief Waiting buffer typed
  *
- * FIXME: Needs docs
+ * Returns whether the waiting buffer holds an event of the opposite state for
+ * the key of `event`, i.e. whether that key was typed while waiting.
  */
 bool waiting_buffer_typed(keyevent_t event) {
+    if (waiting_buffer_in_matrix(event.key)) {
+        const uint8_t counts = waiting_buffer_key_events[event.key.row][event.key.col];
+        return event.pressed ? (counts & 0x0F) : (counts >> 4);
+    }
     for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
         if (KEYEQ(event.key, waiting_buffer[i].event.key) && event.pressed != waiting_buffer[i].event.pressed) {
             return true;
@@ -669,10 +727,7 @@ bool waiting_buffer_typed(keyevent_t event) {
  * FIXME: Needs docs
  */
 __attribute__((unused)) bool waiting_buffer_has_anykey_pressed(void) {
-    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
-        if (waiting_buffer[i].event.pressed) return true;
-    }
-    return false;
+    return waiting_buffer_presses > 0;
 }
 
 /** \brief Scan buffer for tapping
@@ -686,6 +741,10 @@ void waiting_buffer_scan_tap(void) {
     if ((tapping_key.tap.count > 0) || !tapping_key.event.pressed) {
         return;
     }
+    // - the tapping key has no buffered release
+    if (waiting_buffer_in_matrix(tapping_key.event.key) && !waiting_buffer_typed(tapping_key.event)) {
+        return;
+    }
 
 #    if (defined(AUTO_SHIFT_ENABLE) && defined(RETRO_SHIFT))
     TAP_DEFINE_KEYCODE;
@@ -708,6 +767,39 @@ void waiting_buffer_scan_tap(void) {
     }
 }
 
+#    ifdef TAPPING_BUFFER_LOSSLESS
+/** \brief Frees at least one slot of the full waiting buffer without dropping events
+ *
+ * An unsettled tapping key that has been interrupted by this many events is
+ * settled as held, as if its tapping term had expired. Otherwise the oldest
+ * buffered event is run through process_tapping(), so that a tap-hold key
+ * press becomes the next tapping key, and is processed as is only if it would
+ * be buffered again. The rest of the buffer is then run through
+ * process_tapping() again.
+ */
+static void waiting_buffer_settle_oldest(void) {
+    if (tapping_key.event.pressed && tapping_key.tap.count == 0) {
+        ac_dprintf("Tapping: End. Waiting buffer full, not tap(0)\n");
+        process_record(&tapping_key);
+        tapping_key = (keyrecord_t){0};
+        debug_tapping_key();
+    } else if (waiting_buffer_tail != waiting_buffer_head) {
+        ac_dprintf("waiting_buffer_settle_oldest: processing [%u]\n", waiting_buffer_tail);
+        if (!process_tapping(&waiting_buffer[waiting_buffer_tail])) {
+            process_record(&waiting_buffer[waiting_buffer_tail]);
+        }
+        waiting_buffer_deq();
+    }
+
+    for (; waiting_buffer_tail != waiting_buffer_head; waiting_buffer_deq()) {
+        if (!process_tapping(&waiting_buffer[waiting_buffer_tail])) {
+            break;
+        }
+    }
+    debug_waiting_buffer();
+}
+#    endif // TAPPING_BUFFER_LOSSLESS
+
 #    if defined(CHORDAL_HOLD) || defined(FLOW_TAP_TERM)
 static void registered_taps_add(keypos_t key) {
     if (num_registered_taps >= REGISTERED_TAPS_SIZE) {
@@ -797,7 +889,7 @@ static void waiting_buffer_chordal_hold_taps_until(keypos_t key) {
             registered_taps_add(record->event.key);
         }
         process_record(record);
-        waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE;
+        waiting_buffer_deq();
 
         if (KEYEQ(key, record->event.key) && record->event.pressed) {
             break;
@@ -806,7 +898,7 @@ static void waiting_buffer_chordal_hold_taps_until(keypos_t key) {
 }
 
 static void waiting_buffer_process_regular(void) {
-    for (; waiting_buffer_tail != waiting_buffer_head; waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE) {
+    for (; waiting_buffer_tail != waiting_buffer_head; waiting_buffer_deq()) {
         if (is_tap_record(&waiting_buffer[waiting_buffer_tail])) {
             break; // Stop once a tap-hold key event is reached.
         }
@@ -17,6 +17,7 @@
 #include "timer.h"
 #include "action.h"
 #include "action_util.h"
+#include "task_deadline.h"
 
 /** @brief True when Caps Word is active. */
 static bool caps_word_active = false;
@@ -32,16 +33,26 @@ static bool caps_word_active = false;
 static uint16_t idle_timer = 0;
 
 void caps_word_task(void) {
-    if (caps_word_active && timer_expired(timer_read(), idle_timer)) {
+    const uint16_t now = timer_read();
+    if (caps_word_active && timer_expired(now, idle_timer)) {
         caps_word_off();
     }
+
+    if (caps_word_active) {
+        task_deadline_defer(TASK_DEADLINE_CAPS_WORD, (uint16_t)(idle_timer - now));
+    } else {
+        task_deadline_sleep(TASK_DEADLINE_CAPS_WORD);
+    }
 }
 
 void caps_word_reset_idle_timer(void) {
     idle_timer = timer_read() + CAPS_WORD_IDLE_TIMEOUT;
+    task_deadline_wake(TASK_DEADLINE_CAPS_WORD);
 }
 #else
-void caps_word_task(void) {}
+void caps_word_task(void) {
+    task_deadline_sleep(TASK_DEADLINE_CAPS_WORD);
+}
 #endif // CAPS_WORD_IDLE_TIMEOUT > 0
 
 void caps_word_on(void) {
@@ -95,3 +95,5 @@ typedef hsv_t HSV;
 
 rgb_t hsv_to_rgb(hsv_t hsv);
 rgb_t hsv_to_rgb_nocie(hsv_t hsv);
+// Converts count colours at once, as hsv_to_rgb() would one at a time
+void hsv_to_rgb_array(const hsv_t *hsv, rgb_t *rgb, uint8_t count);
@@ -0,0 +1,168 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/*
+Bit-sliced symmetric per-key algorithm. Behaves exactly like sym_defer_pk, but
+the per-key counters are stored bit-sliced: bit b of every counter in a row is
+kept in one matrix_row_t, so a whole row of counters is started, decremented and
+expired with a handful of bitwise operations instead of a loop over its columns.
+The counters are statically allocated.
+*/
+
+#include "debounce.h"
+#include "timer.h"
+
+#ifndef DEBOUNCE
+#    define DEBOUNCE 5
+#endif
+
+// Maximum debounce: 255ms
+#if DEBOUNCE > UINT8_MAX
+#    undef DEBOUNCE
+#    define DEBOUNCE UINT8_MAX
+#endif
+
+#if DEBOUNCE > 0
+
+// Number of bit planes needed to hold a counter value of DEBOUNCE
+#    if DEBOUNCE < 2
+#        define DEBOUNCE_BITS 1
+#    elif DEBOUNCE < 4
+#        define DEBOUNCE_BITS 2
+#    elif DEBOUNCE < 8
+#        define DEBOUNCE_BITS 3
+#    elif DEBOUNCE < 16
+#        define DEBOUNCE_BITS 4
+#    elif DEBOUNCE < 32
+#        define DEBOUNCE_BITS 5
+#    elif DEBOUNCE < 64
+#        define DEBOUNCE_BITS 6
+#    elif DEBOUNCE < 128
+#        define DEBOUNCE_BITS 7
+#    else
+#        define DEBOUNCE_BITS 8
+#    endif
+
+// Spreads bit `bit` of `value` over a whole row
+#    define ROW_MASK(value, bit) ((((value) >> (bit)) & 1) ? (matrix_row_t)~(matrix_row_t)0 : (matrix_row_t)0)
+
+// debounce_counters[row][bit] holds bit `bit` of the counters of every key in `row`, zero once elapsed
+static matrix_row_t debounce_counters[MATRIX_ROWS][DEBOUNCE_BITS];
+static fast_timer_t last_time;
+static bool         counters_need_update;
+static bool         cooked_changed;
+
+static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint8_t elapsed_time);
+static void start_debounce_counters(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows);
+
+static inline matrix_row_t active_counters(const matrix_row_t counter[]) {
+    matrix_row_t active = 0;
+    for (uint8_t bit = 0; bit < DEBOUNCE_BITS; bit++) {
+        active |= counter[bit];
+    }
+    return active;
+}
+
+// we use num_rows rather than MATRIX_ROWS to support split keyboards
+void debounce_init(uint8_t num_rows) {
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t bit = 0; bit < DEBOUNCE_BITS; bit++) {
+            debounce_counters[row][bit] = 0;
+        }
+    }
+    counters_need_update = false;
+}
+
+void debounce_free(void) {}
+
+bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) {
+    bool updated_last = false;
+    cooked_changed    = false;
+
+    if (counters_need_update) {
+        fast_timer_t now          = timer_read_fast();
+        fast_timer_t elapsed_time = TIMER_DIFF_FAST(now, last_time);
+
+        last_time    = now;
+        updated_last = true;
+        if (elapsed_time > UINT8_MAX) {
+            elapsed_time = UINT8_MAX;
+        }
+
+        if (elapsed_time > 0) {
+            update_debounce_counters_and_transfer_if_expired(raw, cooked, num_rows, elapsed_time);
+        }
+    }
+
+    if (changed) {
+        if (!updated_last) {
+            last_time = timer_read_fast();
+        }
+
+        start_debounce_counters(raw, cooked, num_rows);
+    }
+
+    return cooked_changed;
+}
+
+static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint8_t elapsed_time) {
+    counters_need_update = false;
+
+    // No counter exceeds DEBOUNCE, so anything longer expires all of them
+    if (elapsed_time > DEBOUNCE) {
+        elapsed_time = DEBOUNCE;
+    }
+
+    for (uint8_t row = 0; row < num_rows; row++) {
+        matrix_row_t *counter = debounce_counters[row];
+        matrix_row_t  active  = active_counters(counter);
+        if (!active) {
+            continue;
+        }
+
+        // Subtract elapsed_time from every active counter of the row at once, rippling the borrow through the bit planes
+        matrix_row_t borrow    = 0;
+        matrix_row_t remaining = 0;
+        for (uint8_t bit = 0; bit < DEBOUNCE_BITS; bit++) {
+            matrix_row_t c = counter[bit];
+            matrix_row_t e = ROW_MASK(elapsed_time, bit);
+            counter[bit]   = (c ^ e ^ borrow) & active;
+            borrow         = (~c & (e | borrow)) | (c & e & borrow);
+            remaining |= counter[bit];
+        }
+
+        // Counters that reached zero or went below it have expired
+        matrix_row_t expired = active & (borrow | ~remaining);
+        if (expired) {
+            for (uint8_t bit = 0; bit < DEBOUNCE_BITS; bit++) {
+                counter[bit] &= ~expired;
+            }
+            matrix_row_t cooked_next = (cooked[row] & ~expired) | (raw[row] & expired);
+            cooked_changed |= cooked[row] ^ cooked_next;
+            cooked[row] = cooked_next;
+        }
+        if (active & ~expired) {
+            counters_need_update = true;
+        }
+    }
+}
+
+static void start_debounce_counters(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows) {
+    for (uint8_t row = 0; row < num_rows; row++) {
+        matrix_row_t *counter = debounce_counters[row];
+        matrix_row_t  delta   = raw[row] ^ cooked[row];
+        matrix_row_t  start   = delta & ~active_counters(counter);
+
+        // Keys that changed back are reset, keys that changed and weren't counting yet start at DEBOUNCE
+        for (uint8_t bit = 0; bit < DEBOUNCE_BITS; bit++) {
+            counter[bit] = (counter[bit] & delta) | (start & ROW_MASK(DEBOUNCE, bit));
+        }
+        if (start) {
+            counters_need_update = true;
+        }
+    }
+}
+
+#else
+#    include "none.c"
+#endif
@@ -17,8 +17,10 @@
 #include "gtest/gtest.h"
 
 #include "debounce_test_common.h"
+#include "benchmark_util.hpp"
 
 #include <algorithm>
+#include <chrono>
 #include <iomanip>
 #include <sstream>
 
@@ -219,3 +221,122 @@ void DebounceTest::matrixUpdate(matrix_row_t matrix[], const std::string &name,
 DebounceTestEvent::DebounceTestEvent(fast_timer_t time, std::initializer_list<MatrixTestEvent> inputs, std::initializer_list<MatrixTestEvent> outputs) : time_(time), inputs_(inputs), outputs_(outputs) {}
 
 MatrixTestEvent::MatrixTestEvent(int row, int col, Direction direction) : row_(row), col_(col), direction_(direction) {}
+
+/* Every key is pressed and released at random, and bounces for up to 10ms after each change. While a key bounces,
+ * each scan reads it as pressed or released at random. noise_percent sets the share of keys that change per second. */
+std::vector<DebounceEquivalenceTest::Scan> DebounceEquivalenceTest::generateScans(uint32_t seed, int scans, int noise_percent, bool irregular_time) {
+    uint32_t rng    = seed;
+    auto     random = [&](uint32_t range) {
+        rng = rng * 1664525 + 1013904223;
+        return (rng >> 8) % range;
+    };
+
+    std::vector<Scan>         result;
+    std::vector<matrix_row_t> state(MATRIX_ROWS, 0);
+    std::vector<uint32_t>     bounce_until(MATRIX_ROWS * MATRIX_COLS, 0);
+    uint32_t                  now = 0;
+
+    result.reserve(scans);
+    for (int i = 0; i < scans; i++) {
+        Scan scan;
+        scan.advance = 1;
+        if (irregular_time) {
+            /* Mostly 1kHz, with repeated scans in the same millisecond, slow scans and the odd long stall */
+            uint32_t r   = random(1000);
+            scan.advance = r < 100 ? 0 : r < 200 ? 2 + random(4) : r < 202 ? 200 + random(400) : 1;
+        }
+        now += scan.advance;
+
+        scan.raw.resize(MATRIX_ROWS);
+        for (int row = 0; row < MATRIX_ROWS; row++) {
+            for (int col = 0; col < MATRIX_COLS; col++) {
+                matrix_row_t bit = (matrix_row_t)1 << col;
+                uint32_t    &key = bounce_until[row * MATRIX_COLS + col];
+                if ((int)random(100000) < noise_percent * 100) {
+                    state[row] ^= bit;
+                    key = now + random(11);
+                }
+                bool pressed = now < key ? random(2) : (state[row] & bit);
+                if (pressed) {
+                    scan.raw[row] |= bit;
+                }
+            }
+        }
+        result.push_back(std::move(scan));
+    }
+    return result;
+}
+
+void DebounceEquivalenceTest::runEquivalence(const DebounceImplementation &reference, const DebounceImplementation &implementation, uint32_t seed, int scans, int noise_percent) {
+    std::vector<Scan> input                        = generateScans(seed, scans, noise_percent, true);
+    matrix_row_t      previous[MATRIX_ROWS]        = {0};
+    matrix_row_t      expected_cooked[MATRIX_ROWS] = {0};
+    matrix_row_t      actual_cooked[MATRIX_ROWS]   = {0};
+    uint32_t          cooked_changes               = 0;
+    matrix_row_t      raw[MATRIX_ROWS];
+
+    set_time(7777);
+    reference.init(MATRIX_ROWS);
+    implementation.init(MATRIX_ROWS);
+
+    for (int i = 0; i < scans; i++) {
+        advance_time(input[i].advance);
+        bool changed = !std::equal(input[i].raw.begin(), input[i].raw.end(), previous);
+        std::copy(input[i].raw.begin(), input[i].raw.end(), previous);
+
+        std::copy(input[i].raw.begin(), input[i].raw.end(), raw);
+        bool expected_changed = reference.debounce(raw, expected_cooked, MATRIX_ROWS, changed);
+        std::copy(input[i].raw.begin(), input[i].raw.end(), raw);
+        bool actual_changed = implementation.debounce(raw, actual_cooked, MATRIX_ROWS, changed);
+
+        ASSERT_TRUE(std::equal(std::begin(expected_cooked), std::end(expected_cooked), actual_cooked)) << implementation.name << " cooked matrix differs from " << reference.name << " at scan " << i << " (seed " << seed << ")\nexpected_matrix:\n" << strMatrix(expected_cooked) << "\nactual_matrix:\n" << strMatrix(actual_cooked);
+        ASSERT_EQ(expected_changed, actual_changed) << implementation.name << " change result differs from " << reference.name << " at scan " << i << " (seed " << seed << ")";
+        cooked_changes += expected_changed;
+    }
+
+    reference.free();
+    implementation.free();
+
+    /* Make sure the input actually exercised the algorithms */
+    EXPECT_GT(cooked_changes, 0);
+}
+
+double DebounceEquivalenceTest::benchmark(const DebounceImplementation &implementation, uint32_t seed, int scans, int noise_percent) {
+    std::vector<Scan> input                 = generateScans(seed, scans, noise_percent, false);
+    matrix_row_t      previous[MATRIX_ROWS] = {0};
+    matrix_row_t      cooked[MATRIX_ROWS]   = {0};
+    matrix_row_t      raw[MATRIX_ROWS];
+
+    set_time(7777);
+    implementation.init(MATRIX_ROWS);
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < scans; i++) {
+        advance_time(input[i].advance);
+        bool changed = !std::equal(input[i].raw.begin(), input[i].raw.end(), previous);
+        std::copy(input[i].raw.begin(), input[i].raw.end(), previous);
+        std::copy(input[i].raw.begin(), input[i].raw.end(), raw);
+        implementation.debounce(raw, cooked, MATRIX_ROWS, changed);
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    implementation.free();
+
+    double scans_per_second = scans / seconds;
+    report_benchmark(std::string(implementation.name) + "_noise_" + std::to_string(noise_percent), {{"matrix", std::to_string(MATRIX_ROWS) + "x" + std::to_string(MATRIX_COLS)}, {"noise", noise_percent, "%"}, {"scans/s", scans_per_second}});
+    return scans_per_second;
+}
+
+std::string DebounceEquivalenceTest::strMatrix(const matrix_row_t matrix[]) {
+    std::stringstream text;
+
+    for (int row = 0; row < MATRIX_ROWS; row++) {
+        text << "\t" << std::setw(2) << row << ":";
+        for (int col = 0; col < MATRIX_COLS; col++) {
+            text << ((matrix[row] & ((matrix_row_t)1 << col)) ? " XX" : " __");
+        }
+        text << "\n";
+    }
+
+    return text.str();
+}
@@ -16,9 +16,11 @@
 
 #include "gtest/gtest.h"
 
+#include <cstdint>
 #include <initializer_list>
 #include <list>
 #include <string>
+#include <vector>
 
 extern "C" {
 #include "matrix.h"
@@ -80,3 +82,29 @@ class DebounceTest : public ::testing::Test {
     int  extra_iterations_;
     bool auto_advance_time_;
 };
+
+/* Entry points of a debounce algorithm, so that two of them can be linked into the same test */
+struct DebounceImplementation {
+    const char *name;
+    void (*init)(uint8_t num_rows);
+    bool (*debounce)(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed);
+    void (*free)(void);
+};
+
+class DebounceEquivalenceTest : public ::testing::Test {
+   protected:
+    /* Feeds the same pseudo-random bouncing input to both algorithms and expects identical cooked matrices */
+    void runEquivalence(const DebounceImplementation &reference, const DebounceImplementation &implementation, uint32_t seed, int scans, int noise_percent);
+
+    /* Replays pseudo-random bouncing input through the algorithm and returns the achieved scans per second */
+    double benchmark(const DebounceImplementation &implementation, uint32_t seed, int scans, int noise_percent);
+
+   private:
+    struct Scan {
+        fast_timer_t              advance;
+        std::vector<matrix_row_t> raw;
+    };
+
+    static std::vector<Scan> generateScans(uint32_t seed, int scans, int noise_percent, bool irregular_time);
+    static std::string       strMatrix(const matrix_row_t matrix[]);
+};
@@ -53,3 +53,16 @@ debounce_asym_eager_defer_pk_DEFS := $(DEBOUNCE_COMMON_DEFS)
 debounce_asym_eager_defer_pk_SRC := $(DEBOUNCE_COMMON_SRC) \
 	$(QUANTUM_PATH)/debounce/asym_eager_defer_pk.c \
 	$(QUANTUM_PATH)/debounce/tests/asym_eager_defer_pk_tests.cpp
+
+debounce_sym_defer_pk_sliced_DEFS := $(DEBOUNCE_COMMON_DEFS)
+debounce_sym_defer_pk_sliced_SRC := $(DEBOUNCE_COMMON_SRC) \
+	$(QUANTUM_PATH)/debounce/sym_defer_pk_sliced.c \
+	$(QUANTUM_PATH)/debounce/tests/sym_defer_pk_reference.c \
+	$(QUANTUM_PATH)/debounce/tests/sym_defer_pk_tests.cpp \
+	$(QUANTUM_PATH)/debounce/tests/sym_defer_pk_sliced_equivalence_tests.cpp
+
+debounce_sym_defer_pk_sliced_large_DEFS := -DMATRIX_ROWS=24 -DMATRIX_COLS=32 -DDEBOUNCE=5
+debounce_sym_defer_pk_sliced_large_SRC := $(DEBOUNCE_COMMON_SRC) \
+	$(QUANTUM_PATH)/debounce/sym_defer_pk_sliced.c \
+	$(QUANTUM_PATH)/debounce/tests/sym_defer_pk_reference.c \
+	$(QUANTUM_PATH)/debounce/tests/sym_defer_pk_sliced_equivalence_tests.cpp
@@ -0,0 +1,10 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/* sym_defer_pk under different names, so that other algorithms can be compared against it in the same test */
+
+#define debounce_init sym_defer_pk_debounce_init
+#define debounce sym_defer_pk_debounce
+#define debounce_free sym_defer_pk_debounce_free
+
+#include "../sym_defer_pk.c"
@@ -0,0 +1,39 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include "debounce_test_common.h"
+
+extern "C" {
+#include "debounce.h"
+
+void sym_defer_pk_debounce_init(uint8_t num_rows);
+bool sym_defer_pk_debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed);
+void sym_defer_pk_debounce_free(void);
+}
+
+static const DebounceImplementation sym_defer_pk        = {"sym_defer_pk", sym_defer_pk_debounce_init, sym_defer_pk_debounce, sym_defer_pk_debounce_free};
+static const DebounceImplementation sym_defer_pk_sliced = {"sym_defer_pk_sliced", debounce_init, debounce, debounce_free};
+
+TEST_F(DebounceEquivalenceTest, MatchesSymDeferPkTyping) {
+    for (uint32_t seed = 1; seed <= 10; seed++) {
+        runEquivalence(sym_defer_pk, sym_defer_pk_sliced, seed, 20000, 1);
+    }
+}
+
+TEST_F(DebounceEquivalenceTest, MatchesSymDeferPkNoise) {
+    for (uint32_t seed = 1; seed <= 10; seed++) {
+        runEquivalence(sym_defer_pk, sym_defer_pk_sliced, seed, 20000, 30);
+    }
+}
+
+TEST_F(DebounceEquivalenceTest, BenchmarkTyping) {
+    benchmark(sym_defer_pk, 1, 100000, 1);
+    benchmark(sym_defer_pk_sliced, 1, 100000, 1);
+}
+
+TEST_F(DebounceEquivalenceTest, BenchmarkNoise) {
+    benchmark(sym_defer_pk, 1, 100000, 30);
+    benchmark(sym_defer_pk_sliced, 1, 100000, 30);
+}
@@ -5,4 +5,6 @@ TEST_LIST += \
 	debounce_sym_defer_pr \
 	debounce_sym_eager_pk \
 	debounce_sym_eager_pr \
-	debounce_asym_eager_defer_pk
+	debounce_asym_eager_defer_pk \
+	debounce_sym_defer_pk_sliced \
+	debounce_sym_defer_pk_sliced_large
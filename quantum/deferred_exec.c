@@ -4,6 +4,7 @@
 #include <stddef.h>
 #include <timer.h>
 #include <deferred_exec.h>
+#include "compiler_support.h"
 
 #ifndef MAX_DEFERRED_EXECUTORS
 #    define MAX_DEFERRED_EXECUTORS 8
@@ -159,19 +160,229 @@ void deferred_exec_advanced_task(deferred_executor_t *table, size_t table_count,
 //------------------------------------
 // Basic API: used by user-mode code, guaranteed to not collide with core deferred execution
 //
+// The basic executors are kept in a binary min-heap ordered by trigger time, so that the main loop only ever looks at
+// the earliest one, and scheduling, extending and cancelling are O(log n). Tokens encode the slot of their executor,
+// so they are resolved without searching.
+//
+
+#define DEFERRED_TOKEN_MAX ((deferred_token)~0)
+
+STATIC_ASSERT(MAX_DEFERRED_EXECUTORS <= DEFERRED_TOKEN_MAX / 2, "MAX_DEFERRED_EXECUTORS is too large for deferred_token");
+
+#if MAX_DEFERRED_EXECUTORS > 253
+typedef uint16_t executor_index_t;
+#else
+typedef uint8_t executor_index_t;
+#endif
+
+// Values of heap_pos for executors that are not in the heap.
+#define EXECUTOR_NOT_QUEUED ((executor_index_t)~0)
+#define EXECUTOR_REQUEUED ((executor_index_t)(EXECUTOR_NOT_QUEUED - 1))
 
 static uint32_t            last_deferred_exec_check                = 0;
 static deferred_executor_t basic_executors[MAX_DEFERRED_EXECUTORS] = {0};
+static executor_index_t    heap[MAX_DEFERRED_EXECUTORS];
+static executor_index_t    heap_pos[MAX_DEFERRED_EXECUTORS];
+static executor_index_t    heap_size = 0;
+static executor_index_t    free_slots[MAX_DEFERRED_EXECUTORS];
+static executor_index_t    free_count  = 0;
+static executor_index_t    fresh_slots = 0;
+static executor_index_t    requeued[MAX_DEFERRED_EXECUTORS];
+
+static inline bool executor_before(executor_index_t a, executor_index_t b) {
+    return ((int32_t)TIMER_DIFF_32(basic_executors[a].trigger_time, basic_executors[b].trigger_time)) < 0;
+}
+
+static inline void heap_place(executor_index_t i, executor_index_t slot) {
+    heap[i]        = slot;
+    heap_pos[slot] = i;
+}
+
+static void heap_sift_up(executor_index_t i) {
+    executor_index_t slot = heap[i];
+    while (i > 0) {
+        executor_index_t parent = (i - 1) / 2;
+        if (!executor_before(slot, heap[parent])) {
+            break;
+        }
+        heap_place(i, heap[parent]);
+        i = parent;
+    }
+    heap_place(i, slot);
+}
+
+static void heap_sift_down(executor_index_t i) {
+    executor_index_t slot = heap[i];
+    while (true) {
+        uint32_t child = 2 * (uint32_t)i + 1;
+        if (child >= heap_size) {
+            break;
+        }
+        if (child + 1 < heap_size && executor_before(heap[child + 1], heap[child])) {
+            ++child;
+        }
+        if (!executor_before(heap[child], slot)) {
+            break;
+        }
+        heap_place(i, heap[child]);
+        i = child;
+    }
+    heap_place(i, slot);
+}
+
+static void heap_update(executor_index_t i) {
+    if (i > 0 && executor_before(heap[i], heap[(i - 1) / 2])) {
+        heap_sift_up(i);
+    } else {
+        heap_sift_down(i);
+    }
+}
+
+static void heap_push(executor_index_t slot) {
+    heap_place(heap_size, slot);
+    heap_sift_up(heap_size++);
+}
+
+static void heap_remove(executor_index_t slot) {
+    executor_index_t i = heap_pos[slot];
+    heap_pos[slot]     = EXECUTOR_NOT_QUEUED;
+    if (i != --heap_size) {
+        heap_place(i, heap[heap_size]);
+        heap_update(i);
+    }
+}
+
+static deferred_executor_t *basic_executor_find(deferred_token token) {
+    if (token == INVALID_DEFERRED_TOKEN) {
+        return NULL;
+    }
+    deferred_executor_t *entry = &basic_executors[(token - 1) % MAX_DEFERRED_EXECUTORS];
+    return (entry->token == token && entry->callback) ? entry : NULL;
+}
+
+static void basic_executor_free(executor_index_t slot) {
+    // The token is kept, so that the next one handed out for this slot differs from it.
+    basic_executors[slot].trigger_time = 0;
+    basic_executors[slot].callback     = NULL;
+    basic_executors[slot].cb_arg       = NULL;
+    free_slots[free_count++]           = slot;
+}
 
 deferred_token defer_exec(uint32_t delay_ms, deferred_exec_callback callback, void *cb_arg) {
-    return defer_exec_advanced(basic_executors, MAX_DEFERRED_EXECUTORS, delay_ms, callback, cb_arg);
+    // Ignore queueing if it's a zero-time delay, or the callback is not valid
+    if (delay_ms == 0 || !callback) {
+        return INVALID_DEFERRED_TOKEN;
+    }
+
+    // Claim a free slot, if any
+    executor_index_t slot;
+    if (free_count > 0) {
+        slot = free_slots[--free_count];
+    } else if (fresh_slots < MAX_DEFERRED_EXECUTORS) {
+        slot = fresh_slots++;
+    } else {
+        return INVALID_DEFERRED_TOKEN;
+    }
+
+    // Tokens of a slot step through slot + 1 + k * MAX_DEFERRED_EXECUTORS, so recently used tokens aren't handed out again
+    deferred_executor_t *entry = &basic_executors[slot];
+    uint32_t             token = entry->token + MAX_DEFERRED_EXECUTORS;
+    if (entry->token == INVALID_DEFERRED_TOKEN || token > DEFERRED_TOKEN_MAX) {
+        token = slot + 1;
+    }
+
+    entry->token        = token;
+    entry->trigger_time = timer_read32() + delay_ms;
+    entry->callback     = callback;
+    entry->cb_arg       = cb_arg;
+    heap_push(slot);
+    return token;
 }
+
 bool extend_deferred_exec(deferred_token token, uint32_t delay_ms) {
-    return extend_deferred_exec_advanced(basic_executors, MAX_DEFERRED_EXECUTORS, token, delay_ms);
+    deferred_executor_t *entry = basic_executor_find(token);
+    if (!entry || delay_ms == 0) {
+        return false;
+    }
+
+    entry->trigger_time = timer_read32() + delay_ms;
+    executor_index_t slot = entry - basic_executors;
+    if (heap_pos[slot] < heap_size) {
+        heap_update(heap_pos[slot]);
+    }
+    return true;
 }
+
 bool cancel_deferred_exec(deferred_token token) {
-    return cancel_deferred_exec_advanced(basic_executors, MAX_DEFERRED_EXECUTORS, token);
+    deferred_executor_t *entry = basic_executor_find(token);
+    if (!entry) {
+        return false;
+    }
+
+    executor_index_t slot = entry - basic_executors;
+    if (heap_pos[slot] < heap_size) {
+        heap_remove(slot);
+    } else {
+        heap_pos[slot] = EXECUTOR_NOT_QUEUED;
+    }
+    basic_executor_free(slot);
+    return true;
 }
+
+bool deferred_exec_next_trigger_time(uint32_t *trigger_time) {
+    if (heap_size == 0) {
+        return false;
+    }
+    *trigger_time = basic_executors[heap[0]].trigger_time;
+    return true;
+}
+
 void deferred_exec_task(void) {
-    deferred_exec_advanced_task(basic_executors, MAX_DEFERRED_EXECUTORS, &last_deferred_exec_check);
+    uint32_t now = timer_read32();
+
+    // Throttle only once per millisecond
+    if (((int32_t)TIMER_DIFF_32(now, last_deferred_exec_check)) <= 0) {
+        return;
+    }
+    last_deferred_exec_check = now;
+
+    // Run the due executors, earliest first. Each of them runs at most once per pass, executors that are still due
+    // after being re-queued are put back into the heap once the pass is done.
+    executor_index_t requeued_count = 0;
+    while (heap_size > 0 && ((int32_t)TIMER_DIFF_32(basic_executors[heap[0]].trigger_time, now)) <= 0) {
+        executor_index_t     slot       = heap[0];
+        deferred_executor_t *entry      = &basic_executors[slot];
+        deferred_token       curr_token = entry->token;
+
+        // Invoke the callback and work out if we should be requeued
+        uint32_t delay_ms = entry->callback(entry->trigger_time, entry->cb_arg);
+
+        // If the executor is gone or the token has changed, then the callback has canceled and maybe re-queued. Skip further processing.
+        if (!entry->callback || entry->token != curr_token) {
+            continue;
+        }
+
+        if (delay_ms > 0) {
+            // As with the advanced API, the next invocation is with respect to the previous trigger.
+            entry->trigger_time += delay_ms;
+            if (((int32_t)TIMER_DIFF_32(entry->trigger_time, now)) <= 0) {
+                heap_remove(slot);
+                heap_pos[slot]              = EXECUTOR_REQUEUED;
+                requeued[requeued_count++] = slot;
+            } else {
+                heap_update(heap_pos[slot]);
+            }
+        } else {
+            // If it was zero, then the callback is cancelling repeated execution. Free up the slot.
+            heap_remove(slot);
+            basic_executor_free(slot);
+        }
+    }
+
+    while (requeued_count > 0) {
+        executor_index_t slot = requeued[--requeued_count];
+        if (heap_pos[slot] == EXECUTOR_REQUEUED) {
+            heap_push(slot);
+        }
+    }
 }
@@ -13,8 +13,13 @@
 
 /**
  * @typedef A token that can be used to cancel or extend an existing deferred execution.
+ * @brief Widened to 16 bits when MAX_DEFERRED_EXECUTORS is large enough that 8-bit tokens would run out.
  */
+#if defined(MAX_DEFERRED_EXECUTORS) && MAX_DEFERRED_EXECUTORS > 127
+typedef uint16_t deferred_token;
+#else
 typedef uint8_t deferred_token;
+#endif
 
 /**
  * @def The constant used to denote an invalid deferred execution token.
@@ -60,6 +65,14 @@ bool extend_deferred_exec(deferred_token token, uint32_t delay_ms);
  */
 bool cancel_deferred_exec(deferred_token token);
 
+/**
+ * Retrieves the trigger time of the earliest pending deferred execution, in constant time.
+ *
+ * @param trigger_time[out] the trigger time of the earliest deferred execution -- equivalent time-space as timer_read32()
+ * @return true if any deferred execution is pending, otherwise false
+ */
+bool deferred_exec_next_trigger_time(uint32_t *trigger_time);
+
 /**
  * Forward declaration for the main loop in order to execute any deferred executors. Should not be invoked by keyboard/user code.
  */
@@ -18,7 +18,9 @@
 #include "dynamic_keymap.h"
 #include "keymap_introspection.h"
 #include "action.h"
+#include "action_layer.h"
 #include "send_string.h"
+#include "debug.h"
 #include "keycodes.h"
 #include "nvm_dynamic_keymap.h"
 
@@ -42,6 +44,9 @@ uint16_t dynamic_keymap_get_keycode(uint8_t layer, uint8_t row, uint8_t column)
 
 void dynamic_keymap_set_keycode(uint8_t layer, uint8_t row, uint8_t column, uint16_t keycode) {
     nvm_dynamic_keymap_update_keycode(layer, row, column, keycode);
+#if !defined(NO_ACTION_LAYER) && defined(LAYER_RESOLUTION_CACHE)
+    layer_resolution_cache_clear();
+#endif
 }
 
 #ifdef ENCODER_MAP_ENABLE
@@ -80,6 +85,9 @@ void dynamic_keymap_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
 
 void dynamic_keymap_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
     nvm_dynamic_keymap_update_buffer(offset, size, data);
+#if !defined(NO_ACTION_LAYER) && defined(LAYER_RESOLUTION_CACHE)
+    layer_resolution_cache_clear();
+#endif
 }
 
 uint16_t keycode_at_keymap_location(uint8_t layer_num, uint8_t row, uint8_t column) {
@@ -120,13 +128,9 @@ static uint8_t dynamic_keymap_read_byte(uint32_t offset) {
     return d;
 }
 
-typedef struct send_string_nvm_state_t {
-    uint32_t offset;
-} send_string_nvm_state_t;
-
 char send_string_get_next_nvm(void *arg) {
-    send_string_nvm_state_t *state = (send_string_nvm_state_t *)arg;
-    char                     ret   = dynamic_keymap_read_byte(state->offset);
+    send_string_state_t *state = (send_string_state_t *)arg;
+    char                 ret   = dynamic_keymap_read_byte(state->offset);
     state->offset++;
     return ret;
 }
@@ -137,9 +141,9 @@ void dynamic_keymap_macro_reset(void) {
     nvm_dynamic_keymap_macro_reset();
 }
 
-void dynamic_keymap_macro_send(uint8_t id) {
+bool dynamic_keymap_macro_send(uint8_t id) {
     if (id >= DYNAMIC_KEYMAP_MACRO_COUNT) {
-        return;
+        return false;
     }
 
     // Check the last byte of the buffer.
@@ -147,7 +151,7 @@ void dynamic_keymap_macro_send(uint8_t id) {
     // of buffer writing, possibly an aborted buffer
     // write. So do nothing.
     if (dynamic_keymap_read_byte(nvm_dynamic_keymap_macro_size() - 1) != 0) {
-        return;
+        return false;
     }
 
     // Skip N null characters
@@ -158,7 +162,7 @@ void dynamic_keymap_macro_send(uint8_t id) {
         // If we are past the end of the buffer, then there is
         // no Nth macro in the buffer.
         if (offset == end) {
-            return;
+            return false;
         }
         if (dynamic_keymap_read_byte(offset) == 0) {
             --id;
@@ -166,6 +170,15 @@ void dynamic_keymap_macro_send(uint8_t id) {
         ++offset;
     }
 
-    send_string_nvm_state_t state = {.offset = offset};
+    send_string_state_t state = {.offset = offset};
+#ifdef SEND_STRING_ASYNC_ENABLE
+    if (!send_string_with_delay_impl_async(send_string_get_next_nvm, &state, DYNAMIC_KEYMAP_MACRO_DELAY, NULL, NULL)) {
+        // Waiting for room would stall the main loop, which the queue is there to avoid
+        dprintf("dynamic_keymap_macro_send: queue full, macro %u dropped\n", id);
+        return false;
+    }
+#else
     send_string_with_delay_impl(send_string_get_next_nvm, &state, DYNAMIC_KEYMAP_MACRO_DELAY);
+#endif
+    return true;
 }
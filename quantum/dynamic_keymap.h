@@ -74,4 +74,6 @@ void     dynamic_keymap_macro_get_buffer(uint16_t offset, uint16_t size, uint8_t
 void     dynamic_keymap_macro_set_buffer(uint16_t offset, uint16_t size, uint8_t *data);
 void     dynamic_keymap_macro_reset(void);
 
-void dynamic_keymap_macro_send(uint8_t id);
+// Types out macro `id`, or queues it with SEND_STRING_ASYNC_ENABLE.
+// Returns false if there is no such macro, or if the queue is full.
+bool dynamic_keymap_macro_send(uint8_t id);
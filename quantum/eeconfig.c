@@ -39,6 +39,10 @@
 #    include "connection.h"
 #endif // CONNECTION_ENABLE
 
+#ifdef DYNAMIC_MACRO_ENABLE
+#    include "nvm_dynamic_macro.h"
+#endif // DYNAMIC_MACRO_ENABLE
+
 #ifdef VIA_ENABLE
 bool via_eeprom_is_valid(void);
 void via_eeprom_set_valid(bool valid);
@@ -140,6 +144,15 @@ void eeconfig_init_quantum(void) {
     eeconfig_update_connection_default();
 #endif // CONNECTION_ENABLE
 
+#ifdef SLIDER_ENABLE
+    extern void eeconfig_update_slider_default(void);
+    eeconfig_update_slider_default();
+#endif // SLIDER_ENABLE
+
+#ifdef DYNAMIC_MACRO_ENABLE
+    nvm_dynamic_macro_erase();
+#endif // DYNAMIC_MACRO_ENABLE
+
 #if (EECONFIG_KB_DATA_SIZE) > 0
     eeconfig_init_kb_datablock();
 #endif // (EECONFIG_KB_DATA_SIZE) > 0
@@ -321,6 +334,15 @@ void eeconfig_update_connection(const connection_config_t *config) {
 }
 #endif // CONNECTION_ENABLE
 
+#ifdef SLIDER_ENABLE
+void eeconfig_read_slider_calibration(uint8_t index, slider_calibration_t *calibration) {
+    nvm_eeconfig_read_slider_calibration(index, calibration);
+}
+void eeconfig_update_slider_calibration(uint8_t index, const slider_calibration_t *calibration) {
+    nvm_eeconfig_update_slider_calibration(index, calibration);
+}
+#endif // SLIDER_ENABLE
+
 bool eeconfig_read_handedness(void) {
     return nvm_eeconfig_read_handedness();
 }
@@ -137,6 +137,12 @@ void                              eeconfig_read_connection(connection_config_t *
 void                              eeconfig_update_connection(const connection_config_t *config);
 #endif
 
+#ifdef SLIDER_ENABLE
+typedef struct slider_calibration_t slider_calibration_t;
+void                                eeconfig_read_slider_calibration(uint8_t index, slider_calibration_t *calibration) __attribute__((nonnull));
+void                                eeconfig_update_slider_calibration(uint8_t index, const slider_calibration_t *calibration) __attribute__((nonnull));
+#endif
+
 bool eeconfig_read_handedness(void);
 void eeconfig_update_handedness(bool val);
 
@@ -32,6 +32,8 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "sendchar.h"
 #include "eeconfig.h"
 #include "action_layer.h"
+#include "task_deadline.h"
+#include "task_profile.h"
 #ifdef BOOTMAGIC_ENABLE
 #    include "bootmagic.h"
 #endif
@@ -107,6 +109,18 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef DIP_SWITCH_ENABLE
 #    include "dip_switch.h"
 #endif
+#ifdef SLIDER_ENABLE
+#    include "slider.h"
+#endif
+#ifdef SLIDER_MIDI_ENABLE
+#    include "slider_midi.h"
+#endif
+#ifdef SEND_STRING_ASYNC_ENABLE
+#    include "send_string.h"
+#endif
+#ifdef DYNAMIC_MACRO_ENABLE
+#    include "process_dynamic_macro.h"
+#endif
 #ifdef EEPROM_DRIVER
 #    include "eeprom_driver.h"
 #endif
@@ -419,6 +433,9 @@ __attribute__((weak)) void housekeeping_task_user(void) {}
  * Invokes hooks for executing code after QMK is done after each loop iteration.
  */
 void housekeeping_task(void) {
+#ifdef EEPROM_DRIVER
+    eeprom_driver_task();
+#endif
     housekeeping_task_modules();
     housekeeping_task_kb();
     housekeeping_task_user();
@@ -516,6 +533,15 @@ void keyboard_init(void) {
 #ifdef DIP_SWITCH_ENABLE
     dip_switch_init();
 #endif
+#ifdef SLIDER_ENABLE
+    slider_init();
+#endif
+#ifdef SLIDER_MIDI_ENABLE
+    slider_midi_init();
+#endif
+#ifdef DYNAMIC_MACRO_ENABLE
+    dynamic_macro_init();
+#endif
 #ifdef JOYSTICK_ENABLE
     joystick_init();
 #endif
@@ -649,105 +675,153 @@ void quantum_task(void) {
 #endif
 
 #ifdef AUDIO_ENABLE
-    audio_task();
+    TASK_PROFILE_CALL(TASK_PROFILE_AUDIO, audio_task());
 #endif
 
 #if defined(AUDIO_ENABLE) && !defined(NO_MUSIC_MODE)
-    music_task();
+    TASK_PROFILE_CALL(TASK_PROFILE_MUSIC, music_task());
 #endif
 
 #ifdef KEY_OVERRIDE_ENABLE
-    key_override_task();
+    if (task_deadline_due(TASK_DEADLINE_KEY_OVERRIDE)) {
+        TASK_PROFILE_CALL(TASK_PROFILE_KEY_OVERRIDE, key_override_task());
+    }
 #endif
 
 #ifdef SEQUENCER_ENABLE
-    sequencer_task();
+    TASK_PROFILE_CALL(TASK_PROFILE_SEQUENCER, sequencer_task());
 #endif
 
 #ifdef TAP_DANCE_ENABLE
-    tap_dance_task();
+    if (task_deadline_due(TASK_DEADLINE_TAP_DANCE)) {
+        TASK_PROFILE_CALL(TASK_PROFILE_TAP_DANCE, tap_dance_task());
+    }
 #endif
 
 #ifdef COMBO_ENABLE
-    combo_task();
+    if (task_deadline_due(TASK_DEADLINE_COMBO)) {
+        TASK_PROFILE_CALL(TASK_PROFILE_COMBO, combo_task());
+    }
 #endif
 
 #ifdef LEADER_ENABLE
-    leader_task();
+    if (task_deadline_due(TASK_DEADLINE_LEADER)) {
+        TASK_PROFILE_CALL(TASK_PROFILE_LEADER, leader_task());
+    }
 #endif
 
 #ifdef WPM_ENABLE
-    decay_wpm();
+    if (task_deadline_due(TASK_DEADLINE_WPM)) {
+        TASK_PROFILE_CALL(TASK_PROFILE_WPM, decay_wpm());
+    }
 #endif
 
 #ifdef DIP_SWITCH_ENABLE
-    dip_switch_task();
+    TASK_PROFILE_CALL(TASK_PROFILE_DIP_SWITCH, dip_switch_task());
+#endif
+
+#ifdef SLIDER_ENABLE
+    if (task_deadline_due(TASK_DEADLINE_SLIDER)) {
+        TASK_PROFILE_CALL(TASK_PROFILE_SLIDER, slider_task());
+    }
+#endif
+
+#ifdef SLIDER_MIDI_ENABLE
+    if (task_deadline_due(TASK_DEADLINE_SLIDER_MIDI)) {
+        TASK_PROFILE_CALL(TASK_PROFILE_SLIDER_MIDI, slider_midi_task());
+    }
 #endif
 
 #ifdef AUTO_SHIFT_ENABLE
-    autoshift_matrix_scan();
+    if (task_deadline_due(TASK_DEADLINE_AUTO_SHIFT)) {
+        TASK_PROFILE_CALL(TASK_PROFILE_AUTO_SHIFT, autoshift_matrix_scan());
+    }
 #endif
 
 #ifdef CAPS_WORD_ENABLE
-    caps_word_task();
+    if (task_deadline_due(TASK_DEADLINE_CAPS_WORD)) {
+        TASK_PROFILE_CALL(TASK_PROFILE_CAPS_WORD, caps_word_task());
+    }
 #endif
 
 #ifdef SECURE_ENABLE
-    secure_task();
+    if (task_deadline_due(TASK_DEADLINE_SECURE)) {
+        TASK_PROFILE_CALL(TASK_PROFILE_SECURE, secure_task());
+    }
 #endif
 
 #ifdef LAYER_LOCK_ENABLE
-    layer_lock_task();
+    if (task_deadline_due(TASK_DEADLINE_LAYER_LOCK)) {
+        TASK_PROFILE_CALL(TASK_PROFILE_LAYER_LOCK, layer_lock_task());
+    }
+#endif
+
+#ifdef SEND_STRING_ASYNC_ENABLE
+    if (task_deadline_due(TASK_DEADLINE_SEND_STRING)) {
+        TASK_PROFILE_CALL(TASK_PROFILE_SEND_STRING, send_string_task());
+    }
+#endif
+
+#ifdef DYNAMIC_MACRO_ENABLE
+    if (task_deadline_due(TASK_DEADLINE_DYNAMIC_MACRO)) {
+        TASK_PROFILE_CALL(TASK_PROFILE_DYNAMIC_MACRO, dynamic_macro_task());
+    }
 #endif
 }
 
 /** \brief Main task that is repeatedly called as fast as possible. */
 void keyboard_task(void) {
     __attribute__((unused)) bool activity_has_occurred = false;
-    if (matrix_task()) {
+    bool                         matrix_changed;
+    TASK_PROFILE_CALL(TASK_PROFILE_MATRIX, matrix_changed = matrix_task());
+    if (matrix_changed) {
         last_matrix_activity_trigger();
         activity_has_occurred = true;
     }
 
-    quantum_task();
+    TASK_PROFILE_CALL(TASK_PROFILE_QUANTUM, quantum_task());
 
 #if defined(SPLIT_WATCHDOG_ENABLE)
-    split_watchdog_task();
+    TASK_PROFILE_CALL(TASK_PROFILE_SPLIT_WATCHDOG, split_watchdog_task());
 #endif
 
 #if defined(RGBLIGHT_ENABLE)
-    rgblight_task();
+    TASK_PROFILE_CALL(TASK_PROFILE_RGBLIGHT, rgblight_task());
 #endif
 
 #ifdef LED_MATRIX_ENABLE
-    led_matrix_task();
+    TASK_PROFILE_CALL(TASK_PROFILE_LED_MATRIX, led_matrix_task());
 #endif
 #ifdef RGB_MATRIX_ENABLE
-    rgb_matrix_task();
+    TASK_PROFILE_CALL(TASK_PROFILE_RGB_MATRIX, rgb_matrix_task());
 #endif
 
 #if defined(BACKLIGHT_ENABLE)
 #    if defined(BACKLIGHT_PIN) || defined(BACKLIGHT_PINS)
-    backlight_task();
+    TASK_PROFILE_CALL(TASK_PROFILE_BACKLIGHT, backlight_task());
 #    endif
 #endif
 
 #ifdef ENCODER_ENABLE
-    if (encoder_task()) {
+    bool encoder_changed;
+    TASK_PROFILE_CALL(TASK_PROFILE_ENCODER, encoder_changed = encoder_task());
+    if (encoder_changed) {
         last_encoder_activity_trigger();
         activity_has_occurred = true;
     }
 #endif
 
 #ifdef POINTING_DEVICE_ENABLE
-    if (pointing_device_task()) {
+    bool pointing_device_changed;
+    TASK_PROFILE_CALL(TASK_PROFILE_POINTING_DEVICE, pointing_device_changed = pointing_device_task());
+    if (pointing_device_changed) {
         last_pointing_device_activity_trigger();
         activity_has_occurred = true;
     }
 #endif
 
 #ifdef OLED_ENABLE
-    oled_task();
+    TASK_PROFILE_CALL(TASK_PROFILE_OLED, oled_task());
 #    if OLED_TIMEOUT > 0
     // Wake up oled if user is using those fabulous keys or spinning those encoders!
     if (activity_has_occurred) oled_on();
@@ -755,7 +829,7 @@ void keyboard_task(void) {
 #endif
 
 #ifdef ST7565_ENABLE
-    st7565_task();
+    TASK_PROFILE_CALL(TASK_PROFILE_ST7565, st7565_task());
 #    if ST7565_TIMEOUT > 0
     // Wake up display if user is using those fabulous keys or spinning those encoders!
     if (activity_has_occurred) st7565_on();
@@ -764,36 +838,43 @@ void keyboard_task(void) {
 
 #ifdef MOUSEKEY_ENABLE
     // mousekey repeat & acceleration
-    mousekey_task();
+    TASK_PROFILE_CALL(TASK_PROFILE_MOUSEKEY, mousekey_task());
 #endif
 
 #ifdef PS2_MOUSE_ENABLE
-    ps2_mouse_task();
+    TASK_PROFILE_CALL(TASK_PROFILE_PS2_MOUSE, ps2_mouse_task());
 #endif
 
 #ifdef MIDI_ENABLE
-    midi_task();
+    TASK_PROFILE_CALL(TASK_PROFILE_MIDI, midi_task());
 #endif
 
 #ifdef JOYSTICK_ENABLE
-    joystick_task();
+    TASK_PROFILE_CALL(TASK_PROFILE_JOYSTICK, joystick_task());
 #endif
 
 #ifdef BATTERY_ENABLE
-    battery_task();
+    TASK_PROFILE_CALL(TASK_PROFILE_BATTERY, battery_task());
 #endif
 
 #ifdef BLUETOOTH_ENABLE
-    bluetooth_task();
+    TASK_PROFILE_CALL(TASK_PROFILE_BLUETOOTH, bluetooth_task());
 #endif
 
 #ifdef HAPTIC_ENABLE
-    haptic_task();
+    TASK_PROFILE_CALL(TASK_PROFILE_HAPTIC, haptic_task());
 #endif
 
-    led_task();
+    TASK_PROFILE_CALL(TASK_PROFILE_LED, led_task());
 
 #ifdef OS_DETECTION_ENABLE
-    os_detection_task();
+    TASK_PROFILE_CALL(TASK_PROFILE_OS_DETECTION, os_detection_task());
+#endif
+
+#ifdef HOST_REPORT_QUEUE_ENABLE
+    // Send the reports the driver was not ready for
+    TASK_PROFILE_CALL(TASK_PROFILE_HOST_REPORT_QUEUE, host_report_queue_task());
 #endif
+
+    task_profile_task();
 }
@@ -37,6 +37,9 @@ typedef int_fast8_t index_t;
  * this table must be at most 7 chars long and have an underscore '_' for the
  * third char. This underscore is assumed and not actually stored.
  *
+ * Entries are sorted by keycode so that they can be binary searched. Keep that
+ * order when adding a name, also across the feature ifdefs.
+ *
  * To save memory, feature-specific key entries are ifdef'd to include them only
  * when their feature is enabled.
  */
@@ -73,70 +76,70 @@ static const uint16_t common_names[] PROGMEM = {
     KC_DOWN, KEYCODE_NAME7('K', 'C', '_', 'D', 'O', 'W', 'N'),
     KC_UP  , KEYCODE_NAME7('K', 'C', '_', 'U', 'P',  0 ,  0 ),
     KC_NUBS, KEYCODE_NAME7('K', 'C', '_', 'N', 'U', 'B', 'S'),
-    KC_HYPR, KEYCODE_NAME7('K', 'C', '_', 'H', 'Y', 'P', 'R'),
-    KC_MEH , KEYCODE_NAME7('K', 'C', '_', 'M', 'E', 'H',  0 ),
 #ifdef EXTRAKEY_ENABLE
+    KC_MUTE, KEYCODE_NAME7('K', 'C', '_', 'M', 'U', 'T', 'E'),
+    KC_VOLU, KEYCODE_NAME7('K', 'C', '_', 'V', 'O', 'L', 'U'),
+    KC_VOLD, KEYCODE_NAME7('K', 'C', '_', 'V', 'O', 'L', 'D'),
+    KC_MNXT, KEYCODE_NAME7('K', 'C', '_', 'M', 'N', 'X', 'T'),
+    KC_MPRV, KEYCODE_NAME7('K', 'C', '_', 'M', 'P', 'R', 'V'),
+    KC_MPLY, KEYCODE_NAME7('K', 'C', '_', 'M', 'P', 'L', 'Y'),
     KC_WHOM, KEYCODE_NAME7('K', 'C', '_', 'W', 'H', 'O', 'M'),
     KC_WBAK, KEYCODE_NAME7('K', 'C', '_', 'W', 'B', 'A', 'K'),
     KC_WFWD, KEYCODE_NAME7('K', 'C', '_', 'W', 'F', 'W', 'D'),
     KC_WSTP, KEYCODE_NAME7('K', 'C', '_', 'W', 'S', 'T', 'P'),
     KC_WREF, KEYCODE_NAME7('K', 'C', '_', 'W', 'R', 'E', 'F'),
-    KC_MNXT, KEYCODE_NAME7('K', 'C', '_', 'M', 'N', 'X', 'T'),
-    KC_MPRV, KEYCODE_NAME7('K', 'C', '_', 'M', 'P', 'R', 'V'),
-    KC_MPLY, KEYCODE_NAME7('K', 'C', '_', 'M', 'P', 'L', 'Y'),
-    KC_MUTE, KEYCODE_NAME7('K', 'C', '_', 'M', 'U', 'T', 'E'),
-    KC_VOLU, KEYCODE_NAME7('K', 'C', '_', 'V', 'O', 'L', 'U'),
-    KC_VOLD, KEYCODE_NAME7('K', 'C', '_', 'V', 'O', 'L', 'D'),
 #endif // EXTRAKEY_ENABLE
 #ifdef MOUSEKEY_ENABLE
-    MS_LEFT, KEYCODE_NAME7('M', 'S', '_', 'L', 'E', 'F', 'T'),
-    MS_RGHT, KEYCODE_NAME7('M', 'S', '_', 'R', 'G', 'H', 'T'),
     MS_UP  , KEYCODE_NAME7('M', 'S', '_', 'U', 'P',  0 ,  0 ),
     MS_DOWN, KEYCODE_NAME7('M', 'S', '_', 'D', 'O', 'W', 'N'),
-    MS_WHLL, KEYCODE_NAME7('M', 'S', '_', 'W', 'H', 'L', 'L'),
-    MS_WHLR, KEYCODE_NAME7('M', 'S', '_', 'W', 'H', 'L', 'R'),
+    MS_LEFT, KEYCODE_NAME7('M', 'S', '_', 'L', 'E', 'F', 'T'),
+    MS_RGHT, KEYCODE_NAME7('M', 'S', '_', 'R', 'G', 'H', 'T'),
     MS_WHLU, KEYCODE_NAME7('M', 'S', '_', 'W', 'H', 'L', 'U'),
     MS_WHLD, KEYCODE_NAME7('M', 'S', '_', 'W', 'H', 'L', 'D'),
+    MS_WHLL, KEYCODE_NAME7('M', 'S', '_', 'W', 'H', 'L', 'L'),
+    MS_WHLR, KEYCODE_NAME7('M', 'S', '_', 'W', 'H', 'L', 'R'),
 #endif // MOUSEKEY_ENABLE
+    KC_MEH , KEYCODE_NAME7('K', 'C', '_', 'M', 'E', 'H',  0 ),
+    KC_HYPR, KEYCODE_NAME7('K', 'C', '_', 'H', 'Y', 'P', 'R'),
 #ifdef SWAP_HANDS_ENABLE
-    SH_ON  , KEYCODE_NAME7('S', 'H', '_', 'O', 'N',  0 ,  0 ),
-    SH_OFF , KEYCODE_NAME7('S', 'H', '_', 'O', 'F', 'F',  0 ),
-    SH_MON , KEYCODE_NAME7('S', 'H', '_', 'M', 'O', 'N',  0 ),
-    SH_MOFF, KEYCODE_NAME7('S', 'H', '_', 'M', 'O', 'F', 'F'),
     SH_TOGG, KEYCODE_NAME7('S', 'H', '_', 'T', 'O', 'G', 'G'),
     SH_TT  , KEYCODE_NAME7('S', 'H', '_', 'T', 'T',  0 ,  0 ),
+    SH_MON , KEYCODE_NAME7('S', 'H', '_', 'M', 'O', 'N',  0 ),
+    SH_MOFF, KEYCODE_NAME7('S', 'H', '_', 'M', 'O', 'F', 'F'),
+    SH_OFF , KEYCODE_NAME7('S', 'H', '_', 'O', 'F', 'F',  0 ),
+    SH_ON  , KEYCODE_NAME7('S', 'H', '_', 'O', 'N',  0 ,  0 ),
 #    if !defined(NO_ACTION_ONESHOT)
     SH_OS  , KEYCODE_NAME7('S', 'H', '_', 'O', 'S',  0 ,  0 ),
 #    endif // !defined(NO_ACTION_ONESHOT)
 #endif // SWAP_HANDS_ENABLE
+    QK_BOOT, KEYCODE_NAME7('Q', 'K', '_', 'B', 'O', 'O', 'T'),
+    DB_TOGG, KEYCODE_NAME7('D', 'B', '_', 'T', 'O', 'G', 'G'),
+    EE_CLR , KEYCODE_NAME7('E', 'E', '_', 'C', 'L', 'R',  0 ),
+#ifdef GRAVE_ESC_ENABLE
+    QK_GESC, KEYCODE_NAME7('Q', 'K', '_', 'G', 'E', 'S', 'C'),
+#endif // GRAVE_ESC_ENABLE
 #ifdef LEADER_ENABLE
     QK_LEAD, KEYCODE_NAME7('Q', 'K', '_', 'L', 'E', 'A', 'D'),
 #endif // LEADER_ENABLE
 #ifdef KEY_LOCK_ENABLE
     QK_LOCK, KEYCODE_NAME7('Q', 'K', '_', 'L', 'O', 'C', 'K'),
 #endif // KEY_LOCK_ENABLE
-#ifdef TRI_LAYER_ENABLE
-    TL_LOWR, KEYCODE_NAME7('T', 'L', '_', 'L', 'O', 'W', 'R'),
-    TL_UPPR, KEYCODE_NAME7('T', 'L', '_', 'U', 'P', 'P', 'R'),
-#endif // TRI_LAYER_ENABLE
-#ifdef GRAVE_ESC_ENABLE
-    QK_GESC, KEYCODE_NAME7('Q', 'K', '_', 'G', 'E', 'S', 'C'),
-#endif // GRAVE_ESC_ENABLE
-#ifdef CAPS_WORD_ENABLE
-    CW_TOGG, KEYCODE_NAME7('C', 'W', '_', 'T', 'O', 'G', 'G'),
-#endif // CAPS_WORD_ENABLE
 #ifdef SECURE_ENABLE
     SE_LOCK, KEYCODE_NAME7('S', 'E', '_', 'L', 'O', 'C', 'K'),
     SE_UNLK, KEYCODE_NAME7('S', 'E', '_', 'U', 'N', 'L', 'K'),
     SE_TOGG, KEYCODE_NAME7('S', 'E', '_', 'T', 'O', 'G', 'G'),
     SE_REQ , KEYCODE_NAME7('S', 'E', '_', 'R', 'E', 'Q',  0 ),
 #endif // SECURE_ENABLE
+#ifdef CAPS_WORD_ENABLE
+    CW_TOGG, KEYCODE_NAME7('C', 'W', '_', 'T', 'O', 'G', 'G'),
+#endif // CAPS_WORD_ENABLE
+#ifdef TRI_LAYER_ENABLE
+    TL_LOWR, KEYCODE_NAME7('T', 'L', '_', 'L', 'O', 'W', 'R'),
+    TL_UPPR, KEYCODE_NAME7('T', 'L', '_', 'U', 'P', 'P', 'R'),
+#endif // TRI_LAYER_ENABLE
 #ifdef LAYER_LOCK_ENABLE
     QK_LLCK, KEYCODE_NAME7('Q', 'K', '_', 'L', 'L', 'C', 'K'),
 #endif // LAYER_LOCK_ENABLE
-    EE_CLR , KEYCODE_NAME7('E', 'E', '_', 'C', 'L', 'R',  0 ),
-    QK_BOOT, KEYCODE_NAME7('Q', 'K', '_', 'B', 'O', 'O', 'T'),
-    DB_TOGG, KEYCODE_NAME7('D', 'B', '_', 'T', 'O', 'G', 'G'),
 };
 // clang-format on
 
@@ -153,24 +156,46 @@ static char buffer[32];
 #define BUFFER_MAX_LEN (sizeof(buffer) - 1)
 static index_t buffer_len;
 
-/** Finds the name of a keycode in `common_names` or returns NULL. */
-static const char* search_common_names(uint16_t keycode) {
+/** Number of (keycode, name) entries in `common_names`. */
+#define COMMON_NAMES_COUNT (ARRAY_SIZE(common_names) / 4)
+
+/** Whether the user and kb tables are sorted by keycode: 0 until checked, then 1 if sorted or -1 if not. */
+static int8_t names_user_sorted;
+static int8_t names_kb_sorted;
+
+/** Unpacks the name of the `index`th entry of `common_names`. */
+static const char* common_name(int_fast16_t index) {
     static uint8_t buffer[8];
 
-    for (int_fast16_t offset = 0; offset < ARRAY_SIZE(common_names); offset += 4) {
-        if (keycode == pgm_read_word(common_names + offset)) {
-            const uint16_t w0 = pgm_read_word(common_names + offset + 1);
-            const uint16_t w1 = pgm_read_word(common_names + offset + 2);
-            const uint16_t w2 = pgm_read_word(common_names + offset + 3);
-            buffer[0]         = (uint8_t)w0;
-            buffer[1]         = (uint8_t)(w0 >> 8);
-            buffer[2]         = '_';
-            buffer[3]         = (uint8_t)w1;
-            buffer[4]         = (uint8_t)(w1 >> 8);
-            buffer[5]         = (uint8_t)w2;
-            buffer[6]         = (uint8_t)(w2 >> 8);
-            buffer[7]         = 0;
-            return (const char*)buffer;
+    const uint16_t* entry = common_names + 4 * index;
+    const uint16_t  w0    = pgm_read_word(entry + 1);
+    const uint16_t  w1    = pgm_read_word(entry + 2);
+    const uint16_t  w2    = pgm_read_word(entry + 3);
+    buffer[0]             = (uint8_t)w0;
+    buffer[1]             = (uint8_t)(w0 >> 8);
+    buffer[2]             = '_';
+    buffer[3]             = (uint8_t)w1;
+    buffer[4]             = (uint8_t)(w1 >> 8);
+    buffer[5]             = (uint8_t)w2;
+    buffer[6]             = (uint8_t)(w2 >> 8);
+    buffer[7]             = 0;
+    return (const char*)buffer;
+}
+
+/** Finds the name of a keycode in `common_names` or returns NULL. */
+static const char* search_common_names(uint16_t keycode) {
+    int_fast16_t low  = 0;
+    int_fast16_t high = COMMON_NAMES_COUNT;
+
+    while (low < high) {
+        const int_fast16_t mid   = (low + high) / 2;
+        const uint16_t     entry = pgm_read_word(common_names + 4 * mid);
+        if (entry < keycode) {
+            low = mid + 1;
+        } else if (entry > keycode) {
+            high = mid;
+        } else {
+            return common_name(mid);
         }
     }
 
@@ -180,17 +205,49 @@ static const char* search_common_names(uint16_t keycode) {
 /**
  * @brief Finds the name of a keycode in table or returns NULL.
  *
+ * Tables sorted by keycode are binary searched, others are searched linearly.
+ * Whether the table is sorted is checked on its first search.
+ *
  * @param data   Pointer to table to be searched.
  * @param size   Numer of entries in the table.
+ * @param sorted Whether the table is sorted, 0 if not checked yet.
  * @return Name string for the keycode, or NULL if not found.
  */
-static const char* search_table(const keycode_string_name_t* data, uint16_t size, uint16_t keycode) {
-    if (data != NULL) {
+static const char* search_table(const keycode_string_name_t* data, uint16_t size, int8_t* sorted, uint16_t keycode) {
+    if (data == NULL) {
+        return NULL;
+    }
+
+    if (*sorted == 0) {
+        *sorted = 1;
+        for (uint16_t i = 1; i < size; ++i) {
+            if (data[i - 1].keycode >= data[i].keycode) {
+                *sorted = -1;
+                break;
+            }
+        }
+    }
+
+    if (*sorted < 0) {
         for (uint16_t i = 0; i < size; ++i) {
             if (data[i].keycode == keycode) {
                 return data[i].name;
             }
         }
+        return NULL;
+    }
+
+    uint16_t low  = 0;
+    uint16_t high = size;
+    while (low < high) {
+        const uint16_t mid = low + (high - low) / 2;
+        if (data[mid].keycode < keycode) {
+            low = mid + 1;
+        } else if (data[mid].keycode > keycode) {
+            high = mid;
+        } else {
+            return data[mid].name;
+        }
     }
     return NULL;
 }
@@ -289,12 +346,12 @@ static void append_numbered_keycode(const char* name, uint16_t number) {
 static void append_keycode(uint16_t keycode) {
     // In case there is overlap among tables, search `keycode_string_names_user`
     // first so that it takes precedence.
-    const char* keycode_name = search_table(keycode_string_names_data_user, keycode_string_names_size_user, keycode);
+    const char* keycode_name = search_table(keycode_string_names_data_user, keycode_string_names_size_user, &names_user_sorted, keycode);
     if (keycode_name) {
         append(keycode_name);
         return;
     }
-    keycode_name = search_table(keycode_string_names_data_kb, keycode_string_names_size_kb, keycode);
+    keycode_name = search_table(keycode_string_names_data_kb, keycode_string_names_size_kb, &names_kb_sorted, keycode);
     if (keycode_name) {
         append(keycode_name);
         return;
@@ -562,3 +619,380 @@ const char* get_keycode_string(uint16_t keycode) {
     append_keycode(keycode);
     return buffer;
 }
+
+/** Remaining input of parse_keycode_string(). */
+static const char* input;
+
+/** Whether the input is at the end of a keycode. */
+static bool at_end(void) {
+    return *input == '\0' || *input == ',' || *input == ')';
+}
+
+/** Consumes `c` if the input starts with it. */
+static bool accept_char(char c) {
+    if (*input != c) {
+        return false;
+    }
+    ++input;
+    return true;
+}
+
+/** Consumes `str`, a PROGMEM string, if the input starts with it. */
+static bool accept_P(const char* str) {
+    index_t i;
+    for (i = 0;; ++i) {
+        const char c = pgm_read_byte(&str[i]);
+        if (c == '\0') {
+            break;
+        }
+        if (input[i] != c) {
+            return false;
+        }
+    }
+    input += i;
+    return true;
+}
+
+/** Parses digits in `base`, either 10 or 16, into a number of at most `max`. */
+static bool parse_digits(int8_t base, uint16_t max, uint16_t* number) {
+    const char* start = input;
+    uint32_t    value = 0;
+    for (;; ++input) {
+        const char c = *input;
+        uint8_t    digit;
+        if ('0' <= c && c <= '9') {
+            digit = c - '0';
+        } else if (base == 16 && 'A' <= c && c <= 'F') {
+            digit = c - ('A' - 10);
+        } else if (base == 16 && 'a' <= c && c <= 'f') {
+            digit = c - ('a' - 10);
+        } else {
+            break;
+        }
+        value = value * base + digit;
+        if (value > max) {
+            return false;
+        }
+    }
+    *number = (uint16_t)value;
+    return input != start;
+}
+
+/** Parses a number of at most `max`, in hex if prefixed with "0x" or in decimal. */
+static bool parse_number(uint16_t max, uint16_t* number) {
+    return parse_digits(accept_P(PSTR("0x")) ? 16 : 10, max, number);
+}
+
+/** Parses one of the 4 mod names as its index in `mod_names`. */
+static bool parse_mod_name(uint8_t* index) {
+    for (uint8_t i = 0; i < 4; ++i) {
+        if (accept_P(&mod_names[4 * i])) {
+            *index = i;
+            return true;
+        }
+    }
+    return false;
+}
+
+/** Parses 5-bit mods, the inverse of append_5_bit_mods(). */
+static bool parse_5_bit_mods(uint8_t* mods) {
+    uint16_t number;
+    uint8_t  i;
+    if (accept_P(PSTR("MOD_"))) {
+        const bool is_rhs = accept_char('R');
+        if (!(is_rhs || accept_char('L')) || !parse_mod_name(&i)) {
+            return false;
+        }
+        *mods = (is_rhs ? 0x10 : 0) | (1 << i);
+        return true;
+    }
+    if (!parse_number(0x1F, &number)) {
+        return false;
+    }
+    *mods = (uint8_t)number;
+    return true;
+}
+
+/**
+ * @brief Parses `name` + `number` as `first` + `number` - `min`, the inverse of
+ * append_numbered_keycode().
+ * @note `name` is a PROGMEM string.
+ */
+static bool parse_numbered_keycode(const char* name, uint16_t first, uint16_t min, uint16_t max, uint16_t* keycode) {
+    const char* start = input;
+    uint16_t    number;
+    if (accept_P(name) && parse_digits(10, max, &number) && number >= min && at_end()) {
+        *keycode = first + (number - min);
+        return true;
+    }
+    input = start;
+    return false;
+}
+
+/** Finds the keycode named by the next `length` chars of the input in table. */
+static bool find_table_name(const keycode_string_name_t* data, uint16_t size, size_t length, uint16_t* keycode) {
+    if (data != NULL) {
+        for (uint16_t i = 0; i < size; ++i) {
+            if (strncmp(data[i].name, input, length) == 0 && data[i].name[length] == '\0') {
+                *keycode = data[i].keycode;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+/** Finds the keycode named by the next `length` chars of the input in `common_names`. */
+static bool find_common_name(size_t length, uint16_t* keycode) {
+    if (length < 3 || length > 7 || input[2] != '_') {
+        return false;
+    }
+
+    // Pack the name like KEYCODE_NAME7() does, to compare whole words.
+    char name[7] = {0};
+    memcpy(name, input, length);
+    const uint16_t w0 = ((uint16_t)name[0]) | (((uint16_t)name[1]) << 8);
+    const uint16_t w1 = ((uint16_t)name[3]) | (((uint16_t)name[4]) << 8);
+    const uint16_t w2 = ((uint16_t)name[5]) | (((uint16_t)name[6]) << 8);
+
+    for (int_fast16_t offset = 0; offset < ARRAY_SIZE(common_names); offset += 4) {
+        if (w0 == pgm_read_word(common_names + offset + 1) && w1 == pgm_read_word(common_names + offset + 2) && w2 == pgm_read_word(common_names + offset + 3)) {
+            *keycode = pgm_read_word(common_names + offset);
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool parse_keycode(uint16_t* keycode);
+
+/** Parses a keycode that must be a basic keycode. */
+static bool parse_basic_keycode(uint16_t* keycode) {
+    return parse_keycode(keycode) && *keycode <= 0xFF;
+}
+
+/** Parses a modified keycode, like S(KC_1) or RALT(KC_BSPC). */
+static bool parse_modified_keycode(uint16_t* keycode) {
+    const char* start = input;
+    uint16_t    basic;
+    uint8_t     mods = 0;
+    uint8_t     i;
+
+    if (accept_char('R') && parse_mod_name(&i)) {
+        mods = 0x10 | (1 << i);
+    } else {
+        input = start;
+        for (i = 0; i < 4; ++i) {
+            if (accept_char(pgm_read_byte(&mod_names[4 * i]))) {
+                mods = 1 << i;
+                break;
+            }
+        }
+    }
+    if (mods != 0 && accept_char('(') && parse_basic_keycode(&basic) && accept_char(')')) {
+        *keycode = (mods << 8) | basic;
+        return true;
+    }
+    input = start;
+    return false;
+}
+
+/** Parses the start of a mod-tap keycode, up to its tap keycode. */
+static bool parse_mod_tap_mods(uint8_t* mods) {
+    const char* start  = input;
+    const bool  is_rhs = accept_char('R');
+    uint16_t    number;
+    uint8_t     i;
+
+    if ((is_rhs || accept_char('L')) && parse_mod_name(&i) && accept_P(PSTR("_T("))) {
+        *mods = (is_rhs ? 0x10 : 0) | (1 << i);
+        return true;
+    }
+    input = start;
+    if (accept_P(PSTR("HYPR_T("))) {
+        *mods = MOD_HYPR;
+        return true;
+    }
+    if (accept_P(PSTR("MEH_T("))) {
+        *mods = MOD_MEH;
+        return true;
+    }
+    if (accept_P(PSTR("MT(")) && parse_number(0x1F, &number) && accept_char(',')) {
+        *mods = (uint8_t)number;
+        return true;
+    }
+    input = start;
+    return false;
+}
+
+/** Parses a keycode written with arguments, like LT(1,KC_A) or MO(2). */
+static bool parse_keycode_call(uint16_t* keycode) {
+    uint16_t number = 0;
+    uint16_t tap    = 0;
+    uint8_t  mods   = 0;
+    bool     ok;
+
+    if (parse_modified_keycode(keycode)) {
+        return true;
+    }
+
+    // clang-format off
+    if (parse_mod_tap_mods(&mods)) {
+        ok       = parse_basic_keycode(&tap);
+        *keycode = MT(mods, tap);
+#if !defined(NO_ACTION_ONESHOT)
+    } else if (accept_P(PSTR("OSM("))) {
+        ok       = parse_5_bit_mods(&mods);
+        *keycode = OSM(mods);
+    } else if (accept_P(PSTR("OSL("))) {
+        ok       = parse_number(31, &number);
+        *keycode = OSL(number);
+#endif // !defined(NO_ACTION_ONESHOT)
+    } else if (accept_P(PSTR("LT("))) {
+        ok       = parse_number(15, &number) && accept_char(',') && parse_basic_keycode(&tap);
+        *keycode = LT(number, tap);
+    } else if (accept_P(PSTR("LM("))) {
+        ok       = parse_number(15, &number) && accept_char(',') && parse_5_bit_mods(&mods);
+        *keycode = LM(number, mods);
+    } else if (accept_P(PSTR("TO("))) {
+        ok       = parse_number(31, &number);
+        *keycode = TO(number);
+    } else if (accept_P(PSTR("MO("))) {
+        ok       = parse_number(31, &number);
+        *keycode = MO(number);
+    } else if (accept_P(PSTR("DF("))) {
+        ok       = parse_number(31, &number);
+        *keycode = DF(number);
+    } else if (accept_P(PSTR("TG("))) {
+        ok       = parse_number(31, &number);
+        *keycode = TG(number);
+    } else if (accept_P(PSTR("TT("))) {
+        ok       = parse_number(31, &number);
+        *keycode = TT(number);
+    } else if (accept_P(PSTR("PDF("))) {
+        ok       = parse_number(31, &number);
+        *keycode = PDF(number);
+    } else if (accept_P(PSTR("TD("))) {
+        ok       = parse_number(0xFF, &number);
+        *keycode = TD(number);
+#ifdef UNICODE_ENABLE
+    } else if (accept_P(PSTR("UC("))) {
+        ok       = parse_number(0x7FFF, &number);
+        *keycode = UC(number);
+#elif defined(UNICODEMAP_ENABLE)
+    } else if (accept_P(PSTR("UM("))) {
+        ok       = parse_number(0x3FFF, &number);
+        *keycode = UM(number);
+    } else if (accept_P(PSTR("UP("))) {
+        ok       = parse_number(0x7F, &number) && accept_char(',') && parse_number(0x7F, &tap);
+        *keycode = UP(number, tap);
+#endif
+#ifdef SWAP_HANDS_ENABLE
+    } else if (accept_P(PSTR("SH_T("))) {
+        ok       = parse_basic_keycode(&tap);
+        *keycode = SH_T(tap);
+#endif // SWAP_HANDS_ENABLE
+    } else {
+        return false;
+    }
+    // clang-format on
+
+    return ok && accept_char(')');
+}
+
+/** Parses a keycode written as a plain name or number, like KC_A or QK_KB_2. */
+static bool parse_keycode_name(uint16_t* keycode) {
+    const char* start = input;
+    uint8_t     i;
+
+    if (accept_P(PSTR("KC_"))) {
+        // Modifiers KC_LSFT, KC_RCTL, etc.
+        const bool is_rhs = accept_char('R');
+        if ((is_rhs || accept_char('L')) && parse_mod_name(&i) && at_end()) {
+            *keycode = KC_LCTL + (is_rhs ? 4 : 0) + i;
+            return true;
+        }
+        // Letters A-Z.
+        input        = start + 3;
+        const char c = *input;
+        if ('A' <= c && c <= 'Z') {
+            ++input;
+            if (at_end()) {
+                *keycode = KC_A + (c - 'A');
+                return true;
+            }
+        }
+        input = start;
+    }
+
+    // clang-format off
+    if (parse_numbered_keycode(PSTR("KC_"), KC_1, 1, 9, keycode) ||
+        parse_numbered_keycode(PSTR("KC_"), KC_0, 0, 0, keycode) ||
+        parse_numbered_keycode(PSTR("KC_KP_"), KC_KP_1, 1, 9, keycode) ||
+        parse_numbered_keycode(PSTR("KC_KP_"), KC_KP_0, 0, 0, keycode) ||
+        parse_numbered_keycode(PSTR("KC_F"), KC_F1, 1, 12, keycode) ||
+        parse_numbered_keycode(PSTR("KC_F"), KC_F13, 13, 24, keycode) ||
+#ifdef MOUSEKEY_ENABLE
+        parse_numbered_keycode(PSTR("MS_BTN"), MS_BTN1, 1, 8, keycode) ||
+#endif // MOUSEKEY_ENABLE
+#ifdef JOYSTICK_ENABLE
+        parse_numbered_keycode(PSTR("JS_"), JS_0, 0, JS_31 - JS_0, keycode) ||
+#endif // JOYSTICK_ENABLE
+#ifdef PROGRAMMABLE_BUTTON_ENABLE
+        parse_numbered_keycode(PSTR("PB_"), PB_1, 1, 32, keycode) ||
+#endif // PROGRAMMABLE_BUTTON_ENABLE
+        parse_numbered_keycode(PSTR("MC_"), MC_0, 0, 31, keycode) ||
+        parse_numbered_keycode(PSTR("QK_KB_"), QK_KB_0, 0, 31, keycode) ||
+        parse_numbered_keycode(PSTR("QK_USER_"), QK_USER_0, 0, 31, keycode) ||
+#ifdef MAGIC_ENABLE
+        parse_numbered_keycode(PSTR("QK_MAGIC+"), QK_MAGIC, 0, QK_MAGIC_TOGGLE_ESCAPE_CAPS_LOCK - QK_MAGIC, keycode) ||
+#endif // MAGIC_ENABLE
+#ifdef MIDI_ENABLE
+        parse_numbered_keycode(PSTR("QK_MIDI+"), QK_MIDI, 0, QK_MIDI_PITCH_BEND_UP - QK_MIDI, keycode) ||
+#endif // MIDI_ENABLE
+#ifdef SEQUENCER_ENABLE
+        parse_numbered_keycode(PSTR("QK_SEQUENCER+"), QK_SEQUENCER, 0, QK_SEQUENCER_STEPS_CLEAR - QK_SEQUENCER, keycode) ||
+#endif // SEQUENCER_ENABLE
+#ifdef AUDIO_ENABLE
+        parse_numbered_keycode(PSTR("QK_AUDIO+"), QK_AUDIO, 0, QK_AUDIO_VOICE_PREVIOUS - QK_AUDIO, keycode) ||
+#endif // AUDIO_ENABLE
+#if defined(BACKLIGHT_ENABLE) || defined(LED_MATRIX_ENABLE) || defined(RGBLIGHT_ENABLED) || defined(RGB_MATRIX_ENABLE) // Lighting-related features.
+        parse_numbered_keycode(PSTR("QK_LIGHTING+"), QK_LIGHTING, 0, QK_LIGHTING_MAX - QK_LIGHTING, keycode) ||
+#endif // defined(BACKLIGHT_ENABLE) || defined(LED_MATRIX_ENABLE) || defined(RGBLIGHT_ENABLED) || defined(RGB_MATRIX_ENABLE)
+#ifdef STENO_ENABLE
+        parse_numbered_keycode(PSTR("QK_STENO+"), QK_STENO, 0, QK_STENO_COMB_MAX - QK_STENO, keycode) ||
+#endif // STENO_ENABLE
+#ifdef BLUETOOTH_ENABLE
+        parse_numbered_keycode(PSTR("QK_CONNECTION+"), QK_CONNECTION, 0, QK_BLUETOOTH_PROFILE5 - QK_CONNECTION, keycode) ||
+#endif // BLUETOOTH_ENABLE
+        parse_numbered_keycode(PSTR("QK_QUANTUM+"), QK_QUANTUM, 0, QK_LAYER_LOCK - QK_QUANTUM, keycode)) {
+        return true;
+    }
+    // clang-format on
+
+    // Fallback: a numerical keycode, as hex or decimal.
+    return parse_number(0xFFFF, keycode) && at_end();
+}
+
+/** Parses a keycode, the inverse of append_keycode(). */
+static bool parse_keycode(uint16_t* keycode) {
+    // Names in the tables take precedence, as they do when formatting.
+    const size_t length = strcspn(input, "(),");
+    if (find_table_name(keycode_string_names_data_user, keycode_string_names_size_user, length, keycode) || find_table_name(keycode_string_names_data_kb, keycode_string_names_size_kb, length, keycode) || find_common_name(length, keycode)) {
+        input += length;
+        return true;
+    }
+
+    return input[length] == '(' ? parse_keycode_call(keycode) : parse_keycode_name(keycode);
+}
+
+bool parse_keycode_string(const char* str, uint16_t* keycode) {
+    uint16_t result;
+
+    input = str;
+    if (!parse_keycode(&result) || *input != '\0') {
+        return false;
+    }
+    *keycode = result;
+    return true;
+}
@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <stdbool.h>
 #include <stdint.h>
 
 #if KEYCODE_STRING_ENABLE
@@ -70,6 +71,22 @@
  */
 const char* get_keycode_string(uint16_t keycode);
 
+/**
+ * @brief Parses a human-readable keycode string back into a QMK keycode.
+ *
+ * This is the inverse of `get_keycode_string()`: every string it returns
+ * parses back to the same keycode, for example "LT(2,KC_D)" parses to
+ * `LT(2, KC_D)`. Names from `keycode_string_names_user` and
+ * `keycode_string_names_kb` are understood too. Numbers are accepted as hex
+ * values like `0x1ABC` or as decimal values. This is useful to read keycodes
+ * from the console or from raw HID scripts.
+ *
+ * @param str      Keycode string.
+ * @param keycode  Where to write the parsed keycode, left unchanged on failure.
+ * @return         true if `str` is a recognized keycode string.
+ */
+bool parse_keycode_string(const char* str, uint16_t* keycode);
+
 /** Defines a human-readable name for a keycode. */
 typedef struct {
     uint16_t    keycode;
@@ -93,6 +110,8 @@ typedef struct {
  *
  * The above defines names for `MYMACRO1` and `MYMACRO2`, and overrides
  * `KC_EXLM` to format as "KC_EXLM" instead of the default "S(KC_1)".
+ *
+ * Tables sorted by keycode are binary searched, others are searched linearly.
  */
 #    define KEYCODE_STRING_NAMES_USER(...)                                          \
     static const keycode_string_name_t keycode_string_names_user[] = {__VA_ARGS__}; \
@@ -14,6 +14,7 @@
 
 #include "layer_lock.h"
 #include "quantum_keycodes.h"
+#include "task_deadline.h"
 
 #ifndef NO_ACTION_LAYER
 // The current lock state. The kth bit is on if layer k is locked.
@@ -24,16 +25,26 @@ layer_state_t locked_layers = 0;
 uint32_t layer_lock_timer = 0;
 
 void layer_lock_timeout_task(void) {
-    if (locked_layers && timer_elapsed32(layer_lock_timer) > LAYER_LOCK_IDLE_TIMEOUT) {
+    uint32_t elapsed = timer_elapsed32(layer_lock_timer);
+    if (locked_layers && elapsed > LAYER_LOCK_IDLE_TIMEOUT) {
         layer_lock_all_off();
         layer_lock_timer = timer_read32();
     }
+
+    if (locked_layers) {
+        task_deadline_defer(TASK_DEADLINE_LAYER_LOCK, LAYER_LOCK_IDLE_TIMEOUT + 1 - elapsed);
+    } else {
+        task_deadline_sleep(TASK_DEADLINE_LAYER_LOCK);
+    }
 }
 void layer_lock_activity_trigger(void) {
     layer_lock_timer = timer_read32();
+    task_deadline_wake(TASK_DEADLINE_LAYER_LOCK);
 }
 #    else
-void layer_lock_timeout_task(void) {}
+void layer_lock_timeout_task(void) {
+    task_deadline_sleep(TASK_DEADLINE_LAYER_LOCK);
+}
 void layer_lock_activity_trigger(void) {}
 #    endif // LAYER_LOCK_IDLE_TIMEOUT > 0
 
@@ -84,7 +95,9 @@ void layer_lock_on(uint8_t layer) {}
 void layer_lock_off(uint8_t layer) {}
 void layer_lock_all_off(void) {}
 void layer_lock_invert(uint8_t layer) {}
-void layer_lock_timeout_task(void) {}
+void layer_lock_timeout_task(void) {
+    task_deadline_sleep(TASK_DEADLINE_LAYER_LOCK);
+}
 void layer_lock_activity_trigger(void) {}
 #endif // NO_ACTION_LAYER
 
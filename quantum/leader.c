@@ -4,6 +4,7 @@
 #include "leader.h"
 #include "timer.h"
 #include "util.h"
+#include "task_deadline.h"
 
 #include <string.h>
 
@@ -34,6 +35,7 @@ void leader_start(void) {
     leader_time          = timer_read();
     leader_sequence_size = 0;
     memset(leader_sequence, 0, sizeof(leader_sequence));
+    task_deadline_wake(TASK_DEADLINE_LEADER);
 }
 
 void leader_end(void) {
@@ -45,6 +47,16 @@ void leader_task(void) {
     if (leader_sequence_active() && leader_sequence_timed_out()) {
         leader_end();
     }
+
+#if defined(LEADER_NO_TIMEOUT)
+    if (!leader_sequence_active() || leader_sequence_size == 0) {
+#else
+    if (!leader_sequence_active()) {
+#endif
+        task_deadline_sleep(TASK_DEADLINE_LEADER);
+        return;
+    }
+    task_deadline_defer(TASK_DEADLINE_LEADER, LEADER_TIMEOUT + 1 - timer_elapsed(leader_time));
 }
 
 bool leader_sequence_active(void) {
@@ -81,6 +93,7 @@ bool leader_sequence_timed_out(void) {
 
 void leader_reset_timer(void) {
     leader_time = timer_read();
+    task_deadline_wake(TASK_DEADLINE_LEADER);
 }
 
 bool leader_sequence_is(uint16_t kc1, uint16_t kc2, uint16_t kc3, uint16_t kc4, uint16_t kc5) {
@@ -44,4 +44,12 @@ interrupt_setting_t store_and_clear_interrupt(void) {
 void restore_interrupt_setting(interrupt_setting_t setting) {
     chSysUnlock();
 }
+#elif defined(PROTOCOL_TEST)
+// The unit tests have no interrupts to disable
+
+interrupt_setting_t store_and_clear_interrupt(void) {
+    return 0;
+}
+
+void restore_interrupt_setting(interrupt_setting_t setting) {}
 #endif
@@ -22,6 +22,20 @@
 #    define DYNAMIC_KEYMAP_EEPROM_START (EECONFIG_SIZE)
 #endif
 
+// Slider calibration and saved dynamic macros take the end of EEPROM
+#ifdef SLIDER_ENABLE
+#    include "nvm_eeprom_slider_internal.h"
+#    ifndef DYNAMIC_KEYMAP_EEPROM_MAX_ADDR
+#        define DYNAMIC_KEYMAP_EEPROM_MAX_ADDR (SLIDER_EEPROM_ADDR - 1)
+#    endif
+#endif
+#if defined(DYNAMIC_MACRO_ENABLE) && defined(DYNAMIC_MACRO_PERSISTENT)
+#    include "nvm_eeprom_dynamic_macro_internal.h"
+#    ifndef DYNAMIC_KEYMAP_EEPROM_MAX_ADDR
+#        define DYNAMIC_KEYMAP_EEPROM_MAX_ADDR (DYNAMIC_MACRO_EEPROM_ADDR - 1)
+#    endif
+#endif
+
 #ifndef DYNAMIC_KEYMAP_EEPROM_MAX_ADDR
 #    define DYNAMIC_KEYMAP_EEPROM_MAX_ADDR (TOTAL_EEPROM_BYTE_COUNT - 1)
 #endif
@@ -31,6 +45,13 @@ STATIC_ASSERT(DYNAMIC_KEYMAP_EEPROM_MAX_ADDR <= (TOTAL_EEPROM_BYTE_COUNT - 1), "
 // Due to usage of uint16_t check for max 65535
 STATIC_ASSERT(DYNAMIC_KEYMAP_EEPROM_MAX_ADDR <= 65535, "DYNAMIC_KEYMAP_EEPROM_MAX_ADDR must be less than 65536");
 
+#ifdef SLIDER_ENABLE
+STATIC_ASSERT(DYNAMIC_KEYMAP_EEPROM_MAX_ADDR < SLIDER_EEPROM_ADDR, "DYNAMIC_KEYMAP_EEPROM_MAX_ADDR overlaps the slider calibration");
+#endif
+#if defined(DYNAMIC_MACRO_ENABLE) && defined(DYNAMIC_MACRO_PERSISTENT)
+STATIC_ASSERT(DYNAMIC_KEYMAP_EEPROM_MAX_ADDR < DYNAMIC_MACRO_EEPROM_ADDR, "DYNAMIC_KEYMAP_EEPROM_MAX_ADDR overlaps the saved dynamic macros");
+#endif
+
 // If DYNAMIC_KEYMAP_EEPROM_ADDR not explicitly defined in config.h,
 #ifndef DYNAMIC_KEYMAP_EEPROM_ADDR
 #    define DYNAMIC_KEYMAP_EEPROM_ADDR DYNAMIC_KEYMAP_EEPROM_START
@@ -0,0 +1,92 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "compiler_support.h"
+#include "eeprom.h"
+#include "nvm_dynamic_macro.h"
+#include "nvm_eeprom_eeconfig_internal.h"
+#include "nvm_eeprom_dynamic_macro_internal.h"
+
+#ifdef DYNAMIC_MACRO_PERSISTENT
+
+#    ifdef VIA_ENABLE
+#        include "via.h"
+#        include "nvm_eeprom_via_internal.h"
+#        define DYNAMIC_MACRO_EEPROM_MIN_ADDR (VIA_EEPROM_CONFIG_END)
+#    else
+#        define DYNAMIC_MACRO_EEPROM_MIN_ADDR (EECONFIG_SIZE)
+#    endif
+
+STATIC_ASSERT(DYNAMIC_MACRO_EEPROM_ADDR >= DYNAMIC_MACRO_EEPROM_MIN_ADDR, "Dynamic macros are configured to use more EEPROM than is available, reduce DYNAMIC_MACRO_SIZE.");
+STATIC_ASSERT(DYNAMIC_MACRO_EEPROM_ADDR + DYNAMIC_MACRO_EEPROM_SIZE <= TOTAL_EEPROM_BYTE_COUNT, "DYNAMIC_MACRO_EEPROM_ADDR is configured to use more space than what is available for the selected EEPROM driver");
+
+// "DM" plus one, changed whenever the header or the encoding of the events changes
+#    define DYNAMIC_MACRO_EEPROM_MAGIC 0x444E
+
+static bool nvm_dynamic_macro_is_valid(void) {
+    return eeprom_read_word((const uint16_t *)(uintptr_t)(DYNAMIC_MACRO_EEPROM_MAGIC_ADDR)) == DYNAMIC_MACRO_EEPROM_MAGIC && eeprom_read_word((const uint16_t *)(uintptr_t)(DYNAMIC_MACRO_EEPROM_BUFFER_SIZE_ADDR)) == DYNAMIC_MACRO_BUFFER_SIZE;
+}
+
+void nvm_dynamic_macro_erase(void) {
+    eeprom_update_word((uint16_t *)(uintptr_t)(DYNAMIC_MACRO_EEPROM_MAGIC_ADDR), 0xFFFF);
+}
+
+uint16_t nvm_dynamic_macro_read_length(uint8_t macro) {
+    if (macro > 1 || !nvm_dynamic_macro_is_valid()) return 0;
+    return eeprom_read_word((const uint16_t *)(uintptr_t)(DYNAMIC_MACRO_EEPROM_LENGTH_ADDR + macro * 2));
+}
+
+void nvm_dynamic_macro_update_length(uint8_t macro, uint16_t length) {
+    if (macro > 1) return;
+    if (!nvm_dynamic_macro_is_valid()) {
+        // Both macros are empty until written
+        eeprom_update_dword((uint32_t *)(uintptr_t)(DYNAMIC_MACRO_EEPROM_LENGTH_ADDR), 0);
+        eeprom_update_word((uint16_t *)(uintptr_t)(DYNAMIC_MACRO_EEPROM_BUFFER_SIZE_ADDR), DYNAMIC_MACRO_BUFFER_SIZE);
+        eeprom_update_word((uint16_t *)(uintptr_t)(DYNAMIC_MACRO_EEPROM_MAGIC_ADDR), DYNAMIC_MACRO_EEPROM_MAGIC);
+    }
+    eeprom_update_word((uint16_t *)(uintptr_t)(DYNAMIC_MACRO_EEPROM_LENGTH_ADDR + macro * 2), length);
+}
+
+uint8_t nvm_dynamic_macro_read_crc(uint8_t macro) {
+    if (macro > 1 || !nvm_dynamic_macro_is_valid()) return 0;
+    return eeprom_read_byte((const uint8_t *)(uintptr_t)(DYNAMIC_MACRO_EEPROM_CRC_ADDR + macro));
+}
+
+void nvm_dynamic_macro_update_crc(uint8_t macro, uint8_t crc) {
+    if (macro > 1 || !nvm_dynamic_macro_is_valid()) return;
+    eeprom_update_byte((uint8_t *)(uintptr_t)(DYNAMIC_MACRO_EEPROM_CRC_ADDR + macro), crc);
+}
+
+void nvm_dynamic_macro_read_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
+    if (offset + size > DYNAMIC_MACRO_BUFFER_SIZE) return;
+    eeprom_read_block(data, (const void *)(uintptr_t)(DYNAMIC_MACRO_EEPROM_BUFFER_ADDR + offset), size);
+}
+
+void nvm_dynamic_macro_update_buffer(uint16_t offset, uint16_t size, const uint8_t *data) {
+    if (offset + size > DYNAMIC_MACRO_BUFFER_SIZE) return;
+    eeprom_update_block(data, (void *)(uintptr_t)(DYNAMIC_MACRO_EEPROM_BUFFER_ADDR + offset), size);
+}
+
+#else // DYNAMIC_MACRO_PERSISTENT
+
+// Dynamic macros are lost on power off, and use no EEPROM.
+
+void nvm_dynamic_macro_erase(void) {}
+
+uint16_t nvm_dynamic_macro_read_length(uint8_t macro) {
+    return 0;
+}
+
+void nvm_dynamic_macro_update_length(uint8_t macro, uint16_t length) {}
+
+uint8_t nvm_dynamic_macro_read_crc(uint8_t macro) {
+    return 0;
+}
+
+void nvm_dynamic_macro_update_crc(uint8_t macro, uint8_t crc) {}
+
+void nvm_dynamic_macro_read_buffer(uint16_t offset, uint16_t size, uint8_t *data) {}
+
+void nvm_dynamic_macro_update_buffer(uint16_t offset, uint16_t size, const uint8_t *data) {}
+
+#endif // DYNAMIC_MACRO_PERSISTENT
@@ -3,6 +3,7 @@
 #include <string.h>
 #include "nvm_eeconfig.h"
 #include "nvm_eeprom_eeconfig_internal.h"
+#include "compiler_support.h"
 #include "util.h"
 #include "eeconfig.h"
 #include "debug.h"
@@ -45,6 +46,24 @@
 #    include "connection.h"
 #endif
 
+#ifdef SLIDER_ENABLE
+#    include "slider.h"
+#    include "nvm_eeprom_slider_internal.h"
+#    ifdef VIA_ENABLE
+#        include "via.h"
+#        include "nvm_eeprom_via_internal.h"
+#        define SLIDER_EEPROM_MIN_ADDR (VIA_EEPROM_CONFIG_END)
+#    else
+#        define SLIDER_EEPROM_MIN_ADDR (EECONFIG_SIZE)
+#    endif
+
+STATIC_ASSERT(SLIDER_EEPROM_ADDR >= SLIDER_EEPROM_MIN_ADDR, "Slider calibration does not fit in the EEPROM");
+STATIC_ASSERT(SLIDER_EEPROM_ADDR + SLIDER_EEPROM_SIZE <= TOTAL_EEPROM_BYTE_COUNT, "SLIDER_EEPROM_ADDR is configured to use more space than what is available for the selected EEPROM driver");
+
+// "SL", changed whenever the layout of the calibration changes
+#    define SLIDER_EEPROM_MAGIC 0x534C
+#endif
+
 void nvm_eeconfig_erase(void) {
 #ifdef EEPROM_DRIVER
     eeprom_driver_format(false);
@@ -209,6 +228,30 @@ void nvm_eeconfig_update_connection(const connection_config_t *config) {
 }
 #endif // CONNECTION_ENABLE
 
+#ifdef SLIDER_ENABLE
+static bool nvm_eeconfig_slider_is_valid(void) {
+    return eeprom_read_word((const uint16_t *)(uintptr_t)(SLIDER_EEPROM_MAGIC_ADDR)) == SLIDER_EEPROM_MAGIC;
+}
+void nvm_eeconfig_read_slider_calibration(uint8_t index, slider_calibration_t *calibration) {
+    if (!nvm_eeconfig_slider_is_valid()) {
+        // Never written, the slider falls back to its default travel
+        *calibration = (slider_calibration_t){0};
+        return;
+    }
+    eeprom_read_block(calibration, (const slider_calibration_t *)(uintptr_t)(SLIDER_EEPROM_CALIBRATION_ADDR) + index, sizeof(slider_calibration_t));
+}
+void nvm_eeconfig_update_slider_calibration(uint8_t index, const slider_calibration_t *calibration) {
+    if (!nvm_eeconfig_slider_is_valid()) {
+        // Other sliders are uncalibrated until written
+        for (uint8_t i = 0; i < NUM_SLIDERS; i++) {
+            eeprom_update_block(&(slider_calibration_t){0}, (slider_calibration_t *)(uintptr_t)(SLIDER_EEPROM_CALIBRATION_ADDR) + i, sizeof(slider_calibration_t));
+        }
+        eeprom_update_word((uint16_t *)(uintptr_t)(SLIDER_EEPROM_MAGIC_ADDR), SLIDER_EEPROM_MAGIC);
+    }
+    eeprom_update_block(calibration, (slider_calibration_t *)(uintptr_t)(SLIDER_EEPROM_CALIBRATION_ADDR) + index, sizeof(slider_calibration_t));
+}
+#endif // SLIDER_ENABLE
+
 bool nvm_eeconfig_read_handedness(void) {
     return !!eeprom_read_byte(EECONFIG_HANDEDNESS);
 }
@@ -0,0 +1,21 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include "process_dynamic_macro.h"
+
+// Dynamic macros are stored at the end of the EEPROM, behind a header
+// holding a magic number, the size of the buffer, and the length and
+// CRC of each macro. Dynamic keymaps stop before them.
+#define DYNAMIC_MACRO_EEPROM_HEADER_SIZE 10
+#define DYNAMIC_MACRO_EEPROM_SIZE (DYNAMIC_MACRO_EEPROM_HEADER_SIZE + DYNAMIC_MACRO_BUFFER_SIZE)
+
+#ifndef DYNAMIC_MACRO_EEPROM_ADDR
+#    define DYNAMIC_MACRO_EEPROM_ADDR (TOTAL_EEPROM_BYTE_COUNT - DYNAMIC_MACRO_EEPROM_SIZE)
+#endif
+
+#define DYNAMIC_MACRO_EEPROM_MAGIC_ADDR (DYNAMIC_MACRO_EEPROM_ADDR)
+#define DYNAMIC_MACRO_EEPROM_BUFFER_SIZE_ADDR (DYNAMIC_MACRO_EEPROM_ADDR + 2)
+#define DYNAMIC_MACRO_EEPROM_LENGTH_ADDR (DYNAMIC_MACRO_EEPROM_ADDR + 4)
+#define DYNAMIC_MACRO_EEPROM_CRC_ADDR (DYNAMIC_MACRO_EEPROM_ADDR + 8)
+#define DYNAMIC_MACRO_EEPROM_BUFFER_ADDR (DYNAMIC_MACRO_EEPROM_ADDR + DYNAMIC_MACRO_EEPROM_HEADER_SIZE)
@@ -61,3 +61,4 @@ typedef struct PACKED {
 #define EECONFIG_SIZE ((EECONFIG_BASE_SIZE) + (EECONFIG_KB_DATA_SIZE) + (EECONFIG_USER_DATA_SIZE))
 
 STATIC_ASSERT((intptr_t)EECONFIG_HANDEDNESS == 14, "EEPROM handedness offset is incorrect");
+STATIC_ASSERT(sizeof(eeprom_core_t) <= UINT8_MAX, "EEPROM core data does not fit EECONFIG_BASE_SIZE");
@@ -0,0 +1,24 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include "slider.h"
+
+// Slider calibration is stored near the end of the EEPROM, below the saved
+// dynamic macros, behind a magic number. It stays out of the eeconfig core
+// block so that enabling sliders does not move the keyboard and user data
+// blocks, VIA or the dynamic keymaps. Dynamic keymaps stop before it.
+#define SLIDER_EEPROM_HEADER_SIZE 2
+#define SLIDER_EEPROM_SIZE (SLIDER_EEPROM_HEADER_SIZE + NUM_SLIDERS * sizeof(slider_calibration_t))
+
+#ifndef SLIDER_EEPROM_ADDR
+#    if defined(DYNAMIC_MACRO_ENABLE) && defined(DYNAMIC_MACRO_PERSISTENT)
+#        include "nvm_eeprom_dynamic_macro_internal.h"
+#        define SLIDER_EEPROM_ADDR (DYNAMIC_MACRO_EEPROM_ADDR - SLIDER_EEPROM_SIZE)
+#    else
+#        define SLIDER_EEPROM_ADDR (TOTAL_EEPROM_BYTE_COUNT - SLIDER_EEPROM_SIZE)
+#    endif
+#endif
+
+#define SLIDER_EEPROM_MAGIC_ADDR (SLIDER_EEPROM_ADDR)
+#define SLIDER_EEPROM_CALIBRATION_ADDR (SLIDER_EEPROM_ADDR + SLIDER_EEPROM_HEADER_SIZE)
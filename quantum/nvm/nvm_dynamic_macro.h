@@ -0,0 +1,17 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+void nvm_dynamic_macro_erase(void);
+
+uint16_t nvm_dynamic_macro_read_length(uint8_t macro);
+void     nvm_dynamic_macro_update_length(uint8_t macro, uint16_t length);
+
+uint8_t nvm_dynamic_macro_read_crc(uint8_t macro);
+void    nvm_dynamic_macro_update_crc(uint8_t macro, uint8_t crc);
+
+void nvm_dynamic_macro_read_buffer(uint16_t offset, uint16_t size, uint8_t *data);
+void nvm_dynamic_macro_update_buffer(uint16_t offset, uint16_t size, const uint8_t *data);
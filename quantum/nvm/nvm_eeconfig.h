@@ -93,6 +93,12 @@ void                              nvm_eeconfig_read_connection(connection_config
 void                              nvm_eeconfig_update_connection(const connection_config_t *config);
 #endif // CONNECTION_ENABLE
 
+#ifdef SLIDER_ENABLE
+typedef struct slider_calibration_t slider_calibration_t;
+void                                nvm_eeconfig_read_slider_calibration(uint8_t index, slider_calibration_t *calibration);
+void                                nvm_eeconfig_update_slider_calibration(uint8_t index, const slider_calibration_t *calibration);
+#endif // SLIDER_ENABLE
+
 bool nvm_eeconfig_read_handedness(void);
 void nvm_eeconfig_update_handedness(bool val);
 
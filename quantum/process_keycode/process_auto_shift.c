@@ -19,6 +19,7 @@
 #include "action_util.h"
 #include "timer.h"
 #include "keycodes.h"
+#include "task_deadline.h"
 
 #ifndef AUTO_SHIFT_DISABLED_AT_STARTUP
 #    define AUTO_SHIFT_STARTUP_STATE true /* enabled */
@@ -223,6 +224,7 @@ static bool autoshift_press(uint16_t keycode, uint16_t now, keyrecord_t *record)
     autoshift_lastkey           = keycode;
     autoshift_time              = now;
     autoshift_flags.in_progress = true;
+    task_deadline_wake(TASK_DEADLINE_AUTO_SHIFT);
 
 #if !defined(NO_ACTION_ONESHOT) && !defined(NO_ACTION_TAPPING)
     clear_oneshot_layer_state(ONESHOT_OTHER_KEY_PRESSED);
@@ -319,6 +321,10 @@ void autoshift_matrix_scan(void) {
             autoshift_end(autoshift_lastkey, now, true, &autoshift_lastrecord);
         }
     }
+    // A shift can only start on a key event, which wakes the task again.
+    if (!autoshift_flags.in_progress) {
+        task_deadline_sleep(TASK_DEADLINE_AUTO_SHIFT);
+    }
 }
 
 void autoshift_toggle(void) {
@@ -11,6 +11,7 @@
 #include "keycode_config.h"
 #include "send_string.h"
 #include "action_util.h"
+#include "compiler_support.h"
 
 #if __has_include("autocorrect_data.h")
 #    include "autocorrect_data.h"
@@ -19,6 +20,16 @@
 #    include "autocorrect_data_default.h"
 #endif
 
+#ifdef AUTOCORRECT_LARGE_DICTIONARY
+#    ifdef __AVR__
+// pgm_read_byte() only reaches the first 64KB of flash on AVR
+STATIC_ASSERT(DICTIONARY_SIZE <= 65536, "Autocorrect dictionaries larger than 64KB are not supported on AVR");
+#    endif
+typedef uint32_t autocorrect_offset_t;
+#else
+typedef uint16_t autocorrect_offset_t;
+#endif
+
 static uint8_t typo_buffer[AUTOCORRECT_MAX_LENGTH] = {KC_SPC};
 static uint8_t typo_buffer_size                    = 1;
 
@@ -280,18 +291,41 @@ bool process_autocorrect(uint16_t keycode, keyrecord_t *record) {
     }
 
     // Check for typo in buffer using a trie stored in `autocorrect_data`.
-    uint16_t state = 0;
-    uint8_t  code  = pgm_read_byte(autocorrect_data + state);
+    autocorrect_offset_t state = 0;
+    uint8_t              code  = pgm_read_byte(autocorrect_data + state);
     for (int8_t i = typo_buffer_size - 1; i >= 0; --i) {
         uint8_t const key_i = typo_buffer[i];
 
         if (code & 64) { // Check for match in node with multiple children.
+#ifdef AUTOCORRECT_LARGE_DICTIONARY
+            // The node lists its children's keycodes in ascending order,
+            // followed by a 24-bit link for each of them.
+            const uint8_t  children = code & 63;
+            const uint8_t *keys     = autocorrect_data + state + 1;
+            uint8_t        lo       = 0;
+            uint8_t        hi       = children;
+            while (lo < hi) {
+                const uint8_t mid = (lo + hi) / 2;
+                if (pgm_read_byte(keys + mid) < key_i) {
+                    lo = mid + 1;
+                } else {
+                    hi = mid;
+                }
+            }
+            if (lo == children || pgm_read_byte(keys + lo) != key_i) {
+                return true;
+            }
+            // Follow link to child node.
+            const uint8_t *link = keys + children + 3 * lo;
+            state               = pgm_read_byte(link) | pgm_read_byte(link + 1) << 8 | (autocorrect_offset_t)pgm_read_byte(link + 2) << 16;
+#else
             code &= 63;
             for (; code != key_i; code = pgm_read_byte(autocorrect_data + (state += 3))) {
                 if (!code) return true;
             }
             // Follow link to child node.
             state = (pgm_read_byte(autocorrect_data + state + 1) | pgm_read_byte(autocorrect_data + state + 2) << 8);
+#endif
             // Check for match in node with single child.
         } else if (code != key_i) {
             return true;
@@ -16,6 +16,7 @@
 
 #include "process_combo.h"
 #include <stddef.h>
+#include <string.h>
 #include "process_auto_shift.h"
 #include "caps_word.h"
 #include "timer.h"
@@ -26,6 +27,8 @@
 #include "action_tapping.h"
 #include "action_util.h"
 #include "keymap_introspection.h"
+#include "debug.h"
+#include "task_deadline.h"
 
 __attribute__((weak)) void process_combo_event(uint16_t combo_index, bool pressed) {}
 
@@ -102,6 +105,24 @@ static queued_combo_t combo_buffer[COMBO_BUFFER_LENGTH];
 
 #define INCREMENT_MOD(i) i = (i + 1) % COMBO_BUFFER_LENGTH
 
+#ifdef COMBO_INDEX_ENABLE
+/* Keycode to combo lookup table, sorted by keycode and then by combo index so
+ * that combos sharing a key are still visited in their original order. */
+typedef struct {
+    uint16_t keycode;
+    uint16_t combo_index;
+} combo_index_entry_t;
+static combo_index_entry_t combo_index_entries[COMBO_INDEX_LENGTH];
+static uint16_t            combo_index_size  = 0;
+static bool                combo_index_built = false;
+static bool                combo_index_valid = false;
+
+/* Combos whose state may have been modified since the last clear_combos(). */
+static uint16_t combo_touched[COMBO_INDEX_TOUCHED_LENGTH];
+static uint8_t  combo_touched_size     = 0;
+static bool     combo_touched_overflow = false;
+#endif
+
 #ifndef EXTRA_SHORT_COMBOS
 /* flags are their own elements in combo_t struct. */
 #    define COMBO_ACTIVE(combo) (combo->active)
@@ -199,14 +220,112 @@ static inline uint16_t _get_combo_term(uint16_t combo_index, combo_t *combo) {
     return COMBO_TERM;
 }
 
+#ifdef COMBO_INDEX_ENABLE
+static void build_combo_index(void) {
+    combo_index_size  = 0;
+    combo_index_built = true;
+    combo_index_valid = false;
+
+    for (uint16_t idx = 0; idx < combo_count(); ++idx) {
+        combo_t *combo = combo_get(idx);
+        uint16_t key;
+        for (uint8_t key_i = 0; (key = pgm_read_word(&combo->keys[key_i])) != COMBO_END; ++key_i) {
+            if (combo_index_size >= COMBO_INDEX_LENGTH) {
+                dprintf("combo: index needs more than COMBO_INDEX_LENGTH (%u) entries, falling back to linear scan\n", COMBO_INDEX_LENGTH);
+                return;
+            }
+
+            /* Insert after every entry with a lower or equal keycode, skipping
+             * keys that appear more than once in the same combo. */
+            uint16_t pos = combo_index_size;
+            while (pos > 0 && combo_index_entries[pos - 1].keycode > key) {
+                pos--;
+            }
+            if (pos > 0 && combo_index_entries[pos - 1].keycode == key && combo_index_entries[pos - 1].combo_index == idx) {
+                continue;
+            }
+            memmove(&combo_index_entries[pos + 1], &combo_index_entries[pos], (combo_index_size - pos) * sizeof(combo_index_entry_t));
+            combo_index_entries[pos] = (combo_index_entry_t){.keycode = key, .combo_index = idx};
+            combo_index_size++;
+        }
+    }
+
+    combo_index_valid = true;
+}
+
+static inline bool combo_index_ready(void) {
+    if (!combo_index_built) {
+        build_combo_index();
+    }
+    return combo_index_valid;
+}
+
+/* Returns the position of the first entry for `keycode`, or the position
+ * where it would be if no combo contains it. */
+static uint16_t combo_index_lower_bound(uint16_t keycode) {
+    uint16_t low = 0, high = combo_index_size;
+    while (low < high) {
+        uint16_t mid = low + (high - low) / 2;
+        if (combo_index_entries[mid].keycode < keycode) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+static inline void touch_combo(uint16_t idx) {
+    if (combo_touched_size < COMBO_INDEX_TOUCHED_LENGTH) {
+        combo_touched[combo_touched_size++] = idx;
+    } else {
+        combo_touched_overflow = true;
+    }
+}
+
+/** \brief Marks the combo index as stale
+ *
+ * Must be called when the combos returned by `combo_count()` and `combo_get()`
+ * change at runtime. The index is rebuilt on the next key event.
+ */
+void combo_index_invalidate(void) {
+    combo_index_built      = false;
+    combo_touched_overflow = true;
+}
+#endif
+
 void clear_combos(void) {
     uint16_t index = 0;
     longest_term   = 0;
+#ifdef COMBO_INDEX_ENABLE
+    if (combo_index_ready() && !combo_touched_overflow) {
+        /* Only combos visited through the index can hold any state. Active
+         * combos keep theirs and need to be cleared again later on. */
+        uint8_t kept = 0;
+        for (uint8_t i = 0; i < combo_touched_size; ++i) {
+            combo_t *combo = combo_get(combo_touched[i]);
+            if (!COMBO_ACTIVE(combo)) {
+                RESET_COMBO_STATE(combo);
+            } else {
+                combo_touched[kept++] = combo_touched[i];
+            }
+        }
+        combo_touched_size = kept;
+        return;
+    }
+    combo_touched_size     = 0;
+    combo_touched_overflow = false;
+#endif
     for (index = 0; index < combo_count(); ++index) {
         combo_t *combo = combo_get(index);
         if (!COMBO_ACTIVE(combo)) {
             RESET_COMBO_STATE(combo);
         }
+#ifdef COMBO_INDEX_ENABLE
+        else {
+            touch_combo(index);
+        }
+#endif
     }
 }
 
@@ -265,6 +384,7 @@ static inline void dump_key_buffer(void) {
 }
 
 #define NO_COMBO_KEYS_ARE_DOWN (0 == COMBO_STATE(combo))
+#define COMBO_IS_CLEAN(combo) (0 == COMBO_STATE(combo) && !COMBO_ACTIVE(combo) && !COMBO_DISABLED(combo))
 #define ALL_COMBO_KEYS_ARE_DOWN(state, key_count) (((1 << key_count) - 1) == state)
 #define ONLY_ONE_KEY_IS_DOWN(state) !(state & (state - 1))
 #define KEY_NOT_YET_RELEASED(state, key_index) ((1 << key_index) & state)
@@ -552,8 +672,7 @@ static combo_key_action_t process_single_combo(combo_t *combo, uint16_t keycode,
 }
 
 bool process_combo(uint16_t keycode, keyrecord_t *record) {
-    uint8_t is_combo_key          = COMBO_KEY_NOT_PRESSED;
-    bool    no_combo_keys_pressed = true;
+    uint8_t is_combo_key = COMBO_KEY_NOT_PRESSED;
 
     if (keycode == QK_COMBO_ON && record->event.pressed) {
         combo_enable();
@@ -581,10 +700,25 @@ bool process_combo(uint16_t keycode, keyrecord_t *record) {
     }
 #endif
 
-    for (uint16_t idx = 0; idx < combo_count(); ++idx) {
-        combo_t *combo = combo_get(idx);
-        is_combo_key |= process_single_combo(combo, keycode, record, idx);
-        no_combo_keys_pressed = no_combo_keys_pressed && (NO_COMBO_KEYS_ARE_DOWN || COMBO_ACTIVE(combo) || COMBO_DISABLED(combo));
+#ifdef COMBO_INDEX_ENABLE
+    if (combo_index_ready()) {
+        /* Only visit the combos that contain this keycode. */
+        for (uint16_t i = combo_index_lower_bound(keycode); i < combo_index_size && combo_index_entries[i].keycode == keycode; ++i) {
+            uint16_t idx       = combo_index_entries[i].combo_index;
+            combo_t *combo     = combo_get(idx);
+            bool     was_clean = COMBO_IS_CLEAN(combo);
+            is_combo_key |= process_single_combo(combo, keycode, record, idx);
+            if (was_clean && !COMBO_IS_CLEAN(combo)) {
+                touch_combo(idx);
+            }
+        }
+    } else
+#endif
+    {
+        for (uint16_t idx = 0; idx < combo_count(); ++idx) {
+            combo_t *combo = combo_get(idx);
+            is_combo_key |= process_single_combo(combo, keycode, record, idx);
+        }
     }
 
     if (record->event.pressed && is_combo_key) {
@@ -629,6 +763,7 @@ bool process_combo(uint16_t keycode, keyrecord_t *record) {
 
 void combo_task(void) {
     if (!b_combo_enable) {
+        task_deadline_sleep(TASK_DEADLINE_COMBO);
         return;
     }
 
@@ -644,11 +779,18 @@ void combo_task(void) {
             clear_combos();
         }
     }
+    if (timer) {
+        uint16_t elapsed = timer_elapsed(timer);
+        task_deadline_defer(TASK_DEADLINE_COMBO, elapsed > longest_term ? 0 : longest_term + 1 - elapsed);
+        return;
+    }
 #endif
+    task_deadline_sleep(TASK_DEADLINE_COMBO);
 }
 
 void combo_enable(void) {
     b_combo_enable = true;
+    task_deadline_wake(TASK_DEADLINE_COMBO);
 }
 
 void combo_disable(void) {
@@ -38,6 +38,14 @@
 #ifndef COMBO_BUFFER_LENGTH
 #    define COMBO_BUFFER_LENGTH 4
 #endif
+#ifdef COMBO_INDEX_ENABLE
+#    ifndef COMBO_INDEX_LENGTH
+#        define COMBO_INDEX_LENGTH 256
+#    endif
+#    ifndef COMBO_INDEX_TOUCHED_LENGTH
+#        define COMBO_INDEX_TOUCHED_LENGTH 16
+#    endif
+#endif
 
 typedef struct combo_t {
     const uint16_t *keys;
@@ -81,3 +89,7 @@ void combo_enable(void);
 void combo_disable(void);
 void combo_toggle(void);
 bool is_combo_enabled(void);
+
+#ifdef COMBO_INDEX_ENABLE
+void combo_index_invalidate(void);
+#endif
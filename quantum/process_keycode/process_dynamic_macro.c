@@ -18,10 +18,19 @@
 /* Author: Wojciech Siewierski < wojciech dot siewierski at onet dot pl > */
 #include "process_dynamic_macro.h"
 #include <stddef.h>
+#include <string.h>
 #include "action_layer.h"
 #include "keycodes.h"
 #include "debug.h"
+#include "matrix.h"
+#include "timer.h"
 #include "wait.h"
+#include "task_deadline.h"
+
+#ifdef DYNAMIC_MACRO_PERSISTENT
+#    include "nvm_dynamic_macro.h"
+#    include "crc.h"
+#endif
 
 #ifdef BACKLIGHT_ENABLE
 #    include "backlight.h"
@@ -86,164 +95,475 @@ __attribute__((weak)) bool dynamic_macro_valid_key_user(uint16_t keycode, keyrec
  * need a `direction` variable accessible at the call site.
  */
 #define DYNAMIC_MACRO_CURRENT_SLOT() (direction > 0 ? 1 : 2)
-#define DYNAMIC_MACRO_CURRENT_LENGTH(BEGIN, POINTER) ((int)(direction * ((POINTER) - (BEGIN))))
-#define DYNAMIC_MACRO_CURRENT_CAPACITY(BEGIN, END2) ((int)(direction * ((END2) - (BEGIN)) + 1))
+#define DYNAMIC_MACRO_CURRENT_INDEX() (direction > 0 ? 0 : 1)
+#define DYNAMIC_MACRO_CURRENT_CAPACITY() (DYNAMIC_MACRO_BUFFER_SIZE - macro_length[direction > 0 ? 1 : 0])
+
+/* Every event is stored as a header byte, followed by more bytes of
+ * the delay when it does not fit in the header, and then by the key:
+ *
+ * header  pressed (bit 7), full record (bit 6), more delay (bit 5),
+ *         and the low 5 bits of the delay since the previous event,
+ *         in milliseconds
+ * delay   7 more bits of the delay per byte, bit 7 set if another
+ *         byte follows
+ * key     row * MATRIX_COLS + col for a plain key, or for a full
+ *         record the event type, row, col, tap state, and keycode
+ *         when combos or repeat key are enabled
+ *
+ * A plain key is a key event with no tap state nor keycode, which is
+ * what most of the recorded events are.
+ */
+#define DYNAMIC_MACRO_PRESSED 0x80
+#define DYNAMIC_MACRO_FULL_RECORD 0x40
+#define DYNAMIC_MACRO_MORE_DELAY 0x20
+#define DYNAMIC_MACRO_DELAY_MASK 0x1F
+#define DYNAMIC_MACRO_EVENT_MAX_SIZE 9
+#if defined(COMBO_ENABLE) || defined(REPEAT_KEY_ENABLE)
+#    define DYNAMIC_MACRO_FULL_RECORD_SIZE 6
+#else
+#    define DYNAMIC_MACRO_FULL_RECORD_SIZE 4
+#endif
+
+/* Both macros use the same buffer but read/write on different
+ * ends of it.
+ *
+ * Macro1 is written left-to-right starting from the beginning of
+ * the buffer.
+ *
+ * Macro2 is written right-to-left starting from the end of the
+ * buffer, so its bytes are in reverse order in memory.
+ *
+ *  0                  macro_length[0]
+ *  v                   v
+ * +------------------------------------------------------------+
+ * |>>>>>> MACRO1 >>>>>>      <<<<<<<<<<<<< MACRO2 <<<<<<<<<<<<<|
+ * +------------------------------------------------------------+
+ *                           ^                                 ^
+ *     DYNAMIC_MACRO_BUFFER_SIZE - macro_length[1]   DYNAMIC_MACRO_BUFFER_SIZE - 1
+ *
+ * During the recording when one macro encounters the end of the
+ * other macro, the recording is stopped. Apart from this, there
+ * are no arbitrary limits for the macros' length in relation to
+ * each other: for example one can either have two medium sized
+ * macros or one long macro and one short macro. Or even one empty
+ * and one using the whole buffer.
+ */
+static uint8_t macro_buffer[DYNAMIC_MACRO_BUFFER_SIZE];
+
+/* Number of bytes used by each macro. */
+static uint16_t macro_length[2] = {0, 0};
+
+/* Number of bytes recorded so far, the time of the last recorded
+ * event, and whether the buffer is full, used during the recording. */
+static uint16_t record_length = 0;
+static uint16_t record_time   = 0;
+static bool     record_full   = false;
+
+/* 0   - no macro is being recorded right now
+ * 1,2 - either macro 1 or 2 is being recorded */
+static uint8_t macro_id = 0;
+
+/* A macro being played, and the macro that played it if any. */
+typedef struct {
+    int8_t        direction;
+    uint16_t      offset;
+    uint32_t      time; // when the previous event was due
+    layer_state_t saved_layer_state;
+} dynamic_macro_playback_t;
+
+static dynamic_macro_playback_t playback[DYNAMIC_MACRO_PLAYBACK_DEPTH];
+static uint8_t                  playback_depth = 0;
+
+/* When the event being played was due, while it is being processed.
+ * A macro it plays starts from there rather than from now, so that
+ * it keeps the timing even when playback is catching up. */
+static bool     playing_event = false;
+static uint32_t playback_time = 0;
+
+/**
+ * Get a byte of a macro.
+ *
+ * @param[in] direction Either +1 or -1, which macro the byte belongs to.
+ * @param[in] offset    The position of the byte from the start of the macro.
+ */
+static inline uint8_t *dynamic_macro_byte(int8_t direction, uint16_t offset) {
+    return direction > 0 ? &macro_buffer[offset] : &macro_buffer[DYNAMIC_MACRO_BUFFER_SIZE - 1 - offset];
+}
+
+/**
+ * Encode a key event.
+ *
+ * @param[in]  record The key event.
+ * @param[in]  delay  The time since the previous event, in milliseconds.
+ * @param[out] data   At least DYNAMIC_MACRO_EVENT_MAX_SIZE bytes.
+ * @return The number of bytes used.
+ */
+static uint8_t dynamic_macro_encode(const keyrecord_t *record, uint16_t delay, uint8_t *data) {
+    uint8_t  length  = 0;
+    uint8_t  tap     = 0;
+    uint16_t keycode = 0;
+    uint16_t index   = record->event.key.row * MATRIX_COLS + record->event.key.col;
+#ifndef NO_ACTION_TAPPING
+    memcpy(&tap, &record->tap, sizeof(tap));
+#endif
+#if defined(COMBO_ENABLE) || defined(REPEAT_KEY_ENABLE)
+    keycode = record->keycode;
+#endif
+    bool full = record->event.type != KEY_EVENT || tap || keycode || index > UINT8_MAX;
+
+    data[length++] = (record->event.pressed ? DYNAMIC_MACRO_PRESSED : 0) | (full ? DYNAMIC_MACRO_FULL_RECORD : 0) | (delay > DYNAMIC_MACRO_DELAY_MASK ? DYNAMIC_MACRO_MORE_DELAY : 0) | (delay & DYNAMIC_MACRO_DELAY_MASK);
+    for (delay >>= 5; delay; delay >>= 7) {
+        data[length++] = (delay > 0x7F ? 0x80 : 0) | (delay & 0x7F);
+    }
+
+    if (full) {
+        data[length++] = record->event.type;
+        data[length++] = record->event.key.row;
+        data[length++] = record->event.key.col;
+        data[length++] = tap;
+#if defined(COMBO_ENABLE) || defined(REPEAT_KEY_ENABLE)
+        data[length++] = keycode & 0xFF;
+        data[length++] = keycode >> 8;
+#endif
+    } else {
+        data[length++] = index;
+    }
+    return length;
+}
+
+/**
+ * Read the next byte of a macro.
+ *
+ * @param[in]     direction Either +1 or -1, which macro to read.
+ * @param[in,out] offset    The position of the byte, moved past it.
+ * @param[in]     length    The length of the macro.
+ * @param[out]    data      The byte.
+ * @return false if the macro ends before the byte.
+ */
+static inline bool dynamic_macro_read(int8_t direction, uint16_t *offset, uint16_t length, uint8_t *data) {
+    if (*offset >= length) {
+        return false;
+    }
+    *data = *dynamic_macro_byte(direction, (*offset)++);
+    return true;
+}
+
+/**
+ * Decode a key event.
+ *
+ * @param[in]     direction Either +1 or -1, which macro to read.
+ * @param[in,out] offset    The position of the event in the macro, moved to the next event.
+ * @param[in]     length    The length of the macro.
+ * @param[out]    record    The key event, without its time.
+ * @param[out]    delay     The time since the previous event, in milliseconds.
+ * @return false if the event is cut short by the end of the macro, or
+ *         is not one dynamic_macro_encode() could have written.
+ */
+static bool dynamic_macro_decode(int8_t direction, uint16_t *offset, uint16_t length, keyrecord_t *record, uint16_t *delay) {
+    uint8_t header, data;
+    if (!dynamic_macro_read(direction, offset, length, &header)) {
+        return false;
+    }
+
+    *delay = header & DYNAMIC_MACRO_DELAY_MASK;
+    for (uint8_t shift = 5, more = header & DYNAMIC_MACRO_MORE_DELAY; more; shift += 7) {
+        // The delay is 16 bits, so at most two more bytes of it
+        if (shift >= 16 || !dynamic_macro_read(direction, offset, length, &data)) {
+            return false;
+        }
+        *delay |= (uint16_t)(data & 0x7F) << shift;
+        more = data & 0x80;
+    }
+
+    memset(record, 0, sizeof(keyrecord_t));
+    record->event.pressed = header & DYNAMIC_MACRO_PRESSED;
+    if (header & DYNAMIC_MACRO_FULL_RECORD) {
+        uint8_t full[DYNAMIC_MACRO_FULL_RECORD_SIZE];
+        for (uint8_t i = 0; i < sizeof(full); i++) {
+            if (!dynamic_macro_read(direction, offset, length, &full[i])) {
+                return false;
+            }
+        }
+        record->event.type    = full[0];
+        record->event.key.row = full[1];
+        record->event.key.col = full[2];
+#ifndef NO_ACTION_TAPPING
+        memcpy(&record->tap, &full[3], sizeof(record->tap));
+#endif
+#if defined(COMBO_ENABLE) || defined(REPEAT_KEY_ENABLE)
+        record->keycode = full[4] | full[5] << 8;
+#endif
+    } else {
+        if (!dynamic_macro_read(direction, offset, length, &data)) {
+            return false;
+        }
+        record->event.type = KEY_EVENT;
+        record->event.key  = MAKE_KEYPOS(data / MATRIX_COLS, data % MATRIX_COLS);
+    }
+
+    // Key events index the keymap by their position
+    return record->event.type != KEY_EVENT || (record->event.key.row < MATRIX_ROWS && record->event.key.col < MATRIX_COLS);
+}
+
+/**
+ * Save a macro to non-volatile memory, if enabled.
+ *
+ * @param direction[in] Either +1 or -1, which macro to save.
+ */
+static void dynamic_macro_save(int8_t direction) {
+#ifdef DYNAMIC_MACRO_PERSISTENT
+    uint16_t length = macro_length[DYNAMIC_MACRO_CURRENT_INDEX()];
+    uint16_t offset = direction > 0 ? 0 : DYNAMIC_MACRO_BUFFER_SIZE - length;
+
+    // The macro reads as empty until it is completely written
+    nvm_dynamic_macro_update_length(DYNAMIC_MACRO_CURRENT_INDEX(), 0);
+    nvm_dynamic_macro_update_buffer(offset, length, &macro_buffer[offset]);
+    nvm_dynamic_macro_update_crc(DYNAMIC_MACRO_CURRENT_INDEX(), crc8(&macro_buffer[offset], length));
+    nvm_dynamic_macro_update_length(DYNAMIC_MACRO_CURRENT_INDEX(), length);
+#endif
+}
 
 /**
  * Start recording of the dynamic macro.
  *
- * @param[out] macro_pointer The new macro buffer iterator.
- * @param[in]  macro_buffer  The macro buffer used to initialize macro_pointer.
+ * @param direction[in] Either +1 or -1, which macro to record.
  */
-void dynamic_macro_record_start(keyrecord_t **macro_pointer, keyrecord_t *macro_buffer, int8_t direction) {
+void dynamic_macro_record_start(int8_t direction) {
     dprintln("dynamic macro recording: started");
 
+    dynamic_macro_stop_playing();
     dynamic_macro_record_start_kb(direction);
 
     clear_keyboard();
     layer_clear();
-    *macro_pointer = macro_buffer;
+    macro_length[DYNAMIC_MACRO_CURRENT_INDEX()] = 0;
+    record_length                               = 0;
+    record_full                                 = false;
 }
 
 /**
- * Play the dynamic macro.
+ * Play the dynamic macro. The events are played by dynamic_macro_task(),
+ * at the time they were recorded, or DYNAMIC_MACRO_DELAY apart if it is
+ * defined.
  *
- * @param macro_buffer[in] The beginning of the macro buffer being played.
- * @param macro_end[in]    The element after the last macro buffer element.
- * @param direction[in]    Either +1 or -1, which way to iterate the buffer.
+ * @param direction[in] Either +1 or -1, which macro to play.
  */
-void dynamic_macro_play(keyrecord_t *macro_buffer, keyrecord_t *macro_end, int8_t direction) {
+void dynamic_macro_play(int8_t direction) {
     dprintf("dynamic macro: slot %d playback\n", DYNAMIC_MACRO_CURRENT_SLOT());
 
-    layer_state_t saved_layer_state = layer_state;
+    for (uint8_t i = 0; i < playback_depth; i++) {
+        if (playback[i].direction == direction) {
+            dprintln("dynamic macro: ignoring a macro playing itself");
+            return;
+        }
+    }
+    if (playback_depth == DYNAMIC_MACRO_PLAYBACK_DEPTH) {
+        dprintln("dynamic macro: ignoring macro play key while playing");
+        return;
+    }
+
+    dynamic_macro_playback_t *current = &playback[playback_depth++];
+
+    current->direction         = direction;
+    current->offset            = 0;
+    current->time              = playing_event ? playback_time : timer_read32();
+    current->saved_layer_state = layer_state;
 
     clear_keyboard();
     layer_clear();
 
-    while (macro_buffer != macro_end) {
-        process_record(macro_buffer);
-        macro_buffer += direction;
-#ifdef DYNAMIC_MACRO_DELAY
-        wait_ms(DYNAMIC_MACRO_DELAY);
-#endif
-    }
+    task_deadline_wake(TASK_DEADLINE_DYNAMIC_MACRO);
+}
+
+/**
+ * End the playback of the innermost macro being played.
+ */
+static void dynamic_macro_play_end(void) {
+    dynamic_macro_playback_t *current = &playback[--playback_depth];
 
     clear_keyboard();
 
-    layer_state_set(saved_layer_state);
+    layer_state_set(current->saved_layer_state);
+
+    /* The macro that played this one carries on from its end. */
+    if (playback_depth > 0) {
+        playback[playback_depth - 1].time = current->time;
+    }
 
-    dynamic_macro_play_kb(direction);
+    dynamic_macro_play_kb(current->direction);
 }
 
 /**
  * Record a single key in a dynamic macro.
  *
- * @param macro_buffer[in] The start of the used macro buffer.
- * @param macro_pointer[in,out] The current buffer position.
- * @param macro2_end[in] The end of the other macro.
- * @param direction[in]  Either +1 or -1, which way to iterate the buffer.
+ * @param direction[in]  Either +1 or -1, which macro is being recorded.
  * @param record[in]     The current keypress.
  */
-void dynamic_macro_record_key(keyrecord_t *macro_buffer, keyrecord_t **macro_pointer, keyrecord_t *macro2_end, int8_t direction, keyrecord_t *record) {
+void dynamic_macro_record_key(int8_t direction, keyrecord_t *record) {
     /* If we've just started recording, ignore all the key releases. */
-    if (!record->event.pressed && *macro_pointer == macro_buffer) {
+    if (!record->event.pressed && record_length == 0) {
         dprintln("dynamic macro: ignoring a leading key-up event");
         return;
     }
 
-    /* The other end of the other macro is the last buffer element it
-     * is safe to use before overwriting the other macro.
+    uint8_t  event[DYNAMIC_MACRO_EVENT_MAX_SIZE];
+    uint16_t delay  = record_length == 0 ? 0 : TIMER_DIFF_16(record->event.time, record_time);
+    uint8_t  length = dynamic_macro_encode(record, delay, event);
+
+    /* The end of the other macro is the last buffer byte it is safe
+     * to use before overwriting the other macro. Once an event does
+     * not fit, the following ones are not recorded either, even if
+     * they are shorter.
      */
-    if (*macro_pointer - direction != macro2_end) {
-        **macro_pointer = *record;
-        *macro_pointer += direction;
+    record_full = record_full || record_length + length > DYNAMIC_MACRO_CURRENT_CAPACITY();
+    if (!record_full) {
+        for (uint8_t i = 0; i < length; i++) {
+            *dynamic_macro_byte(direction, record_length++) = event[i];
+        }
+        record_time = record->event.time;
     }
     dynamic_macro_record_key_kb(direction, record);
 
-    dprintf("dynamic macro: slot %d length: %d/%d\n", DYNAMIC_MACRO_CURRENT_SLOT(), DYNAMIC_MACRO_CURRENT_LENGTH(macro_buffer, *macro_pointer), DYNAMIC_MACRO_CURRENT_CAPACITY(macro_buffer, macro2_end));
+    dprintf("dynamic macro: slot %d length: %d/%d\n", DYNAMIC_MACRO_CURRENT_SLOT(), record_length, DYNAMIC_MACRO_CURRENT_CAPACITY());
 }
 
 /**
  * End recording of the dynamic macro. Essentially just update the
- * pointer to the end of the macro.
+ * length of the macro, and save it.
+ *
+ * @param direction[in] Either +1 or -1, which macro is being recorded.
  */
-void dynamic_macro_record_end(keyrecord_t *macro_buffer, keyrecord_t *macro_pointer, int8_t direction, keyrecord_t **macro_end) {
+void dynamic_macro_record_end(int8_t direction) {
     dynamic_macro_record_end_kb(direction);
 
     /* Do not save the keys being held when stopping the recording,
-     * i.e. the keys used to access the layer DM_RSTP is on.
+     * i.e. the keys used to access the layer DM_RSTP is on, so the
+     * macro ends with the last key-up event.
      */
-    while (macro_pointer != macro_buffer && (macro_pointer - direction)->event.pressed) {
-        dprintln("dynamic macro: trimming a trailing key-down event");
-        macro_pointer -= direction;
+    uint16_t    length = 0;
+    keyrecord_t record;
+    uint16_t    delay;
+    for (uint16_t offset = 0; offset < record_length && dynamic_macro_decode(direction, &offset, record_length, &record, &delay);) {
+        if (!record.event.pressed) {
+            length = offset;
+        }
+    }
+    if (length != record_length) {
+        dprintln("dynamic macro: trimming trailing key-down events");
     }
 
-    dprintf("dynamic macro: slot %d saved, length: %d\n", DYNAMIC_MACRO_CURRENT_SLOT(), DYNAMIC_MACRO_CURRENT_LENGTH(macro_buffer, macro_pointer));
+    dprintf("dynamic macro: slot %d saved, length: %d\n", DYNAMIC_MACRO_CURRENT_SLOT(), length);
 
-    *macro_end = macro_pointer;
+    macro_length[DYNAMIC_MACRO_CURRENT_INDEX()] = length;
+    dynamic_macro_save(direction);
 }
 
-/* Both macros use the same buffer but read/write on different
- * ends of it.
- *
- * Macro1 is written left-to-right starting from the beginning of
- * the buffer.
- *
- * Macro2 is written right-to-left starting from the end of the
- * buffer.
- *
- * &macro_buffer   macro_end
- *  v                   v
- * +------------------------------------------------------------+
- * |>>>>>> MACRO1 >>>>>>      <<<<<<<<<<<<< MACRO2 <<<<<<<<<<<<<|
- * +------------------------------------------------------------+
- *                           ^                                 ^
- *                         r_macro_end                  r_macro_buffer
- *
- * During the recording when one macro encounters the end of the
- * other macro, the recording is stopped. Apart from this, there
- * are no arbitrary limits for the macros' length in relation to
- * each other: for example one can either have two medium sized
- * macros or one long macro and one short macro. Or even one empty
- * and one using the whole buffer.
- */
-static keyrecord_t macro_buffer[DYNAMIC_MACRO_SIZE];
-
-/* Pointer to the first buffer element after the first macro.
- * Initially points to the very beginning of the buffer since the
- * macro is empty. */
-static keyrecord_t *macro_end = macro_buffer;
-
-/* The other end of the macro buffer. Serves as the beginning of
- * the second macro. */
-static keyrecord_t *const r_macro_buffer = macro_buffer + DYNAMIC_MACRO_SIZE - 1;
-
-/* Like macro_end but for the second macro. */
-static keyrecord_t *r_macro_end = macro_buffer + DYNAMIC_MACRO_SIZE - 1;
-
-/* A persistent pointer to the current macro position (iterator)
- * used during the recording. */
-static keyrecord_t *macro_pointer = NULL;
-
-/* 0   - no macro is being recorded right now
- * 1,2 - either macro 1 or 2 is being recorded */
-static uint8_t macro_id = 0;
-
 /**
  * If a dynamic macro is currently being recorded, stop recording.
  */
 void dynamic_macro_stop_recording(void) {
     switch (macro_id) {
         case 1:
-            dynamic_macro_record_end(macro_buffer, macro_pointer, +1, &macro_end);
+            dynamic_macro_record_end(+1);
             break;
         case 2:
-            dynamic_macro_record_end(r_macro_buffer, macro_pointer, -1, &r_macro_end);
+            dynamic_macro_record_end(-1);
             break;
     }
     macro_id = 0;
 }
 
+/**
+ * If dynamic macros are currently being played, stop playing them.
+ */
+void dynamic_macro_stop_playing(void) {
+    while (playback_depth > 0) {
+        dynamic_macro_play_end();
+    }
+}
+
+bool dynamic_macro_is_playing(void) {
+    return playback_depth > 0;
+}
+
+/**
+ * Clear both macros, and load them from non-volatile memory if enabled.
+ */
+void dynamic_macro_init(void) {
+    macro_id        = 0;
+    playback_depth  = 0;
+    macro_length[0] = 0;
+    macro_length[1] = 0;
+#ifdef DYNAMIC_MACRO_PERSISTENT
+    uint16_t length1 = nvm_dynamic_macro_read_length(0);
+    uint16_t length2 = nvm_dynamic_macro_read_length(1);
+    if (length1 + length2 > DYNAMIC_MACRO_BUFFER_SIZE) {
+        dprintln("dynamic macro: ignoring invalid saved macros");
+        return;
+    }
+
+    nvm_dynamic_macro_read_buffer(0, length1, macro_buffer);
+    nvm_dynamic_macro_read_buffer(DYNAMIC_MACRO_BUFFER_SIZE - length2, length2, &macro_buffer[DYNAMIC_MACRO_BUFFER_SIZE - length2]);
+    macro_length[0] = length1;
+    macro_length[1] = length2;
+
+    // Either macro may have been corrupted while saving it or since
+    if (length1 > 0 && crc8(macro_buffer, length1) != nvm_dynamic_macro_read_crc(0)) {
+        dprintln("dynamic macro: ignoring corrupt saved macro 1");
+        macro_length[0] = 0;
+    }
+    if (length2 > 0 && crc8(&macro_buffer[DYNAMIC_MACRO_BUFFER_SIZE - length2], length2) != nvm_dynamic_macro_read_crc(1)) {
+        dprintln("dynamic macro: ignoring corrupt saved macro 2");
+        macro_length[1] = 0;
+    }
+#endif
+}
+
+/**
+ * Play the events that are due of the macros being played.
+ */
+void dynamic_macro_task(void) {
+    uint32_t now = timer_read32();
+
+    while (playback_depth > 0) {
+        dynamic_macro_playback_t *current   = &playback[playback_depth - 1];
+        int8_t                    direction = current->direction;
+
+        if (current->offset >= macro_length[DYNAMIC_MACRO_CURRENT_INDEX()]) {
+            dynamic_macro_play_end();
+            continue;
+        }
+
+        keyrecord_t record;
+        uint16_t    delay;
+        uint16_t    next = current->offset;
+        if (!dynamic_macro_decode(direction, &next, macro_length[DYNAMIC_MACRO_CURRENT_INDEX()], &record, &delay)) {
+            dprintf("dynamic macro: slot %d is corrupt, stopping\n", DYNAMIC_MACRO_CURRENT_SLOT());
+            dynamic_macro_play_end();
+            continue;
+        }
+#ifdef DYNAMIC_MACRO_DELAY
+        delay = current->offset == 0 ? 0 : DYNAMIC_MACRO_DELAY;
+#endif
+        uint32_t due = current->time + delay;
+        if (!timer_expired32(now, due)) {
+            task_deadline_defer(TASK_DEADLINE_DYNAMIC_MACRO, due - now);
+            return;
+        }
+
+        current->offset   = next;
+        current->time     = due;
+        record.event.time = timer_read();
+
+        playing_event = true;
+        playback_time = due;
+        process_record(&record);
+        playing_event = false;
+    }
+
+    task_deadline_sleep(TASK_DEADLINE_DYNAMIC_MACRO);
+}
+
 /* Handle the key events related to the dynamic macros.
  */
 bool process_dynamic_macro(uint16_t keycode, keyrecord_t *record) {
@@ -252,18 +572,18 @@ bool process_dynamic_macro(uint16_t keycode, keyrecord_t *record) {
         if (!record->event.pressed) {
             switch (keycode) {
                 case QK_DYNAMIC_MACRO_RECORD_START_1:
-                    dynamic_macro_record_start(&macro_pointer, macro_buffer, +1);
+                    dynamic_macro_record_start(+1);
                     macro_id = 1;
                     return false;
                 case QK_DYNAMIC_MACRO_RECORD_START_2:
-                    dynamic_macro_record_start(&macro_pointer, r_macro_buffer, -1);
+                    dynamic_macro_record_start(-1);
                     macro_id = 2;
                     return false;
                 case QK_DYNAMIC_MACRO_PLAY_1:
-                    dynamic_macro_play(macro_buffer, macro_end, +1);
+                    dynamic_macro_play(+1);
                     return false;
                 case QK_DYNAMIC_MACRO_PLAY_2:
-                    dynamic_macro_play(r_macro_buffer, r_macro_end, -1);
+                    dynamic_macro_play(-1);
                     return false;
             }
         }
@@ -291,10 +611,10 @@ bool process_dynamic_macro(uint16_t keycode, keyrecord_t *record) {
                     /* Store the key in the macro buffer and process it normally. */
                     switch (macro_id) {
                         case 1:
-                            dynamic_macro_record_key(macro_buffer, &macro_pointer, r_macro_end, +1, record);
+                            dynamic_macro_record_key(+1, record);
                             break;
                         case 2:
-                            dynamic_macro_record_key(r_macro_buffer, &macro_pointer, macro_end, -1, record);
+                            dynamic_macro_record_key(-1, record);
                             break;
                     }
                 }
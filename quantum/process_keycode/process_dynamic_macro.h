@@ -35,6 +35,23 @@
 #    define DYNAMIC_MACRO_SIZE 128
 #endif
 
+/* Events are delta-timed and stored in a few bytes each, three for a
+ * key pressed or released up to 4095 ms after the previous one.
+ * The buffer is sized so that DYNAMIC_MACRO_SIZE such events fit.
+ */
+#ifndef DYNAMIC_MACRO_BUFFER_SIZE
+#    define DYNAMIC_MACRO_BUFFER_SIZE (DYNAMIC_MACRO_SIZE * 3)
+#endif
+
+/* How many macros can be played at once, when a macro plays the other
+ * one.
+ */
+#ifdef DYNAMIC_MACRO_NO_NESTING
+#    define DYNAMIC_MACRO_PLAYBACK_DEPTH 1
+#else
+#    define DYNAMIC_MACRO_PLAYBACK_DEPTH 2
+#endif
+
 void dynamic_macro_led_blink(void);
 bool process_dynamic_macro(uint16_t keycode, keyrecord_t *record);
 bool dynamic_macro_record_start_kb(int8_t direction);
@@ -48,3 +65,7 @@ bool dynamic_macro_record_end_user(int8_t direction);
 bool dynamic_macro_valid_key_kb(uint16_t keycode, keyrecord_t *record);
 bool dynamic_macro_valid_key_user(uint16_t keycode, keyrecord_t *record);
 void dynamic_macro_stop_recording(void);
+void dynamic_macro_stop_playing(void);
+bool dynamic_macro_is_playing(void);
+void dynamic_macro_init(void);
+void dynamic_macro_task(void);
@@ -24,6 +24,7 @@
 #include "quantum.h"
 #include "quantum_keycodes.h"
 #include "keymap_introspection.h"
+#include "task_deadline.h"
 
 #ifndef KEY_OVERRIDE_REPEAT_DELAY
 #    define KEY_OVERRIDE_REPEAT_DELAY 500
@@ -155,6 +156,7 @@ static void schedule_deferred_register(const uint16_t keycode) {
         defer_delay          = 50; // 50ms
     }
     deferred_register = keycode;
+    task_deadline_wake(TASK_DEADLINE_KEY_OVERRIDE);
 }
 
 const key_override_t *clear_active_override(const bool allow_reregister) {
@@ -393,16 +395,21 @@ static bool try_activating_override(const uint16_t keycode, const uint8_t layer,
 
 void key_override_task(void) {
     if (deferred_register == 0) {
+        task_deadline_sleep(TASK_DEADLINE_KEY_OVERRIDE);
         return;
     }
 
-    if (timer_elapsed32(defer_reference_time) >= defer_delay) {
+    uint32_t elapsed = timer_elapsed32(defer_reference_time);
+    if (elapsed >= defer_delay) {
         key_override_printf("Registering deferred key\n");
         register_code16(deferred_register);
         deferred_register    = 0;
         defer_reference_time = 0;
         defer_delay          = 0;
+        task_deadline_sleep(TASK_DEADLINE_KEY_OVERRIDE);
+        return;
     }
+    task_deadline_defer(TASK_DEADLINE_KEY_OVERRIDE, defer_delay - elapsed);
 }
 
 bool process_key_override(const uint16_t keycode, const keyrecord_t *const record) {
@@ -22,6 +22,7 @@
 #include "timer.h"
 #include "wait.h"
 #include "keymap_introspection.h"
+#include "task_deadline.h"
 
 static uint16_t active_td;
 static uint16_t last_tap_time;
@@ -167,6 +168,7 @@ bool process_tap_dance(uint16_t keycode, keyrecord_t *record) {
                 last_tap_time = timer_read();
                 process_tap_dance_action_on_each_tap(action);
                 active_td = action->state.finished ? 0 : keycode;
+                task_deadline_wake(TASK_DEADLINE_TAP_DANCE);
             } else {
                 process_tap_dance_action_on_each_release(action);
                 if (action->state.finished) {
@@ -186,12 +188,24 @@ bool process_tap_dance(uint16_t keycode, keyrecord_t *record) {
 void tap_dance_task(void) {
     tap_dance_action_t *action;
 
-    if (!active_td || timer_elapsed(last_tap_time) <= GET_TAPPING_TERM(active_td, &(keyrecord_t){})) return;
+    if (!active_td) {
+        task_deadline_sleep(TASK_DEADLINE_TAP_DANCE);
+        return;
+    }
+
+    uint16_t elapsed = timer_elapsed(last_tap_time);
+    uint16_t term    = GET_TAPPING_TERM(active_td, &(keyrecord_t){});
+    if (elapsed <= term) {
+        task_deadline_defer(TASK_DEADLINE_TAP_DANCE, term + 1 - elapsed);
+        return;
+    }
 
     action = tap_dance_get(QK_TAP_DANCE_GET_INDEX(active_td));
     if (!action->state.interrupted) {
         process_tap_dance_action_on_dance_finished(action);
     }
+    // Once the dance has timed out only another key event can change its state.
+    task_deadline_sleep(TASK_DEADLINE_TAP_DANCE);
 }
 
 void reset_tap_dance(tap_dance_state_t *state) {
@@ -179,6 +179,10 @@ extern layer_state_t layer_state;
 #    include "dip_switch.h"
 #endif
 
+#ifdef SLIDER_ENABLE
+#    include "slider.h"
+#endif
+
 #ifdef DYNAMIC_MACRO_ENABLE
 #    include "process_dynamic_macro.h"
 #endif
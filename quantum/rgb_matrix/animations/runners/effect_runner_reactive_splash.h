@@ -6,23 +6,28 @@ typedef hsv_t (*reactive_splash_f)(hsv_t hsv, int16_t dx, int16_t dy, uint8_t di
 
 bool effect_runner_reactive_splash(uint8_t start, effect_params_t* params, reactive_splash_f effect_func) {
     RGB_MATRIX_USE_LIMITS(led_min, led_max);
+    rgb_matrix_hsv_batch_t batch = {.count = 0};
 
-    uint8_t count = g_last_hit_tracker.count;
+    uint8_t  count = g_last_hit_tracker.count;
+    uint8_t  speed = qadd8(rgb_matrix_config.speed, 1);
+    uint16_t ticks[LED_HITS_TO_REMEMBER];
+    for (uint8_t j = start; j < count; j++) {
+        ticks[j] = scale16by8(g_last_hit_tracker.tick[j], speed);
+    }
     for (uint8_t i = led_min; i < led_max; i++) {
         RGB_MATRIX_TEST_LED_FLAGS();
         hsv_t hsv = rgb_matrix_config.hsv;
         hsv.v     = 0;
         for (uint8_t j = start; j < count; j++) {
-            int16_t  dx   = g_led_config.point[i].x - g_last_hit_tracker.x[j];
-            int16_t  dy   = g_led_config.point[i].y - g_last_hit_tracker.y[j];
-            uint8_t  dist = sqrt16(dx * dx + dy * dy);
-            uint16_t tick = scale16by8(g_last_hit_tracker.tick[j], qadd8(rgb_matrix_config.speed, 1));
-            hsv           = effect_func(hsv, dx, dy, dist, tick);
+            int16_t dx   = g_led_config.point[i].x - g_last_hit_tracker.x[j];
+            int16_t dy   = g_led_config.point[i].y - g_last_hit_tracker.y[j];
+            uint8_t dist = sqrt16(dx * dx + dy * dy);
+            hsv          = effect_func(hsv, dx, dy, dist, ticks[j]);
         }
-        hsv.v     = scale8(hsv.v, rgb_matrix_config.hsv.v);
-        rgb_t rgb = rgb_matrix_hsv_to_rgb(hsv);
-        rgb_matrix_set_color(i, rgb.r, rgb.g, rgb.b);
+        hsv.v = scale8(hsv.v, rgb_matrix_config.hsv.v);
+        rgb_matrix_hsv_batch_add(&batch, i, hsv);
     }
+    rgb_matrix_hsv_batch_finish(&batch);
     return rgb_matrix_check_finished_leds(led_max);
 }
 
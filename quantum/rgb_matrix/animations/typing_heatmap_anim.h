@@ -1,25 +1,26 @@
 #if defined(RGB_MATRIX_FRAMEBUFFER_EFFECTS) && defined(ENABLE_RGB_MATRIX_TYPING_HEATMAP)
 RGB_MATRIX_EFFECT(TYPING_HEATMAP)
 #    ifdef RGB_MATRIX_CUSTOM_EFFECT_IMPLS
-#        ifndef RGB_MATRIX_TYPING_HEATMAP_INCREASE_STEP
-#            define RGB_MATRIX_TYPING_HEATMAP_INCREASE_STEP 32
-#        endif
-
 #        ifndef RGB_MATRIX_TYPING_HEATMAP_DECREASE_DELAY_MS
 #            define RGB_MATRIX_TYPING_HEATMAP_DECREASE_DELAY_MS 25
 #        endif
-
-#        ifndef RGB_MATRIX_TYPING_HEATMAP_SPREAD
-#            define RGB_MATRIX_TYPING_HEATMAP_SPREAD 40
-#        endif
-
-#        ifndef RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT
-#            define RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT 16
-#        endif
 void process_rgb_matrix_typing_heatmap(uint8_t row, uint8_t col) {
 #        ifdef RGB_MATRIX_TYPING_HEATMAP_SLIM
     // Limit effect to pressed keys
     g_rgb_frame_buffer[row][col] = qadd8(g_rgb_frame_buffer[row][col], RGB_MATRIX_TYPING_HEATMAP_INCREASE_STEP);
+#        elif defined(RGB_MATRIX_TYPING_HEATMAP_NEIGHBOURS)
+    // Only visit the keys within spread, the pressed key being one of them
+    uint16_t key = row * MATRIX_COLS + col;
+    uint16_t end = pgm_read_word(&g_typing_heatmap_neighbours_start[key + 1]);
+    for (uint16_t i = pgm_read_word(&g_typing_heatmap_neighbours_start[key]); i < end; i++) {
+        uint8_t i_row  = pgm_read_byte(&g_typing_heatmap_neighbours[i].row);
+        uint8_t i_col  = pgm_read_byte(&g_typing_heatmap_neighbours[i].col);
+        uint8_t amount = pgm_read_byte(&g_typing_heatmap_neighbours[i].amount);
+        if (i_row == row && i_col == col) {
+            amount = RGB_MATRIX_TYPING_HEATMAP_INCREASE_STEP;
+        }
+        g_rgb_frame_buffer[i_row][i_col] = qadd8(g_rgb_frame_buffer[i_row][i_col], amount);
+    }
 #        else
     if (g_led_config.matrix_co[row][col] == NO_LED) { // skip as pressed key doesn't have an led position
         return;
@@ -27,3 +27,17 @@
     defined(ENABLE_RGB_MATRIX_SOLID_MULTISPLASH)
 #    define RGB_MATRIX_KEYPRESSES
 #endif
+
+// distance and angle of every LED from the center
+#if !defined(RGB_MATRIX_NO_LED_POLAR) && ( \
+    defined(ENABLE_RGB_MATRIX_CYCLE_OUT_IN) || \
+    defined(ENABLE_RGB_MATRIX_CYCLE_PINWHEEL) || \
+    defined(ENABLE_RGB_MATRIX_CYCLE_SPIRAL) || \
+    defined(ENABLE_RGB_MATRIX_BAND_PINWHEEL_SAT) || \
+    defined(ENABLE_RGB_MATRIX_BAND_PINWHEEL_VAL) || \
+    defined(ENABLE_RGB_MATRIX_BAND_SPIRAL_SAT) || \
+    defined(ENABLE_RGB_MATRIX_BAND_SPIRAL_VAL) || \
+    defined(RGB_MATRIX_CUSTOM_KB) || \
+    defined(RGB_MATRIX_CUSTOM_USER))
+#    define RGB_MATRIX_LED_POLAR
+#endif
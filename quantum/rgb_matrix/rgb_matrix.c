@@ -38,6 +38,33 @@ __attribute__((weak)) rgb_t rgb_matrix_hsv_to_rgb(hsv_t hsv) {
     return hsv_to_rgb(hsv);
 }
 
+/* Used by the effect runners, which convert RGB_MATRIX_HSV_BATCH_SIZE LEDs at a time. */
+__attribute__((weak)) void rgb_matrix_hsv_to_rgb_array(const hsv_t *hsv, rgb_t *rgb, uint8_t count) {
+    for (uint8_t i = 0; i < count; i++) {
+        rgb[i] = rgb_matrix_hsv_to_rgb(hsv[i]);
+    }
+}
+
+/* Sets the LEDs waiting in the batch. */
+void rgb_matrix_hsv_batch_finish(rgb_matrix_hsv_batch_t *batch) {
+    rgb_t rgb[RGB_MATRIX_HSV_BATCH_SIZE];
+
+    rgb_matrix_hsv_to_rgb_array(batch->hsv, rgb, batch->count);
+    for (uint8_t i = 0; i < batch->count; i++) {
+        rgb_matrix_set_color(batch->index[i], rgb[i].r, rgb[i].g, rgb[i].b);
+    }
+    batch->count = 0;
+}
+
+/* Queues the colour of an LED, setting the batch once it is full. */
+void rgb_matrix_hsv_batch_add(rgb_matrix_hsv_batch_t *batch, uint8_t index, hsv_t hsv) {
+    batch->index[batch->count] = index;
+    batch->hsv[batch->count]   = hsv;
+    if (++batch->count == RGB_MATRIX_HSV_BATCH_SIZE) {
+        rgb_matrix_hsv_batch_finish(batch);
+    }
+}
+
 // Generic effect runners
 #include "rgb_matrix_runners.inc"
 
@@ -71,6 +98,9 @@ uint8_t g_rgb_frame_buffer[MATRIX_ROWS][MATRIX_COLS] = {{0}};
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
 last_hit_t g_last_hit_tracker;
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
+#ifdef RGB_MATRIX_LED_POLAR
+led_polar_t g_led_polar;
+#endif // RGB_MATRIX_LED_POLAR
 
 // internals
 static bool            suspend_state     = false;
@@ -85,6 +115,16 @@ static uint32_t rgb_timer_buffer;
 static last_hit_t last_hit_buffer;
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
 
+// dirty tracking
+static rgb_matrix_flush_stats_t rgb_flush_stats;
+#ifndef RGB_MATRIX_NO_DIRTY_TRACKING
+/* The colour last set on every LED, and the colour it had when last flushed. An LED set to another colour and
+ * back within a frame has not changed. */
+static rgb_t rgb_colors[RGB_MATRIX_LED_COUNT];
+static rgb_t rgb_flushed[RGB_MATRIX_LED_COUNT];
+static bool  rgb_flush_all = true;
+#endif // RGB_MATRIX_NO_DIRTY_TRACKING
+
 // split rgb matrix
 #if defined(RGB_MATRIX_SPLIT)
 const uint8_t k_rgb_matrix_split[2] = RGB_MATRIX_SPLIT;
@@ -159,6 +199,11 @@ __attribute__((weak)) int rgb_matrix_led_index(int index) {
 }
 
 void rgb_matrix_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
+#ifndef RGB_MATRIX_NO_DIRTY_TRACKING
+    if (index >= 0 && index < RGB_MATRIX_LED_COUNT) {
+        rgb_colors[index] = (rgb_t){.r = red, .g = green, .b = blue};
+    }
+#endif // RGB_MATRIX_NO_DIRTY_TRACKING
     rgb_matrix_driver.set_color(rgb_matrix_led_index(index), red, green, blue);
 }
 
@@ -167,10 +212,66 @@ void rgb_matrix_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
     for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++)
         rgb_matrix_set_color(i, red, green, blue);
 #else
+#    ifndef RGB_MATRIX_NO_DIRTY_TRACKING
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        rgb_colors[i] = (rgb_t){.r = red, .g = green, .b = blue};
+    }
+#    endif // RGB_MATRIX_NO_DIRTY_TRACKING
     rgb_matrix_driver.set_color_all(red, green, blue);
 #endif
 }
 
+/* Forgets what was flushed last, so that the next frame is flushed whole. */
+static void rgb_matrix_invalidate_flush(void) {
+#ifndef RGB_MATRIX_NO_DIRTY_TRACKING
+    rgb_flush_all = true;
+#endif // RGB_MATRIX_NO_DIRTY_TRACKING
+}
+
+/* Flushes the LEDs that changed since the last frame, if any. */
+static void rgb_matrix_flush_changed(void) {
+    rgb_flush_stats.frames++;
+#ifndef RGB_MATRIX_NO_DIRTY_TRACKING
+    bool changed = false;
+#    if !defined(RGB_MATRIX_SPLIT)
+    // The driver knows the changed LEDs by the indexes rgb_matrix_led_index() gives them
+    int start = RGB_MATRIX_LED_COUNT;
+    int end   = 0;
+#    endif
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        if (memcmp(&rgb_colors[i], &rgb_flushed[i], sizeof(rgb_t)) != 0) {
+            rgb_flushed[i] = rgb_colors[i];
+            changed        = true;
+#    if !defined(RGB_MATRIX_SPLIT)
+            int led = rgb_matrix_led_index(i);
+            start   = MIN(start, led);
+            end     = MAX(end, led + 1);
+#    endif
+        }
+    }
+    if (!changed && !rgb_flush_all) {
+        rgb_flush_stats.skipped++;
+        return;
+    }
+
+#    if !defined(RGB_MATRIX_SPLIT)
+    if (!rgb_flush_all && rgb_matrix_driver.flush_range && start >= 0 && end <= RGB_MATRIX_LED_COUNT && (start > 0 || end < RGB_MATRIX_LED_COUNT)) {
+        rgb_matrix_driver.flush_range(start, end);
+        rgb_flush_stats.partial++;
+        rgb_flush_stats.leds += end - start;
+        return;
+    }
+#    endif
+    rgb_flush_all = false;
+#endif // RGB_MATRIX_NO_DIRTY_TRACKING
+    rgb_matrix_update_pwm_buffers();
+    rgb_flush_stats.leds += RGB_MATRIX_LED_COUNT;
+}
+
+rgb_matrix_flush_stats_t rgb_matrix_get_flush_stats(void) {
+    return rgb_flush_stats;
+}
+
 void rgb_matrix_handle_key_event(uint8_t row, uint8_t col, bool pressed) {
 #ifndef RGB_MATRIX_SPLIT
     if (!is_keyboard_master()) return;
@@ -367,8 +468,8 @@ static void rgb_task_flush(uint8_t effect) {
     rgb_last_effect = effect;
     rgb_last_enable = rgb_matrix_config.enable;
 
-    // update pwm buffers
-    rgb_matrix_update_pwm_buffers();
+    // update pwm buffers, if anything changed
+    rgb_matrix_flush_changed();
 
     // next task
     rgb_task_state = SYNCING;
@@ -477,8 +578,21 @@ __attribute__((weak)) bool rgb_matrix_indicators_advanced_user(uint8_t led_min,
     return true;
 }
 
+void rgb_matrix_update_led_polar(void) {
+#ifdef RGB_MATRIX_LED_POLAR
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        int16_t dx           = g_led_config.point[i].x - k_rgb_matrix_center.x;
+        int16_t dy           = g_led_config.point[i].y - k_rgb_matrix_center.y;
+        g_led_polar.dist[i]  = sqrt16(dx * dx + dy * dy);
+        g_led_polar.angle[i] = atan2_8(dy, dx);
+    }
+#endif // RGB_MATRIX_LED_POLAR
+}
+
 void rgb_matrix_init(void) {
     rgb_matrix_driver.init();
+    rgb_matrix_invalidate_flush();
+    rgb_matrix_update_led_polar();
 
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
     g_last_hit_tracker.count = 0;
@@ -506,6 +620,9 @@ void rgb_matrix_set_suspend_state(bool state) {
         rgb_task_render(0);        // turn off all LEDs when suspending
         rgb_task_flush(0);         // and actually flash led state to LEDs
     }
+    if (!state && suspend_state) { // the LEDs may have lost power while suspended
+        rgb_matrix_invalidate_flush();
+    }
     suspend_state = state;
 #endif
 }
@@ -24,6 +24,7 @@
 #include "rgb_matrix_drivers.h"
 #include "color.h"
 #include "keyboard.h"
+#include "progmem.h"
 
 #ifndef RGB_MATRIX_TIMEOUT
 #    define RGB_MATRIX_TIMEOUT 0
@@ -90,6 +91,28 @@
 #    define RGB_MATRIX_LED_PROCESS_LIMIT ((RGB_MATRIX_LED_COUNT + 4) / 5)
 #endif
 
+#ifndef RGB_MATRIX_TYPING_HEATMAP_INCREASE_STEP
+#    define RGB_MATRIX_TYPING_HEATMAP_INCREASE_STEP 32
+#endif
+
+#ifndef RGB_MATRIX_TYPING_HEATMAP_SPREAD
+#    define RGB_MATRIX_TYPING_HEATMAP_SPREAD 40
+#endif
+
+#ifndef RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT
+#    define RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT 16
+#endif
+
+// How much the typing heatmap heats up a key at the given distance from the pressed key
+#define RGB_MATRIX_TYPING_HEATMAP_AMOUNT(distance) ((distance) >= RGB_MATRIX_TYPING_HEATMAP_SPREAD ? 0 : RGB_MATRIX_TYPING_HEATMAP_SPREAD - (distance) > RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT ? RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT : RGB_MATRIX_TYPING_HEATMAP_SPREAD - (distance))
+
+// The keys near every key are generated with g_led_config, up to RGB_MATRIX_TYPING_HEATMAP_NEIGHBOURS_SPREAD apart
+#if defined(ENABLE_RGB_MATRIX_TYPING_HEATMAP) && defined(RGB_MATRIX_TYPING_HEATMAP_NEIGHBOURS_SPREAD) && !defined(RGB_MATRIX_TYPING_HEATMAP_NO_NEIGHBOURS) && !defined(RGB_MATRIX_TYPING_HEATMAP_SLIM)
+#    if RGB_MATRIX_TYPING_HEATMAP_SPREAD <= RGB_MATRIX_TYPING_HEATMAP_NEIGHBOURS_SPREAD
+#        define RGB_MATRIX_TYPING_HEATMAP_NEIGHBOURS
+#    endif
+#endif
+
 struct rgb_matrix_limits_t {
     uint8_t led_min_index;
     uint8_t led_max_index;
@@ -172,6 +195,18 @@ bool rgb_matrix_indicators_advanced_user(uint8_t led_min, uint8_t led_max);
 
 void rgb_matrix_init(void);
 
+/**
+ * Recomputes the distance and angle of every LED from the center, only needed after
+ * changing the LED positions in g_led_config at runtime.
+ */
+void rgb_matrix_update_led_polar(void);
+
+/**
+ * Counts the frames rendered, and how many of them were skipped or only partially flushed
+ * as their LEDs did not change.
+ */
+rgb_matrix_flush_stats_t rgb_matrix_get_flush_stats(void);
+
 void rgb_matrix_reload_from_eeprom(void);
 
 void        rgb_matrix_set_suspend_state(bool state);
@@ -287,6 +322,14 @@ extern led_config_t g_led_config;
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
 extern last_hit_t g_last_hit_tracker;
 #endif
+#ifdef RGB_MATRIX_LED_POLAR
+extern led_polar_t g_led_polar;
+#endif
 #ifdef RGB_MATRIX_FRAMEBUFFER_EFFECTS
 extern uint8_t g_rgb_frame_buffer[MATRIX_ROWS][MATRIX_COLS];
 #endif
+#ifdef RGB_MATRIX_TYPING_HEATMAP_NEIGHBOURS
+// The neighbours of the key at row * MATRIX_COLS + col start at that index of g_typing_heatmap_neighbours_start
+extern const uint16_t                   g_typing_heatmap_neighbours_start[MATRIX_ROWS * MATRIX_COLS + 1] PROGMEM;
+extern const typing_heatmap_neighbour_t g_typing_heatmap_neighbours[] PROGMEM;
+#endif
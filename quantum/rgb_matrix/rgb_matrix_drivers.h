@@ -46,6 +46,8 @@ typedef struct {
     void (*set_color_all)(uint8_t r, uint8_t g, uint8_t b);
     /* Flush any buffered changes to the hardware. */
     void (*flush)(void);
+    /* Optional, flush the LEDs from start up to, not including, end. The others did not change since the last flush. */
+    void (*flush_range)(int start, int end);
 } rgb_matrix_driver_t;
 
 extern const rgb_matrix_driver_t rgb_matrix_driver;
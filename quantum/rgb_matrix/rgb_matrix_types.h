@@ -75,6 +75,38 @@ typedef struct PACKED {
     uint8_t     flags[RGB_MATRIX_LED_COUNT];
 } led_config_t;
 
+// Distance and angle of every LED from k_rgb_matrix_center, as computed by sqrt16() and atan2_8()
+typedef struct {
+    uint8_t dist[RGB_MATRIX_LED_COUNT];
+    uint8_t angle[RGB_MATRIX_LED_COUNT];
+} led_polar_t;
+
+// A key near a pressed key, and how much the typing heatmap heats it up
+typedef struct PACKED {
+    uint8_t row;
+    uint8_t col;
+    uint8_t amount;
+} typing_heatmap_neighbour_t;
+
+typedef struct {
+    uint32_t frames;  // frames rendered
+    uint32_t skipped; // frames not flushed, as no LED changed
+    uint32_t partial; // frames flushed with flush_range(), as only some LEDs changed
+    uint32_t leds;    // LEDs flushed in total
+} rgb_matrix_flush_stats_t;
+
+// Each LED is set straight away, unless rgb_matrix_hsv_to_rgb_array() is overridden to convert several at once
+#ifndef RGB_MATRIX_HSV_BATCH_SIZE
+#    define RGB_MATRIX_HSV_BATCH_SIZE 1
+#endif
+
+// LEDs whose colours are converted to RGB together, see rgb_matrix_hsv_batch_add()
+typedef struct {
+    uint8_t count;
+    uint8_t index[RGB_MATRIX_HSV_BATCH_SIZE];
+    hsv_t   hsv[RGB_MATRIX_HSV_BATCH_SIZE];
+} rgb_matrix_hsv_batch_t;
+
 typedef union rgb_config_t {
     uint64_t raw;
     struct PACKED {
@@ -4,6 +4,7 @@
 #include "secure.h"
 #include "timer.h"
 #include "util.h"
+#include "task_deadline.h"
 
 #ifndef SECURE_UNLOCK_TIMEOUT
 #    define SECURE_UNLOCK_TIMEOUT 5000
@@ -42,6 +43,7 @@ void secure_unlock(void) {
     secure_status = SECURE_UNLOCKED;
     idle_time     = timer_read32();
     secure_hook(secure_status);
+    task_deadline_wake(TASK_DEADLINE_SECURE);
 }
 
 void secure_request_unlock(void) {
@@ -50,11 +52,13 @@ void secure_request_unlock(void) {
         unlock_time   = timer_read32();
     }
     secure_hook(secure_status);
+    task_deadline_wake(TASK_DEADLINE_SECURE);
 }
 
 void secure_activity_event(void) {
     if (secure_status == SECURE_UNLOCKED) {
         idle_time = timer_read32();
+        task_deadline_wake(TASK_DEADLINE_SECURE);
     }
 }
 
@@ -79,8 +83,12 @@ void secure_task(void) {
 #if SECURE_UNLOCK_TIMEOUT != 0
     // handle unlock timeout
     if (secure_status == SECURE_PENDING) {
-        if (timer_elapsed32(unlock_time) >= SECURE_UNLOCK_TIMEOUT) {
+        uint32_t elapsed = timer_elapsed32(unlock_time);
+        if (elapsed >= SECURE_UNLOCK_TIMEOUT) {
             secure_lock();
+        } else {
+            task_deadline_defer(TASK_DEADLINE_SECURE, SECURE_UNLOCK_TIMEOUT - elapsed);
+            return;
         }
     }
 #endif
@@ -88,11 +96,17 @@ void secure_task(void) {
 #if SECURE_IDLE_TIMEOUT != 0
     // handle idle timeout
     if (secure_status == SECURE_UNLOCKED) {
-        if (timer_elapsed32(idle_time) >= SECURE_IDLE_TIMEOUT) {
+        uint32_t elapsed = timer_elapsed32(idle_time);
+        if (elapsed >= SECURE_IDLE_TIMEOUT) {
             secure_lock();
+        } else {
+            task_deadline_defer(TASK_DEADLINE_SECURE, SECURE_IDLE_TIMEOUT - elapsed);
+            return;
         }
     }
 #endif
+
+    task_deadline_sleep(TASK_DEADLINE_SECURE);
 }
 
 __attribute__((weak)) bool secure_hook_user(secure_status_t secure_status) {
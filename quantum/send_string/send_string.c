@@ -193,19 +193,15 @@ void send_string_with_delay_impl(char (*getter)(void *), void *arg, uint8_t inte
     }
 }
 
-typedef struct send_string_memory_state_t {
-    const char *string;
-} send_string_memory_state_t;
-
 char send_string_get_next_ram(void *arg) {
-    send_string_memory_state_t *state = (send_string_memory_state_t *)arg;
-    char                        ret   = *state->string;
+    send_string_state_t *state = (send_string_state_t *)arg;
+    char                 ret   = *state->string;
     state->string++;
     return ret;
 }
 
 void send_string_with_delay(const char *string, uint8_t interval) {
-    send_string_memory_state_t state = {string};
+    send_string_state_t state = {.string = string};
     send_string_with_delay_impl(send_string_get_next_ram, &state, interval);
 }
 
@@ -315,14 +311,262 @@ void send_string_P(const char *string) {
 }
 
 char send_string_get_next_progmem(void *arg) {
-    send_string_memory_state_t *state = (send_string_memory_state_t *)arg;
-    char                        ret   = pgm_read_byte(state->string);
+    send_string_state_t *state = (send_string_state_t *)arg;
+    char                 ret   = pgm_read_byte(state->string);
     state->string++;
     return ret;
 }
 
 void send_string_with_delay_P(const char *string, uint8_t interval) {
-    send_string_memory_state_t state = {string};
+    send_string_state_t state = {.string = string};
     send_string_with_delay_impl(send_string_get_next_progmem, &state, interval);
 }
 #endif
+
+#ifdef SEND_STRING_ASYNC_ENABLE
+#    include "deferred_exec.h"
+#    include "task_deadline.h"
+#    include "timer.h"
+#    include "util.h"
+
+// Shift, AltGr, the key itself and a space after a dead key, each pressed then released
+#    define SEND_STRING_ASYNC_MAX_STEPS 8
+// Set in a step that releases its key rather than pressing it
+#    define STEP_RELEASE 0x100
+
+typedef struct {
+    char (*getter)(void *);
+    send_string_state_t       state;
+    send_string_done_callback done;
+    void                     *cb_arg;
+    uint8_t                   interval;
+    bool                      ended; // The getter already returned the terminating NUL
+} send_string_job_t;
+
+static send_string_job_t   jobs[SEND_STRING_ASYNC_QUEUE_SIZE];
+static uint8_t             jobs_head;
+static uint8_t             jobs_count;
+static uint16_t            steps[SEND_STRING_ASYNC_MAX_STEPS]; // Presses and releases of the character being typed
+static uint8_t             steps_count;
+static uint8_t             steps_index;
+static deferred_executor_t send_string_executors[1];
+static deferred_token      send_string_token = INVALID_DEFERRED_TOKEN;
+static uint32_t            last_send_string_exec;
+static uint32_t            next_step_time;
+
+/** Removes the string being sent from the queue, and reports it as done. */
+static void send_string_async_finish(void) {
+    send_string_job_t job = jobs[jobs_head];
+
+    jobs_head = (jobs_head + 1) % SEND_STRING_ASYNC_QUEUE_SIZE;
+    jobs_count--;
+    steps_count = 0;
+    steps_index = 0;
+    if (job.done) {
+        job.done(job.cb_arg);
+    }
+}
+
+static void send_string_async_add_step(uint16_t step) {
+    steps[steps_count++] = step;
+}
+
+/**
+ * \brief Reads the next character of the string being sent into `steps`.
+ *
+ * Mirrors send_string_with_delay_impl() and send_char_with_delay(), which send the same keys with blocking waits.
+ *
+ * \param delay Set to the length of an SS_DELAY() read instead of a character.
+ * \return false once the string has ended.
+ */
+static bool send_string_async_load(uint32_t *delay) {
+    send_string_job_t *job = &jobs[jobs_head];
+
+    steps_count = 0;
+    steps_index = 0;
+    if (job->ended) {
+        return false;
+    }
+
+    char ascii_code = job->getter(&job->state);
+    if (!ascii_code) {
+        return false;
+    }
+
+    if (ascii_code == SS_QMK_PREFIX) {
+        ascii_code = job->getter(&job->state);
+
+        if (ascii_code == SS_TAP_CODE) {
+            uint8_t keycode = job->getter(&job->state);
+            send_string_async_add_step(keycode);
+            send_string_async_add_step(keycode | STEP_RELEASE);
+        } else if (ascii_code == SS_DOWN_CODE) {
+            uint8_t keycode = job->getter(&job->state);
+            send_string_async_add_step(keycode);
+        } else if (ascii_code == SS_UP_CODE) {
+            uint8_t keycode = job->getter(&job->state);
+            send_string_async_add_step(keycode | STEP_RELEASE);
+        } else if (ascii_code == SS_DELAY_CODE) {
+            uint32_t ms = 0;
+            ascii_code  = job->getter(&job->state);
+
+            while (isdigit(ascii_code)) {
+                ms *= 10;
+                ms += ascii_code - '0';
+                ascii_code = job->getter(&job->state);
+            }
+
+            *delay = ms;
+        }
+
+        // if we had a delay that terminated with a null, we're done after it
+        job->ended = ascii_code == 0;
+        return true;
+    }
+
+#    if defined(AUDIO_ENABLE) && defined(SENDSTRING_BELL)
+    if (ascii_code == '\a') { // BEL
+        PLAY_SONG(bell_song);
+        return true;
+    }
+#    endif
+
+    uint8_t keycode    = pgm_read_byte(&ascii_to_keycode_lut[(uint8_t)ascii_code]);
+    bool    is_shifted = PGM_LOADBIT(ascii_to_shift_lut, (uint8_t)ascii_code);
+    bool    is_altgred = PGM_LOADBIT(ascii_to_altgr_lut, (uint8_t)ascii_code);
+    bool    is_dead    = PGM_LOADBIT(ascii_to_dead_lut, (uint8_t)ascii_code);
+
+    if (is_shifted) {
+        send_string_async_add_step(KC_LEFT_SHIFT);
+    }
+    if (is_altgred) {
+        send_string_async_add_step(KC_RIGHT_ALT);
+    }
+    send_string_async_add_step(keycode);
+    send_string_async_add_step(keycode | STEP_RELEASE);
+    if (is_altgred) {
+        send_string_async_add_step(KC_RIGHT_ALT | STEP_RELEASE);
+    }
+    if (is_shifted) {
+        send_string_async_add_step(KC_LEFT_SHIFT | STEP_RELEASE);
+    }
+    if (is_dead) {
+        send_string_async_add_step(KC_SPACE);
+        send_string_async_add_step(KC_SPACE | STEP_RELEASE);
+    }
+    return true;
+}
+
+/** Deferred executor pressing or releasing one key of the queued strings per call. */
+static uint32_t send_string_async_step(uint32_t trigger_time, void *cb_arg) {
+    uint32_t delay = 0;
+
+    // Move on to the next character once every key of the previous one is released
+    while (steps_index == steps_count) {
+        if (jobs_count == 0) {
+            send_string_token = INVALID_DEFERRED_TOKEN;
+            return 0;
+        }
+        if (!send_string_async_load(&delay)) {
+            send_string_async_finish();
+            continue;
+        }
+        if (steps_count == 0) {
+            break;
+        }
+    }
+
+    uint8_t interval = jobs[jobs_head].interval;
+    if (steps_index < steps_count) {
+        uint16_t step = steps[steps_index++];
+        if (step & STEP_RELEASE) {
+            unregister_code(step & 0xFF);
+        } else {
+            register_code(step);
+            if (step == KC_CAPS_LOCK && interval < TAP_HOLD_CAPS_DELAY) {
+                interval = TAP_HOLD_CAPS_DELAY;
+            }
+        }
+    }
+
+    delay += interval;
+    if (delay == 0) {
+        delay = 1;
+    }
+    next_step_time = trigger_time + delay;
+    return delay;
+}
+
+bool send_string_with_delay_impl_async(char (*getter)(void *), const send_string_state_t *state, uint8_t interval, send_string_done_callback done, void *cb_arg) {
+    if (jobs_count == SEND_STRING_ASYNC_QUEUE_SIZE) {
+        return false;
+    }
+
+    send_string_job_t *job = &jobs[(jobs_head + jobs_count) % SEND_STRING_ASYNC_QUEUE_SIZE];
+    job->getter            = getter;
+    job->state             = *state;
+    job->done              = done;
+    job->cb_arg            = cb_arg;
+    job->interval          = interval;
+    job->ended             = false;
+    jobs_count++;
+
+    if (send_string_token == INVALID_DEFERRED_TOKEN) {
+        send_string_token = defer_exec_advanced(send_string_executors, ARRAY_SIZE(send_string_executors), 1, send_string_async_step, NULL);
+        next_step_time    = timer_read32() + 1;
+        // The last run may be so long ago that it looks like it is in the future
+        last_send_string_exec = timer_read32() - 1;
+    }
+    task_deadline_wake(TASK_DEADLINE_SEND_STRING);
+    return true;
+}
+
+bool send_string_async(const char *string) {
+    return send_string_with_delay_async(string, TAP_CODE_DELAY);
+}
+
+bool send_string_with_delay_async(const char *string, uint8_t interval) {
+    send_string_state_t state = {.string = string};
+    return send_string_with_delay_impl_async(send_string_get_next_ram, &state, interval, NULL, NULL);
+}
+
+#    if defined(__AVR__)
+bool send_string_with_delay_P_async(const char *string, uint8_t interval) {
+    send_string_state_t state = {.string = string};
+    return send_string_with_delay_impl_async(send_string_get_next_progmem, &state, interval, NULL, NULL);
+}
+#    endif
+
+bool send_string_async_busy(void) {
+    return jobs_count > 0;
+}
+
+void send_string_async_cancel(void) {
+    // Release what the character being typed still holds
+    while (steps_index < steps_count) {
+        uint16_t step = steps[steps_index++];
+        if (step & STEP_RELEASE) {
+            unregister_code(step & 0xFF);
+        }
+    }
+
+    cancel_deferred_exec_advanced(send_string_executors, ARRAY_SIZE(send_string_executors), send_string_token);
+    send_string_token = INVALID_DEFERRED_TOKEN;
+
+    // Strings queued from the done callbacks are kept
+    for (uint8_t count = jobs_count; count > 0; count--) {
+        send_string_async_finish();
+    }
+}
+
+void send_string_task(void) {
+    deferred_exec_advanced_task(send_string_executors, ARRAY_SIZE(send_string_executors), &last_send_string_exec);
+
+    if (send_string_token == INVALID_DEFERRED_TOKEN) {
+        task_deadline_sleep(TASK_DEADLINE_SEND_STRING);
+    } else {
+        int32_t remaining = (int32_t)TIMER_DIFF_32(next_step_time, timer_read32());
+        task_deadline_defer(TASK_DEADLINE_SEND_STRING, remaining > 0 ? remaining : 0);
+    }
+}
+#endif // SEND_STRING_ASYNC_ENABLE
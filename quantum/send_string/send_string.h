@@ -23,6 +23,9 @@
  * \{
  */
 
+#pragma once
+
+#include <stdbool.h>
 #include <stdint.h>
 
 #include "progmem.h"
@@ -161,6 +164,14 @@ void send_string_with_delay_P(const char *string, uint8_t interval);
  */
 #define SEND_STRING_DELAY(string, interval) send_string_with_delay_P(PSTR(string), interval)
 
+/**
+ * \brief Position of a getter in its source, for the getters provided by QMK.
+ */
+typedef union send_string_state_t {
+    const char *string; // RAM and PROGMEM strings
+    uint32_t    offset; // Dynamic keymap macros in NVM
+} send_string_state_t;
+
 /**
  * \brief Actual implementation function that iterates and sends the string returned by the getter function.
  *
@@ -169,4 +180,78 @@ void send_string_with_delay_P(const char *string, uint8_t interval);
  */
 void send_string_with_delay_impl(char (*getter)(void *), void *arg, uint8_t interval);
 
+#if defined(SEND_STRING_ASYNC_ENABLE) || defined(__DOXYGEN__)
+
+// Number of strings that can be queued at once, including the one being sent
+#    ifndef SEND_STRING_ASYNC_QUEUE_SIZE
+#        define SEND_STRING_ASYNC_QUEUE_SIZE 4
+#    endif
+
+/**
+ * \brief Called once a queued string has been sent completely, or has been cancelled.
+ *
+ * \param cb_arg The argument given when queueing the string.
+ */
+typedef void (*send_string_done_callback)(void *cb_arg);
+
+/**
+ * \brief Queue a string to be typed out from the main loop, without blocking.
+ *
+ * One key is pressed or released per `interval` milliseconds, at least one per millisecond, while the main loop keeps
+ * scanning the matrix. The string is read as it is typed, so it must stay valid until `done` is called.
+ *
+ * \param getter Same as for send_string_with_delay_impl(), called with a copy of `state`.
+ * \param state The position of the getter in its source.
+ * \param interval The amount of time, in milliseconds, to wait between key presses and releases.
+ * \param done Called once the string has been sent, may be NULL.
+ * \param cb_arg The argument to pass to `done`.
+ * \return false if the queue is full.
+ */
+bool send_string_with_delay_impl_async(char (*getter)(void *), const send_string_state_t *state, uint8_t interval, send_string_done_callback done, void *cb_arg);
+
+/**
+ * \brief Queue a string to be typed out from the main loop, see send_string_with_delay_impl_async().
+ *
+ * This function simply calls `send_string_with_delay_async(string, TAP_CODE_DELAY)`.
+ */
+bool send_string_async(const char *string);
+
+/**
+ * \brief Queue a string to be typed out from the main loop, see send_string_with_delay_impl_async().
+ */
+bool send_string_with_delay_async(const char *string, uint8_t interval);
+
+#    if defined(__AVR__) || defined(__DOXYGEN__)
+/**
+ * \brief Queue a PROGMEM string to be typed out from the main loop, see send_string_with_delay_impl_async().
+ */
+bool send_string_with_delay_P_async(const char *string, uint8_t interval);
+#    else
+#        define send_string_with_delay_P_async(string, interval) send_string_with_delay_async(string, interval)
+#    endif
+
+/**
+ * \brief Shortcut macro for send_string_with_delay_P_async(PSTR(string), 0).
+ */
+#    define SEND_STRING_ASYNC(string) send_string_with_delay_P_async(PSTR(string), 0)
+
+/**
+ * \brief Whether a queued string is still being typed out.
+ */
+bool send_string_async_busy(void);
+
+/**
+ * \brief Stop typing out queued strings.
+ *
+ * The keys held by the character being typed are released, and the `done` callbacks of all queued strings are called.
+ */
+void send_string_async_cancel(void);
+
+/**
+ * \brief Types out the next key of the queued strings when it is due. Called from the main loop.
+ */
+void send_string_task(void);
+
+#endif // defined(SEND_STRING_ASYNC_ENABLE) || defined(__DOXYGEN__)
+
 /** \} */
@@ -0,0 +1,261 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "slider.h"
+#include "compiler_support.h"
+#include "eeconfig.h"
+#include "task_deadline.h"
+#include "timer.h"
+
+#ifdef SLIDER_ANALOG
+#    include "analog.h"
+#endif
+
+#if NUM_SLIDERS == 0
+#    error "Either SLIDER_PINS or SLIDER_COUNT must be defined."
+#endif
+
+STATIC_ASSERT(SLIDER_RESOLUTION >= 2 && SLIDER_RESOLUTION <= 256, "SLIDER_RESOLUTION must be between 2 and 256");
+STATIC_ASSERT(SLIDER_ADC_MAX <= 4095, "SLIDER_ADC_MAX must fit 12 bits");
+STATIC_ASSERT(SLIDER_FILTER_BETA <= UINT16_MAX, "SLIDER_FILTER_BETA is too large");
+
+// 1 / (2 * pi) Hz, in mHz * ms
+#define FILTER_TIME_CONSTANT 159155
+// Fractional bits of the filtered values
+#define FILTER_SHIFT 8
+// Beyond 1 kHz the filter hardly smooths at all, and the cutoff frequency no longer matters
+#define FILTER_MAX_CUTOFF 1000000
+
+#ifdef SLIDER_PINS
+static pin_t slider_pins[] = SLIDER_PINS;
+#endif
+
+typedef struct {
+    int32_t  value;      // ADC value, with FILTER_SHIFT fractional bits
+    int32_t  derivative; // ADC value per second, with FILTER_SHIFT fractional bits
+    uint16_t calibration_low;
+    uint16_t calibration_high;
+    uint8_t  position;
+    bool     calibrating;
+    bool     initialized;
+} slider_state_t;
+
+static slider_state_t       slider_state[NUM_SLIDERS];
+static slider_calibration_t slider_calibration[NUM_SLIDERS];
+static uint32_t             last_sample_time;
+
+__attribute__((weak)) uint16_t slider_sample(uint8_t index) {
+#ifdef SLIDER_ANALOG
+    return analogReadPin(slider_pins[index]);
+#else
+    return 0;
+#endif
+}
+
+__attribute__((weak)) bool slider_update_user(uint8_t index, uint8_t position) {
+    return true;
+}
+
+__attribute__((weak)) bool slider_update_kb(uint8_t index, uint8_t position) {
+    return slider_update_user(index, position);
+}
+
+static bool slider_calibration_is_valid(const slider_calibration_t *calibration) {
+    return calibration->min < calibration->max && calibration->max <= SLIDER_ADC_MAX;
+}
+
+void eeconfig_update_slider_default(void) {
+    slider_calibration_t calibration = {.min = SLIDER_CALIBRATION_DEFAULT_MIN, .max = SLIDER_CALIBRATION_DEFAULT_MAX};
+    for (uint8_t i = 0; i < NUM_SLIDERS; i++) {
+        eeconfig_update_slider_calibration(i, &calibration);
+    }
+}
+
+/** \brief Smoothing factor of a first order low-pass filter, with 16 fractional bits.
+ *
+ * alpha = 1 / (1 + tau / dt), with tau = 1 / (2 * pi * cutoff).
+ */
+static uint32_t filter_alpha(uint32_t cutoff_mhz, uint32_t dt_ms) {
+    uint32_t w = cutoff_mhz * dt_ms;
+    return (uint32_t)(((uint64_t)w << 16) / (w + FILTER_TIME_CONSTANT));
+}
+
+static int32_t filter_step(int32_t previous, int32_t target, uint32_t alpha) {
+    return previous + (int32_t)(((int64_t)(target - previous) * alpha) >> 16);
+}
+
+/** \brief Adaptive low-pass filter, following the 1 euro filter.
+ *
+ * The cutoff frequency rises with the speed of the slider: at rest the noise is
+ * filtered heavily, while moving the slider hardly lags.
+ */
+static void slider_filter(slider_state_t *state, uint16_t raw, uint32_t dt_ms) {
+    int32_t x = (int32_t)raw << FILTER_SHIFT;
+
+    if (!state->initialized) {
+        state->value      = x;
+        state->derivative = 0;
+        return;
+    }
+
+    int32_t speed     = (x - state->value) * 1000 / (int32_t)dt_ms;
+    state->derivative = filter_step(state->derivative, speed, filter_alpha(SLIDER_FILTER_DERIVATIVE_CUTOFF, dt_ms));
+
+    // Speed in full travels per second, with 8 fractional bits
+    uint32_t travel = (uint32_t)(state->derivative < 0 ? -state->derivative : state->derivative) / SLIDER_ADC_MAX;
+    if (travel > UINT16_MAX) {
+        travel = UINT16_MAX;
+    }
+    uint32_t cutoff = SLIDER_FILTER_MIN_CUTOFF + ((SLIDER_FILTER_BETA * travel) >> 8);
+    if (cutoff > FILTER_MAX_CUTOFF) {
+        cutoff = FILTER_MAX_CUTOFF;
+    }
+    state->value = filter_step(state->value, x, filter_alpha(cutoff, dt_ms));
+}
+
+/** \brief Maps the filtered value to a position, with 8 fractional bits. */
+static uint32_t slider_exact_position(uint8_t index) {
+    const slider_calibration_t *calibration = &slider_calibration[index];
+    int32_t                     offset      = slider_state[index].value - ((int32_t)calibration->min << FILTER_SHIFT);
+    int32_t                     span        = (int32_t)(calibration->max - calibration->min) << FILTER_SHIFT;
+
+    if (offset <= 0) {
+        return 0;
+    }
+    if (offset >= span) {
+        return SLIDER_RESOLUTION * 256 - 1;
+    }
+    return (uint32_t)offset * SLIDER_RESOLUTION / (calibration->max - calibration->min);
+}
+
+static void slider_update(uint8_t index, uint32_t dt_ms) {
+    slider_state_t *state = &slider_state[index];
+    uint16_t        raw   = slider_sample(index);
+
+    if (raw > SLIDER_ADC_MAX) {
+        raw = SLIDER_ADC_MAX;
+    }
+    slider_filter(state, raw, dt_ms);
+
+    if (state->calibrating) {
+        uint16_t value = state->value >> FILTER_SHIFT;
+        if (value < state->calibration_low) {
+            state->calibration_low = value;
+        }
+        if (value > state->calibration_high) {
+            state->calibration_high = value;
+        }
+    }
+
+    uint32_t exact = slider_exact_position(index);
+    if (!state->initialized) {
+        state->position    = exact >> 8;
+        state->initialized = true;
+        return;
+    }
+
+    // Only move to a neighbouring position once the slider is well past the boundary
+    int32_t lower = (int32_t)state->position * 256 - SLIDER_HYSTERESIS;
+    int32_t upper = ((int32_t)state->position + 1) * 256 + SLIDER_HYSTERESIS;
+    if ((int32_t)exact < lower || (int32_t)exact >= upper) {
+        state->position = exact >> 8;
+        slider_update_kb(index, state->position);
+    }
+}
+
+uint8_t slider_get_position(uint8_t index) {
+    if (index >= NUM_SLIDERS) return 0;
+    return slider_state[index].position;
+}
+
+uint16_t slider_get_value(uint8_t index) {
+    if (index >= NUM_SLIDERS) return 0;
+    return slider_state[index].value >> FILTER_SHIFT;
+}
+
+uint16_t slider_get_fraction(uint8_t index) {
+    if (index >= NUM_SLIDERS) return 0;
+    const slider_calibration_t *calibration = &slider_calibration[index];
+    int32_t                     offset      = slider_state[index].value - ((int32_t)calibration->min << FILTER_SHIFT);
+    int32_t                     span        = (int32_t)(calibration->max - calibration->min) << FILTER_SHIFT;
+
+    if (offset <= 0) {
+        return 0;
+    }
+    if (offset >= span) {
+        return UINT16_MAX;
+    }
+    return (uint64_t)offset * UINT16_MAX / span;
+}
+
+void slider_calibration_start(uint8_t index) {
+    if (index >= NUM_SLIDERS) return;
+    slider_state_t *state   = &slider_state[index];
+    state->calibrating      = true;
+    state->calibration_low  = SLIDER_ADC_MAX;
+    state->calibration_high = 0;
+}
+
+bool slider_calibration_end(uint8_t index) {
+    if (index >= NUM_SLIDERS || !slider_state[index].calibrating) return false;
+    slider_state_t *state = &slider_state[index];
+    state->calibrating    = false;
+
+    if (state->calibration_low > state->calibration_high || state->calibration_high - state->calibration_low < SLIDER_CALIBRATION_MIN_SPAN) {
+        return false;
+    }
+
+    slider_calibration_t calibration = {.min = state->calibration_low, .max = state->calibration_high};
+    slider_set_calibration(index, &calibration);
+    return true;
+}
+
+void slider_get_calibration(uint8_t index, slider_calibration_t *calibration) {
+    if (index >= NUM_SLIDERS) return;
+    *calibration = slider_calibration[index];
+}
+
+void slider_set_calibration(uint8_t index, const slider_calibration_t *calibration) {
+    if (index >= NUM_SLIDERS || !slider_calibration_is_valid(calibration)) return;
+    slider_calibration[index] = *calibration;
+    eeconfig_update_slider_calibration(index, calibration);
+}
+
+void slider_init(void) {
+    for (uint8_t i = 0; i < NUM_SLIDERS; i++) {
+        eeconfig_read_slider_calibration(i, &slider_calibration[i]);
+        if (!slider_calibration_is_valid(&slider_calibration[i])) {
+            slider_calibration[i].min = SLIDER_CALIBRATION_DEFAULT_MIN;
+            slider_calibration[i].max = SLIDER_CALIBRATION_DEFAULT_MAX;
+        }
+        slider_state[i].initialized = false;
+        slider_state[i].calibrating = false;
+        // The first sample sets the initial position
+        slider_update(i, SLIDER_SAMPLE_INTERVAL);
+    }
+    last_sample_time = timer_read32();
+}
+
+void slider_task(void) {
+    uint32_t now     = timer_read32();
+    uint32_t elapsed = TIMER_DIFF_32(now, last_sample_time);
+
+    if (elapsed < SLIDER_SAMPLE_INTERVAL) {
+        task_deadline_defer(TASK_DEADLINE_SLIDER, SLIDER_SAMPLE_INTERVAL - elapsed);
+        return;
+    }
+    last_sample_time = now;
+
+    // The speed estimate needs a sensible time step, even after a long stall
+    if (elapsed > UINT8_MAX) {
+        elapsed = UINT8_MAX;
+    }
+    for (uint8_t i = 0; i < NUM_SLIDERS; i++) {
+        slider_update(i, elapsed);
+    }
+#ifdef SLIDER_MIDI_ENABLE
+    // New samples may have moved a controller
+    task_deadline_wake(TASK_DEADLINE_SLIDER_MIDI);
+#endif
+    task_deadline_defer(TASK_DEADLINE_SLIDER, SLIDER_SAMPLE_INTERVAL);
+}
@@ -0,0 +1,131 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "gpio.h"
+#include "util.h"
+
+#if defined(SLIDER_PINS)
+#    define NUM_SLIDERS ARRAY_SIZE(((pin_t[])SLIDER_PINS))
+#elif defined(SLIDER_COUNT)
+#    define NUM_SLIDERS SLIDER_COUNT
+#endif
+
+#ifndef NUM_SLIDERS
+#    define NUM_SLIDERS 0
+#endif
+
+// Number of positions reported, from 0 to SLIDER_RESOLUTION - 1
+#ifndef SLIDER_RESOLUTION
+#    define SLIDER_RESOLUTION 128
+#endif
+
+// Largest value returned by slider_sample()
+#ifndef SLIDER_ADC_MAX
+#    define SLIDER_ADC_MAX 1023
+#endif
+
+// Milliseconds between two samples of every slider
+#ifndef SLIDER_SAMPLE_INTERVAL
+#    define SLIDER_SAMPLE_INTERVAL 5
+#endif
+
+// Cutoff frequency of the filter while the slider rests, in mHz
+#ifndef SLIDER_FILTER_MIN_CUTOFF
+#    define SLIDER_FILTER_MIN_CUTOFF 1000
+#endif
+
+// Increase of the cutoff frequency with the slider speed, in mHz per full travel per second
+#ifndef SLIDER_FILTER_BETA
+#    define SLIDER_FILTER_BETA 20000
+#endif
+
+// Cutoff frequency of the filter smoothing the slider speed, in mHz
+#ifndef SLIDER_FILTER_DERIVATIVE_CUTOFF
+#    define SLIDER_FILTER_DERIVATIVE_CUTOFF 1000
+#endif
+
+// How far the slider has to move past a position boundary before the position changes, in 1/256 of a position
+#ifndef SLIDER_HYSTERESIS
+#    define SLIDER_HYSTERESIS 96
+#endif
+
+// Travel of every slider until it is calibrated, in ADC units
+#ifndef SLIDER_CALIBRATION_DEFAULT_MIN
+#    define SLIDER_CALIBRATION_DEFAULT_MIN 0
+#endif
+#ifndef SLIDER_CALIBRATION_DEFAULT_MAX
+#    define SLIDER_CALIBRATION_DEFAULT_MAX SLIDER_ADC_MAX
+#endif
+
+// Smallest travel, in ADC units, accepted by slider_calibration_end()
+#ifndef SLIDER_CALIBRATION_MIN_SPAN
+#    define SLIDER_CALIBRATION_MIN_SPAN (SLIDER_ADC_MAX / 4)
+#endif
+
+/**
+ * \brief Raw ADC values read at both ends of a slider's travel.
+ */
+typedef struct slider_calibration_t {
+    uint16_t min;
+    uint16_t max;
+} slider_calibration_t;
+
+/**
+ * \brief Reads the raw ADC value of a slider, between 0 and SLIDER_ADC_MAX.
+ *
+ * Reads the matching pin of SLIDER_PINS with the analog driver, and needs to be
+ * implemented by the keyboard when `SLIDER_DRIVER = custom`.
+ */
+uint16_t slider_sample(uint8_t index);
+
+/**
+ * \brief Called whenever the position of a slider changes.
+ *
+ * Not called for the first sample, taken by slider_init(), which only sets the initial position.
+ */
+bool slider_update_kb(uint8_t index, uint8_t position);
+bool slider_update_user(uint8_t index, uint8_t position);
+
+/**
+ * \brief Gets the current position of a slider, between 0 and SLIDER_RESOLUTION - 1.
+ */
+uint8_t slider_get_position(uint8_t index);
+
+/**
+ * \brief Gets the filtered ADC value of a slider.
+ */
+uint16_t slider_get_value(uint8_t index);
+
+/**
+ * \brief Gets the filtered and calibrated position of a slider, as a fraction of its travel from 0 to UINT16_MAX.
+ *
+ * Unlike slider_get_position(), the fraction has no hysteresis and follows every change of the filtered value.
+ */
+uint16_t slider_get_fraction(uint8_t index);
+
+/**
+ * \brief Starts recording the range of a slider. Move it to both ends, then call slider_calibration_end().
+ */
+void slider_calibration_start(uint8_t index);
+
+/**
+ * \brief Stops recording the range of a slider and stores it in EEPROM.
+ *
+ * \return false, keeping the previous calibration, if the recorded travel is shorter than SLIDER_CALIBRATION_MIN_SPAN
+ */
+bool slider_calibration_end(uint8_t index);
+
+void slider_get_calibration(uint8_t index, slider_calibration_t *calibration);
+void slider_set_calibration(uint8_t index, const slider_calibration_t *calibration);
+
+void eeconfig_update_slider_default(void);
+
+/**
+ * \brief Reads the calibration from EEPROM and takes the first sample of every slider.
+ */
+void slider_init(void);
+void slider_task(void);
@@ -0,0 +1,147 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "slider_midi.h"
+#include "slider.h"
+#include "compiler_support.h"
+#include "midi.h"
+#include "bytequeue/bytequeue.h"
+#include "task_deadline.h"
+#include "timer.h"
+
+STATIC_ASSERT(SLIDER_MIDI_CHANNEL < 16, "SLIDER_MIDI_CHANNEL must be between 0 and 15");
+STATIC_ASSERT(SLIDER_MIDI_INTERVAL > 0, "SLIDER_MIDI_INTERVAL must be at least 1 ms");
+
+// Fraction of the travel covered by one controller value
+#define SLIDER_MIDI_STEP ((UINT16_MAX + 1) / (SLIDER_MIDI_VALUE_MAX + 1))
+
+#ifdef SLIDER_MIDI_CC
+static const uint8_t slider_midi_cc[] = SLIDER_MIDI_CC;
+STATIC_ASSERT(sizeof(slider_midi_cc) == NUM_SLIDERS, "SLIDER_MIDI_CC needs one controller per slider");
+#else
+// General purpose controllers, their fine values are sent on controllers 48 and up
+STATIC_ASSERT(NUM_SLIDERS <= 16, "Too many sliders for the default controllers, define SLIDER_MIDI_CC");
+#endif
+
+// Defined in qmk_midi.c
+extern MidiDevice midi_device;
+
+typedef struct {
+    uint16_t value; // latest value, possibly not sent yet
+    uint16_t sent;  // value last sent to the host
+    bool     queued;
+    bool     synced; // whether the host knows the coarse value, see slider_midi_send()
+} slider_midi_state_t;
+
+static slider_midi_state_t slider_midi_state[NUM_SLIDERS];
+static uint32_t            last_send_time;
+
+// Sliders with a value to send, oldest first. A slider is queued at most once.
+static uint8_t     slider_midi_queue_data[NUM_SLIDERS + 1];
+static byteQueue_t slider_midi_queue;
+
+__attribute__((weak)) bool slider_midi_update_user(uint8_t index, uint16_t value) {
+    return true;
+}
+
+__attribute__((weak)) bool slider_midi_update_kb(uint8_t index, uint16_t value) {
+    return slider_midi_update_user(index, value);
+}
+
+uint8_t slider_midi_get_cc(uint8_t index) {
+#ifdef SLIDER_MIDI_CC
+    return slider_midi_cc[index];
+#else
+    return 16 + index;
+#endif
+}
+
+uint16_t slider_midi_get_value(uint8_t index) {
+    if (index >= NUM_SLIDERS) return 0;
+    return slider_midi_state[index].value;
+}
+
+/** \brief Follows the slider, only moving to a neighbouring value once the slider is well past the boundary. */
+static void slider_midi_track(uint8_t index) {
+    slider_midi_state_t *state    = &slider_midi_state[index];
+    int32_t              fraction = slider_get_fraction(index);
+    int32_t              lower    = (int32_t)state->value * SLIDER_MIDI_STEP - SLIDER_MIDI_HYSTERESIS;
+    int32_t              upper    = ((int32_t)state->value + 1) * SLIDER_MIDI_STEP + SLIDER_MIDI_HYSTERESIS;
+
+    if (fraction >= lower && fraction < upper) {
+        return;
+    }
+    // Both ends of the travel stay reachable, although the filtered value only approaches them
+    if (fraction < SLIDER_MIDI_HYSTERESIS) {
+        state->value = 0;
+    } else if (fraction > UINT16_MAX - SLIDER_MIDI_HYSTERESIS) {
+        state->value = SLIDER_MIDI_VALUE_MAX;
+    } else {
+        state->value = fraction / SLIDER_MIDI_STEP;
+    }
+    if (!state->queued && state->value != state->sent) {
+        state->queued = bytequeue_enqueue(&slider_midi_queue, index);
+    }
+}
+
+/** \brief Sends the value of a slider.
+ *
+ * A 14-bit value is sent as the coarse value on the slider's controller, followed by the
+ * fine value on the controller 32 above. As allowed by the MIDI specification, the coarse
+ * value is left out when it did not change.
+ */
+static void slider_midi_send(uint8_t index) {
+    slider_midi_state_t *state = &slider_midi_state[index];
+    uint8_t              cc    = slider_midi_get_cc(index);
+
+#ifdef SLIDER_MIDI_14BIT
+    if (!state->synced || (state->value >> 7) != (state->sent >> 7)) {
+        midi_send_cc(&midi_device, SLIDER_MIDI_CHANNEL, cc, state->value >> 7);
+    }
+    midi_send_cc(&midi_device, SLIDER_MIDI_CHANNEL, cc + 32, state->value & 0x7F);
+#else
+    midi_send_cc(&midi_device, SLIDER_MIDI_CHANNEL, cc, state->value);
+#endif
+    state->sent   = state->value;
+    state->synced = true;
+}
+
+void slider_midi_init(void) {
+    bytequeue_init(&slider_midi_queue, slider_midi_queue_data, sizeof(slider_midi_queue_data));
+    for (uint8_t i = 0; i < NUM_SLIDERS; i++) {
+        slider_midi_state_t *state = &slider_midi_state[i];
+        state->value               = slider_get_fraction(i) / SLIDER_MIDI_STEP;
+        state->sent                = state->value;
+        state->queued              = false;
+        state->synced              = false;
+    }
+    last_send_time = timer_read32() - SLIDER_MIDI_INTERVAL;
+}
+
+void slider_midi_task(void) {
+    for (uint8_t i = 0; i < NUM_SLIDERS; i++) {
+        slider_midi_track(i);
+    }
+
+    while (bytequeue_length(&slider_midi_queue) > 0) {
+        uint32_t elapsed = timer_elapsed32(last_send_time);
+        if (elapsed < SLIDER_MIDI_INTERVAL) {
+            task_deadline_defer(TASK_DEADLINE_SLIDER_MIDI, SLIDER_MIDI_INTERVAL - elapsed);
+            return;
+        }
+
+        // Only the latest value of a slider is sent, however often it moved while queued
+        uint8_t index = bytequeue_get(&slider_midi_queue, 0);
+        bytequeue_remove(&slider_midi_queue, 1);
+        slider_midi_state_t *state = &slider_midi_state[index];
+        state->queued              = false;
+        if (state->value == state->sent || !slider_midi_update_kb(index, state->value)) {
+            continue;
+        }
+        slider_midi_send(index);
+        last_send_time = timer_read32();
+    }
+
+    // Woken by slider_task() once the sliders are sampled again
+    task_deadline_sleep(TASK_DEADLINE_SLIDER_MIDI);
+}
@@ -0,0 +1,57 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// MIDI channel the controllers are sent on, from 0 to 15
+#ifndef SLIDER_MIDI_CHANNEL
+#    define SLIDER_MIDI_CHANNEL 0
+#endif
+
+// Shortest time between two controller updates, in milliseconds
+#ifndef SLIDER_MIDI_INTERVAL
+#    define SLIDER_MIDI_INTERVAL 10
+#endif
+
+// How far past a value boundary the slider has to move to change the value, in 1/65536 of its travel.
+// A 14-bit value step is much finer than the ADC noise, so the dead band has to be wider.
+#ifndef SLIDER_MIDI_HYSTERESIS
+#    ifdef SLIDER_MIDI_14BIT
+#        define SLIDER_MIDI_HYSTERESIS 320
+#    else
+#        define SLIDER_MIDI_HYSTERESIS 192
+#    endif
+#endif
+
+#ifdef SLIDER_MIDI_14BIT
+#    define SLIDER_MIDI_VALUE_MAX 16383
+#else
+#    define SLIDER_MIDI_VALUE_MAX 127
+#endif
+
+/**
+ * \brief Called before the value of a slider is sent as a control change.
+ *
+ * \return false to skip sending the value
+ */
+bool slider_midi_update_kb(uint8_t index, uint16_t value);
+bool slider_midi_update_user(uint8_t index, uint16_t value);
+
+/**
+ * \brief Gets the controller number sent for a slider, from SLIDER_MIDI_CC or 16 + index by default.
+ */
+uint8_t slider_midi_get_cc(uint8_t index);
+
+/**
+ * \brief Gets the current controller value of a slider, between 0 and SLIDER_MIDI_VALUE_MAX.
+ */
+uint16_t slider_midi_get_value(uint8_t index);
+
+/**
+ * \brief Takes the initial value of every slider, without sending it. Called after slider_init().
+ */
+void slider_midi_init(void);
+void slider_midi_task(void);
@@ -0,0 +1,80 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+
+#include "mock.h"
+#include "sync_timer.h"
+
+split_mock_state_t mock_master;
+split_mock_state_t mock_slave;
+
+layer_state_t layer_state;
+layer_state_t default_layer_state;
+
+void mock_reset(void) {
+    memset(&mock_master, 0, sizeof(mock_master));
+    memset(&mock_slave, 0, sizeof(mock_slave));
+    layer_state         = 0;
+    default_layer_state = 0;
+}
+
+bool is_transport_connected(void) {
+    return true;
+}
+
+uint8_t get_mods(void) {
+    return mock_master.mods;
+}
+
+uint8_t get_weak_mods(void) {
+    return mock_master.weak_mods;
+}
+
+uint8_t get_oneshot_mods(void) {
+    return mock_master.oneshot_mods;
+}
+
+uint8_t get_oneshot_locked_mods(void) {
+    return mock_master.oneshot_locked_mods;
+}
+
+void set_mods(uint8_t mods) {
+    mock_slave.mods = mods;
+}
+
+void set_weak_mods(uint8_t mods) {
+    mock_slave.weak_mods = mods;
+}
+
+void set_oneshot_mods(uint8_t mods) {
+    mock_slave.oneshot_mods = mods;
+}
+
+void set_oneshot_locked_mods(uint8_t mods) {
+    mock_slave.oneshot_locked_mods = mods;
+}
+
+uint8_t host_keyboard_leds(void) {
+    return mock_master.led_state;
+}
+
+void set_split_host_keyboard_leds(uint8_t led_state) {
+    mock_slave.led_state = led_state;
+}
+
+uint8_t get_current_wpm(void) {
+    return mock_master.wpm;
+}
+
+void set_current_wpm(uint8_t wpm) {
+    mock_slave.wpm = wpm;
+}
+
+uint32_t sync_timer_read32(void) {
+    return timer_read32();
+}
+
+void sync_timer_update(uint32_t time) {
+    mock_slave.sync_timer = time;
+}
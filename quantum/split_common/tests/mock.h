@@ -0,0 +1,27 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+
+#include "action_layer.h"
+
+typedef struct split_mock_state_t {
+    layer_state_t layer_state;
+    layer_state_t default_layer_state;
+    uint8_t       mods;
+    uint8_t       weak_mods;
+    uint8_t       oneshot_mods;
+    uint8_t       oneshot_locked_mods;
+    uint8_t       led_state;
+    uint8_t       wpm;
+    uint32_t      sync_timer;
+} split_mock_state_t;
+
+// State of the master half, read by the transactions
+extern split_mock_state_t mock_master;
+// State of the slave half, written by the transactions
+extern split_mock_state_t mock_slave;
+
+void mock_reset(void);
@@ -0,0 +1,37 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+SPLIT_TRANSACTIONS_COMMON_DEFS := \
+	-DMATRIX_ROWS=8 \
+	-DMATRIX_COLS=8 \
+	-DSPLIT_KEYBOARD \
+	-DSPLIT_TRANSPORT_MIRROR \
+	-DSPLIT_LAYER_STATE_ENABLE \
+	-DSPLIT_LED_STATE_ENABLE \
+	-DSPLIT_MODS_ENABLE \
+	-DWPM_ENABLE \
+	-DSPLIT_WPM_ENABLE \
+	-DFORCED_SYNC_THROTTLE_MS=100
+
+SPLIT_TRANSACTIONS_COMMON_INC := \
+	$(QUANTUM_PATH)/split_common \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/drivers
+
+SPLIT_TRANSACTIONS_COMMON_SRC := \
+	$(QUANTUM_PATH)/split_common/tests/mock.c \
+	$(QUANTUM_PATH)/split_common/tests/split_transactions_tests.cpp \
+	$(QUANTUM_PATH)/split_common/tests/split_transport_sim_tests.cpp \
+	$(QUANTUM_PATH)/split_common/transactions.c \
+	$(QUANTUM_PATH)/split_common/transport.c \
+	$(QUANTUM_PATH)/crc.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/drivers/serial_loopback.c \
+	$(PLATFORM_PATH)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c
+
+split_transactions_DEFS := $(SPLIT_TRANSACTIONS_COMMON_DEFS)
+split_transactions_INC := $(SPLIT_TRANSACTIONS_COMMON_INC)
+split_transactions_SRC := $(SPLIT_TRANSACTIONS_COMMON_SRC)
+
+split_transactions_batched_DEFS := $(SPLIT_TRANSACTIONS_COMMON_DEFS) -DSPLIT_TRANSACTIONS_BATCHED
+split_transactions_batched_INC := $(SPLIT_TRANSACTIONS_COMMON_INC)
+split_transactions_batched_SRC := $(SPLIT_TRANSACTIONS_COMMON_SRC)
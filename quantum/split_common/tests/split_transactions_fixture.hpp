@@ -0,0 +1,92 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstring>
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "mock.h"
+#include "serial_loopback.h"
+#include "transactions.h"
+#include "timer.h"
+
+void advance_time(uint32_t ms);
+void set_time(uint32_t t);
+}
+
+#define HALF_ROWS ((MATRIX_ROWS) / 2)
+
+class SplitTransactions : public ::testing::Test {
+   protected:
+    matrix_row_t master_matrix[HALF_ROWS]; // scanned by the master
+    matrix_row_t slave_matrix[HALF_ROWS];  // scanned by the slave
+    matrix_row_t master_view[HALF_ROWS];   // slave matrix, as received by the master
+    matrix_row_t slave_view[HALF_ROWS];    // master matrix, as mirrored to the slave
+
+    void SetUp() override {
+        timer_clear();
+        mock_reset();
+        serial_loopback_reset();
+        memset(split_shmem, 0, sizeof(split_shared_memory_t));
+        memset(master_matrix, 0, sizeof(master_matrix));
+        memset(slave_matrix, 0, sizeof(slave_matrix));
+        memset(master_view, 0, sizeof(master_view));
+        memset(slave_view, 0, sizeof(slave_view));
+        // The slave is up before the master starts talking to it
+        serial_loopback_run_as_target(slave_scan, this);
+    }
+
+    static void slave_scan(void *arg) {
+        SplitTransactions *test = static_cast<SplitTransactions *>(arg);
+
+        // Both halves share the layer state globals, swap in the slave's
+        layer_state_t master_layer_state         = layer_state;
+        layer_state_t master_default_layer_state = default_layer_state;
+        layer_state                              = mock_slave.layer_state;
+        default_layer_state                      = mock_slave.default_layer_state;
+
+        transactions_slave(test->slave_view, test->slave_matrix);
+
+        mock_slave.layer_state         = layer_state;
+        mock_slave.default_layer_state = default_layer_state;
+        layer_state                    = master_layer_state;
+        default_layer_state            = master_default_layer_state;
+    }
+
+    /* Runs the transactions of the master, returns whether it got through. */
+    bool master_scan() {
+        layer_state         = mock_master.layer_state;
+        default_layer_state = mock_master.default_layer_state;
+        return transactions_master(master_matrix, master_view);
+    }
+
+    /* One millisecond scan of both halves, returns whether the master got through. */
+    bool scan() {
+        bool okay = master_scan();
+        serial_loopback_run_as_target(slave_scan, this);
+        advance_time(1);
+        return okay;
+    }
+
+    void scan_for(uint32_t ms) {
+        for (uint32_t i = 0; i < ms; i++) {
+            scan();
+        }
+    }
+
+    void expect_in_sync() {
+        EXPECT_EQ(mock_slave.layer_state, mock_master.layer_state);
+        EXPECT_EQ(mock_slave.default_layer_state, mock_master.default_layer_state);
+        EXPECT_EQ(mock_slave.mods, mock_master.mods);
+        EXPECT_EQ(mock_slave.weak_mods, mock_master.weak_mods);
+        EXPECT_EQ(mock_slave.oneshot_mods, mock_master.oneshot_mods);
+        EXPECT_EQ(mock_slave.oneshot_locked_mods, mock_master.oneshot_locked_mods);
+        EXPECT_EQ(mock_slave.led_state, mock_master.led_state);
+        EXPECT_EQ(mock_slave.wpm, mock_master.wpm);
+        EXPECT_EQ(memcmp(master_view, slave_matrix, sizeof(slave_matrix)), 0);
+        EXPECT_EQ(memcmp(slave_view, master_matrix, sizeof(master_matrix)), 0);
+    }
+};
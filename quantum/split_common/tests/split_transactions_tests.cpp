@@ -0,0 +1,150 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "benchmark_util.hpp"
+#include "split_transactions_fixture.hpp"
+
+TEST_F(SplitTransactions, master_state_reaches_slave) {
+    mock_master.layer_state         = 1 << 3;
+    mock_master.default_layer_state = 1 << 1;
+    mock_master.mods                = 0x02;
+    mock_master.weak_mods           = 0x20;
+    mock_master.oneshot_mods        = 0x04;
+    mock_master.oneshot_locked_mods = 0x40;
+    mock_master.led_state           = 0x05;
+    mock_master.wpm                 = 87;
+    EXPECT_TRUE(scan());
+    expect_in_sync();
+
+    mock_master.layer_state = 1 << 4;
+    mock_master.mods        = 0;
+    EXPECT_TRUE(scan());
+    expect_in_sync();
+}
+
+TEST_F(SplitTransactions, sync_timer_reaches_slave) {
+    scan_for(150);
+    EXPECT_NE(mock_slave.sync_timer, 0);
+    EXPECT_LE(mock_slave.sync_timer, timer_read32() + 2);
+}
+
+TEST_F(SplitTransactions, matrices_reach_other_half) {
+    slave_matrix[1]  = 0x81;
+    master_matrix[3] = 0x10;
+    scan_for(2);
+    expect_in_sync();
+
+    slave_matrix[1]  = 0;
+    slave_matrix[2]  = 0xFF;
+    master_matrix[3] = 0;
+    scan_for(2);
+    expect_in_sync();
+}
+
+TEST_F(SplitTransactions, recovers_after_disconnect) {
+    slave_matrix[0]  = 0x01;
+    mock_master.mods = 0x01;
+    scan_for(2);
+    expect_in_sync();
+
+    serial_loopback_set_connected(false);
+    slave_matrix[0]         = 0x02;
+    mock_master.mods        = 0x08;
+    mock_master.layer_state = 1 << 2;
+    mock_master.led_state   = 0x02;
+    EXPECT_FALSE(scan());
+    EXPECT_FALSE(scan());
+    EXPECT_EQ(master_view[0], 0x01);
+
+    serial_loopback_set_connected(true);
+    scan_for(FORCED_SYNC_THROTTLE_MS + 2);
+    expect_in_sync();
+}
+
+#ifdef SPLIT_TRANSACTIONS_BATCHED
+TEST_F(SplitTransactions, batched_recovers_on_next_scan) {
+    scan_for(2);
+    serial_loopback_set_connected(false);
+    slave_matrix[0]         = 0x04;
+    mock_master.mods        = 0x10;
+    mock_master.layer_state = 1 << 5;
+    EXPECT_FALSE(scan());
+
+    // The staged records are kept, and the slave is asked for its complete state
+    serial_loopback_set_connected(true);
+    scan_for(2);
+    expect_in_sync();
+}
+
+TEST_F(SplitTransactions, batched_idle_scan_is_one_short_round_trip) {
+    serial_loopback_stats_t stats;
+
+    // Let every field settle
+    mock_master.mods = 0x01;
+    slave_matrix[0]  = 0x01;
+    scan_for(FORCED_SYNC_THROTTLE_MS + 2);
+    serial_loopback_clear_stats();
+
+    // Nothing is due for a forced sync right after all of them
+    scan();
+    serial_loopback_get_stats(&stats);
+    EXPECT_EQ(stats.transactions, 1);
+    // Transaction id, handshake and the empty reply, no frame is sent
+    EXPECT_EQ(stats.bytes, 3);
+}
+#endif
+
+/* Types on both halves for ten seconds, at about 100 wpm, while layers, mods,
+ * lock LEDs and wpm change along, and reports what the transport costs per scan.
+ */
+TEST_F(SplitTransactions, benchmark_typing) {
+    const uint32_t          scans = 10000;
+    serial_loopback_stats_t stats;
+    uint32_t                max_transactions = 0;
+    uint32_t                rng              = 1;
+    auto                    random           = [&](uint32_t range) {
+        rng = rng * 1664525 + 1013904223;
+        return (rng >> 8) % range;
+    };
+
+    scan_for(FORCED_SYNC_THROTTLE_MS);
+    serial_loopback_clear_stats();
+    for (uint32_t i = 0; i < scans; i++) {
+        // A keystroke every 120 ms, held for 60 ms
+        if (i % 120 == 0) {
+            matrix_row_t *half = random(2) ? master_matrix : slave_matrix;
+            half[random(HALF_ROWS)] |= (matrix_row_t)1 << random(MATRIX_COLS);
+        } else if (i % 120 == 60) {
+            memset(master_matrix, 0, sizeof(master_matrix));
+            memset(slave_matrix, 0, sizeof(slave_matrix));
+        }
+        if (i % 480 == 0) {
+            mock_master.layer_state = random(4) == 0 ? 1 << random(4) : 0;
+            mock_master.mods        = random(3) == 0 ? 1 << random(8) : 0;
+        }
+        if (i % 1000 == 0) {
+            mock_master.wpm = 90 + random(20);
+        }
+        if (i % 4000 == 0) {
+            mock_master.led_state ^= 0x02;
+        }
+
+        serial_loopback_stats_t before;
+        serial_loopback_get_stats(&before);
+        EXPECT_TRUE(scan());
+        serial_loopback_get_stats(&stats);
+        if (stats.transactions - before.transactions > max_transactions) {
+            max_transactions = stats.transactions - before.transactions;
+        }
+    }
+    scan_for(2);
+    expect_in_sync();
+
+    report_benchmark("split transport", {{"round-trips/scan", (double)stats.transactions / scans}, {"max-round-trips", max_transactions}, {"bytes/scan", (double)stats.bytes / scans}});
+
+#ifdef SPLIT_TRANSACTIONS_BATCHED
+    EXPECT_EQ(max_transactions, 1);
+#else
+    EXPECT_GT(max_transactions, 1);
+#endif
+}
@@ -0,0 +1,162 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <vector>
+
+#include "benchmark_util.hpp"
+#include "split_transactions_fixture.hpp"
+
+// Time the master spends scanning and processing between two transports
+#define PROCESSING_US 500
+
+/* Simulates both halves in microseconds over a link with a given speed,
+ * latency and bit error rate. The slave types one key at a time while the
+ * master toggles its mods and layers, and every scan checks what each half
+ * got from the other. Latency is measured from the slave keypress to the
+ * transport that brings it into the master matrix. Nothing runs on top of
+ * the transport, so the time to the host report is not included.
+ */
+class SplitTransportSim : public SplitTransactions {
+   protected:
+    struct Result {
+        uint32_t              events;
+        uint32_t              delivered;
+        uint32_t              ghosts;       // slave matrices seen by the master that the slave never had
+        uint32_t              bogus_states; // mods or layers applied on the slave that the master never had
+        uint32_t              retries;
+        uint32_t              corrupted_bytes;
+        std::vector<uint32_t> latencies_us; // from the slave keypress to the master matrix
+
+        uint32_t percentile(uint32_t p) {
+            if (latencies_us.empty()) return 0;
+            std::sort(latencies_us.begin(), latencies_us.end());
+            return latencies_us[(latencies_us.size() - 1) * p / 100];
+        }
+    };
+
+    uint64_t now_us = 0;
+
+    uint64_t link_time_us() {
+        serial_loopback_stats_t stats;
+        serial_loopback_get_stats(&stats);
+        return stats.link_time_us;
+    }
+
+    Result run(const serial_loopback_link_t &link, uint32_t keystrokes) {
+        Result   result = {};
+        uint32_t rng    = 1;
+        auto     random = [&](uint32_t range) {
+            rng = rng * 1664525 + 1013904223;
+            return (rng >> 8) % range;
+        };
+
+        serial_loopback_set_link(&link);
+        serial_loopback_clear_stats();
+
+        // The slave matrix the master last got, the one it waits for, and when it changed
+        std::vector<matrix_row_t> delivered(slave_matrix, slave_matrix + HALF_ROWS);
+        std::vector<matrix_row_t> pending = delivered;
+        uint64_t                  event_us = 0;
+        uint64_t                  next_us  = 20000;
+        bool                      pressed  = false;
+
+        while (result.events < 2 * keystrokes || pending != delivered) {
+            // Transport, timed by the link
+            uint64_t link_before = link_time_us();
+            set_time(now_us / 1000);
+            master_scan();
+            now_us += link_time_us() - link_before;
+
+            std::vector<matrix_row_t> seen(master_view, master_view + HALF_ROWS);
+            if (seen != delivered) {
+                if (seen == pending) {
+                    result.latencies_us.push_back(now_us - event_us);
+                    result.delivered++;
+                    delivered = seen;
+                } else {
+                    result.ghosts++;
+                }
+            }
+
+            // Processing, during which the slave scans its keys
+            uint64_t end_us = now_us + PROCESSING_US;
+            if (pending == delivered && next_us < end_us && result.events < 2 * keystrokes) {
+                event_us = std::max(next_us, now_us);
+                if (pressed) {
+                    memset(slave_matrix, 0, sizeof(slave_matrix));
+                    next_us = event_us + 20000 + random(40000);
+                } else {
+                    slave_matrix[random(HALF_ROWS)] = (matrix_row_t)1 << random(MATRIX_COLS);
+                    next_us                         = event_us + 30000 + random(30000);
+                }
+                pressed = !pressed;
+                pending.assign(slave_matrix, slave_matrix + HALF_ROWS);
+                result.events++;
+            }
+            if ((end_us / 50000) % 2) {
+                mock_master.mods        = 0x02;
+                mock_master.layer_state = 1 << 1;
+            } else {
+                mock_master.mods        = 0;
+                mock_master.layer_state = 0;
+            }
+            now_us = end_us;
+            set_time(now_us / 1000);
+            serial_loopback_run_as_target(slave_scan, this);
+
+            if ((mock_slave.mods != 0 && mock_slave.mods != 0x02) || (mock_slave.layer_state != 0 && mock_slave.layer_state != 1 << 1)) {
+                result.bogus_states++;
+            }
+        }
+
+        serial_loopback_stats_t stats;
+        serial_loopback_get_stats(&stats);
+        result.retries         = stats.failures;
+        result.corrupted_bytes = stats.corrupted_bytes;
+        return result;
+    }
+
+    void report(const char *name, Result &result) {
+        report_benchmark(name, {{"key-to-master-matrix-p50", result.percentile(50), "us"}, {"p99", result.percentile(99), "us"}, {"max", result.percentile(100), "us"}, {"retries", result.retries}, {"corrupted-bytes", result.corrupted_bytes}, {"ghosts", result.ghosts}, {"bogus-states", result.bogus_states}});
+    }
+};
+
+TEST_F(SplitTransportSim, clean_link) {
+    serial_loopback_link_t link   = {.baud_rate = 460800, .latency_us = 20, .bit_error_ppm = 0, .timeout_us = 1000, .seed = 1};
+    Result                 result = run(link, 200);
+    report("clean link", result);
+
+    EXPECT_EQ(result.delivered, result.events);
+    EXPECT_EQ(result.ghosts, 0);
+    EXPECT_EQ(result.bogus_states, 0);
+    EXPECT_EQ(result.retries, 0);
+    // The slave sees a key within one loop, and the next transport usually brings it to the master
+    EXPECT_LT(result.percentile(50), 2 * PROCESSING_US);
+}
+
+TEST_F(SplitTransportSim, slow_link) {
+    serial_loopback_link_t link   = {.baud_rate = 38400, .latency_us = 50, .bit_error_ppm = 0, .timeout_us = 1000, .seed = 1};
+    Result                 result = run(link, 200);
+    report("slow link", result);
+
+    EXPECT_EQ(result.delivered, result.events);
+    EXPECT_EQ(result.ghosts, 0);
+    EXPECT_EQ(result.retries, 0);
+}
+
+TEST_F(SplitTransportSim, noisy_link) {
+    serial_loopback_link_t link   = {.baud_rate = 460800, .latency_us = 20, .bit_error_ppm = 200, .timeout_us = 1000, .seed = 1};
+    Result                 result = run(link, 200);
+    report("noisy link", result);
+
+    // Every keystroke arrives, and corrupted matrices never reach the master
+    EXPECT_GT(result.corrupted_bytes, 0);
+    EXPECT_GT(result.retries, 0);
+    EXPECT_EQ(result.delivered, result.events);
+    EXPECT_EQ(result.ghosts, 0);
+#ifdef SPLIT_TRANSACTIONS_BATCHED
+    // Every frame is checked, so corrupted state never reaches the slave either
+    EXPECT_EQ(result.bogus_states, 0);
+#endif
+}
@@ -26,6 +26,11 @@ enum serial_transaction_id {
     GET_SLAVE_MATRIX_CHECKSUM,
     GET_SLAVE_MATRIX_DATA,
 
+#ifdef SPLIT_TRANSACTIONS_BATCHED
+    TRANSFER_BATCH,
+    GET_BATCH,
+#endif // SPLIT_TRANSACTIONS_BATCHED
+
 #ifdef SPLIT_TRANSPORT_MIRROR
     PUT_MASTER_MATRIX,
 #endif // SPLIT_TRANSPORT_MIRROR
@@ -159,10 +159,221 @@ inline static bool read_if_checksum_mismatch(int8_t trans_id_checksum, int8_t tr
     return okay;
 }
 
+#ifdef SPLIT_TRANSACTIONS_BATCHED
+
+/*
+ * Batched transactions stage the changes to the shared state in a single frame,
+ * which is exchanged with the slave in one transaction at the end of the scan.
+ * A frame starts with the number of bytes following it, then holds records of
+ * the bytes of transaction buffers that changed, closed by their CRC8:
+ *
+ *   [length] {[transaction id] [offset] [count] [count bytes]}... [crc8]
+ *
+ * Records of a whole buffer set BATCH_RECORD_FULL in the id instead, and leave
+ * out the offset and count.
+ *
+ * Records hold the bytes themselves rather than their changes, so applying a
+ * frame twice is harmless. An empty frame is just its length byte, and is not
+ * sent at all: the master only fetches the reply of the slave then.
+ */
+
+#    if SPLIT_TRANSACTIONS_BATCH_SIZE > 255
+#        error "SPLIT_TRANSACTIONS_BATCH_SIZE must not exceed 255"
+#    endif
+
+#    define BATCH_RECORD_HEADER_SIZE 3
+#    define BATCH_RECORD_FULL 0x80
+// Leaves room for the length, the CRC and a pseudo record
+#    define BATCH_CAPACITY (SPLIT_TRANSACTIONS_BATCH_SIZE - 3)
+
+// Pseudo records are made of their id alone
+#    define BATCH_NONE 0        // not sent, no pseudo record
+#    define BATCH_RESYNC 0xFF   // master to slave: send back the complete state
+#    define BATCH_REJECTED 0xFE // slave to master: the frame was corrupted and has been dropped
+
+STATIC_ASSERT(1 + sizeof_member(split_shared_memory_t, smatrix.matrix) <= BATCH_CAPACITY, "SPLIT_TRANSACTIONS_BATCH_SIZE too small for the slave matrix");
+
+static uint8_t  batch_frame[SPLIT_TRANSACTIONS_BATCH_SIZE] = {0};
+static bool     batch_resync                               = true;
+static uint32_t batch_last_resync                          = 0;
+
+/**
+ * @brief Appends the bytes of `data` that differ from `shadow` to an open
+ * frame, and updates the shadow. Returns false if they don't fit.
+ */
+static bool batch_encode(uint8_t *frame, int8_t trans_id, const void *data, void *shadow, uint8_t length, bool full) {
+    const uint8_t *source = data;
+    uint8_t       *copy   = shadow;
+    uint8_t        first  = 0;
+    uint8_t        last   = length;
+
+    if (!full) {
+        while (first < length && source[first] == copy[first]) {
+            first++;
+        }
+        if (first == length) {
+            return true;
+        }
+        while (source[last - 1] == copy[last - 1]) {
+            last--;
+        }
+    }
+
+    uint8_t count = last - first;
+    bool    whole = 1 + length <= BATCH_RECORD_HEADER_SIZE + count;
+    uint8_t size  = whole ? 1 + length : BATCH_RECORD_HEADER_SIZE + count;
+    if (frame[0] + size > BATCH_CAPACITY) {
+        return false;
+    }
+
+    uint8_t *record = &frame[1 + frame[0]];
+    if (whole) {
+        first     = 0;
+        count     = length;
+        record[0] = trans_id | BATCH_RECORD_FULL;
+    } else {
+        record[0] = trans_id;
+        record[1] = first;
+        record[2] = count;
+    }
+    memcpy(&record[size - count], &source[first], count);
+    memcpy(&copy[first], &source[first], count);
+    frame[0] += size;
+    return true;
+}
+
+static void batch_close(uint8_t *frame, uint8_t pseudo_record) {
+    if (pseudo_record != BATCH_NONE) {
+        frame[1 + frame[0]++] = pseudo_record;
+    }
+    if (frame[0] > 0) {
+        frame[1 + frame[0]] = crc8(&frame[1], frame[0]);
+        frame[0]++;
+    }
+}
+
+/**
+ * @brief Applies the records of a closed frame to the buffers of their
+ * transactions. Nothing is applied if the frame is corrupted.
+ */
+static bool batch_decode(const uint8_t *frame, bool initiator2target, uint8_t *pseudo_record) {
+    uint8_t length = frame[0];
+    *pseudo_record = BATCH_NONE;
+    if (length == 0) {
+        return true;
+    }
+    if (length >= SPLIT_TRANSACTIONS_BATCH_SIZE || crc8(&frame[1], length - 1) != frame[length]) {
+        return false;
+    }
+
+    const uint8_t *end = &frame[length];
+    // The first pass checks every record, the second one applies them
+    for (uint8_t pass = 0; pass < 2; pass++) {
+        const uint8_t *record = &frame[1];
+        while (record < end) {
+            if (record[0] == BATCH_RESYNC || record[0] == BATCH_REJECTED) {
+                *pseudo_record = record[0];
+                record++;
+                continue;
+            }
+            uint8_t trans_id = record[0] & ~BATCH_RECORD_FULL;
+            if (trans_id >= NUM_TOTAL_TRANSACTIONS || split_transaction_table[trans_id].framed) {
+                return false;
+            }
+
+            split_transaction_desc_t *trans  = &split_transaction_table[trans_id];
+            uint8_t                   size   = initiator2target ? trans->initiator2target_buffer_size : trans->target2initiator_buffer_size;
+            uint8_t                   header = 1;
+            uint8_t                   offset = 0;
+            uint8_t                   count  = size;
+            if (!(record[0] & BATCH_RECORD_FULL)) {
+                if (end - record < BATCH_RECORD_HEADER_SIZE) {
+                    return false;
+                }
+                header = BATCH_RECORD_HEADER_SIZE;
+                offset = record[1];
+                count  = record[2];
+            }
+            if (offset + count > size || end - record - header < count) {
+                return false;
+            }
+
+            if (pass > 0) {
+                uint8_t *buffer = initiator2target ? split_trans_initiator2target_buffer(trans) : split_trans_target2initiator_buffer(trans);
+                memcpy(&buffer[offset], &record[header], count);
+            }
+            record += header + count;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Sends the staged frame to the slave, and applies its reply.
+ */
+static bool batch_exchange(void) {
+    uint8_t reply[SPLIT_TRANSACTIONS_BATCH_SIZE];
+    uint8_t pseudo_record;
+    uint8_t staged = batch_frame[0];
+    bool    resync = batch_resync || timer_elapsed32(batch_last_resync) >= FORCED_SYNC_THROTTLE_MS;
+
+    batch_close(batch_frame, resync ? BATCH_RESYNC : BATCH_NONE);
+    bool okay;
+    if (batch_frame[0] > 0) {
+        okay = transport_execute_transaction(TRANSFER_BATCH, batch_frame, 1 + batch_frame[0], reply, sizeof(reply));
+    } else {
+        okay = transport_read(GET_BATCH, reply, sizeof(reply));
+    }
+    okay = okay && batch_decode(reply, false, &pseudo_record) && pseudo_record != BATCH_REJECTED;
+    if (okay) {
+        batch_frame[0] = 0;
+        if (resync) {
+            batch_last_resync = timer_read32();
+        }
+    } else {
+        // Keep the records to send them again, and ask for everything the reply may have lost
+        batch_frame[0] = staged;
+    }
+    batch_resync = !okay;
+    return okay;
+}
+
+/**
+ * @brief Stages the bytes of a transaction buffer that the slave doesn't hold
+ * yet, or all of them if `full` is set.
+ */
+static bool batch_put(int8_t trans_id, const void *source, size_t length, bool full) {
+    split_transaction_desc_t *trans  = &split_transaction_table[trans_id];
+    void                     *shadow = split_trans_initiator2target_buffer(trans);
+
+    if (1 + length > BATCH_CAPACITY) {
+        return transport_write(trans_id, source, length);
+    }
+    // Some handlers stage the shared memory itself, which leaves nothing to compare against
+    if (source == shadow) {
+        full = true;
+    }
+
+    if (batch_encode(batch_frame, trans_id, source, shadow, length, full)) {
+        return true;
+    }
+    // Make room by sending what has been staged so far
+    return batch_exchange() && batch_encode(batch_frame, trans_id, source, shadow, length, full);
+}
+
+#    define transport_put(id, data, length, full) batch_put(id, data, length, full)
+
+#else // SPLIT_TRANSACTIONS_BATCHED
+
+#    define transport_put(id, data, length, full) transport_write(id, data, length)
+
+#endif // SPLIT_TRANSACTIONS_BATCHED
+
 inline static bool send_if_condition(int8_t trans_id, uint32_t *last_update, bool condition, void *source, size_t length) {
-    bool okay = true;
-    if (timer_elapsed32(*last_update) >= FORCED_SYNC_THROTTLE_MS || condition) {
-        okay &= transport_write(trans_id, source, length);
+    bool okay   = true;
+    bool forced = timer_elapsed32(*last_update) >= FORCED_SYNC_THROTTLE_MS;
+    if (forced || condition) {
+        okay &= transport_put(trans_id, source, length, forced);
         if (okay) {
             *last_update = timer_read32();
         }
@@ -178,6 +389,8 @@ inline static bool send_if_data_mismatch(int8_t trans_id, uint32_t *last_update,
 ////////////////////////////////////////////////////
 // Slave matrix
 
+#ifndef SPLIT_TRANSACTIONS_BATCHED
+
 static bool slave_matrix_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     static uint32_t     last_update                    = 0;
     static matrix_row_t last_matrix[(MATRIX_ROWS) / 2] = {0}; // last successfully-read matrix, so we can replicate if there are checksum errors
@@ -193,19 +406,75 @@ static bool slave_matrix_handlers_master(matrix_row_t master_matrix[], matrix_ro
     return okay;
 }
 
+#    define TRANSACTIONS_SLAVE_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER(slave_matrix)
+
+#else // SPLIT_TRANSACTIONS_BATCHED
+
+// The slave matrix comes back with the batch
+#    define TRANSACTIONS_SLAVE_MATRIX_MASTER()
+
+#endif // SPLIT_TRANSACTIONS_BATCHED
+
 static void slave_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     memcpy(split_shmem->smatrix.matrix, slave_matrix, sizeof(split_shmem->smatrix.matrix));
     split_shmem->smatrix.checksum = crc8(split_shmem->smatrix.matrix, sizeof(split_shmem->smatrix.matrix));
 }
 
 // clang-format off
-#define TRANSACTIONS_SLAVE_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER(slave_matrix)
 #define TRANSACTIONS_SLAVE_MATRIX_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(slave_matrix)
 #define TRANSACTIONS_SLAVE_MATRIX_REGISTRATIONS \
     [GET_SLAVE_MATRIX_CHECKSUM] = trans_target2initiator_initializer(smatrix.checksum), \
     [GET_SLAVE_MATRIX_DATA]     = trans_target2initiator_initializer(smatrix.matrix),
 // clang-format on
 
+////////////////////////////////////////////////////
+// Batch
+
+#ifdef SPLIT_TRANSACTIONS_BATCHED
+
+static bool batch_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    bool okay = batch_exchange();
+    // Only verified replies reach the shared memory, so it holds the last-known-good matrix state
+    memcpy(slave_matrix, split_shmem->smatrix.matrix, sizeof(split_shmem->smatrix.matrix));
+    return okay;
+}
+
+static void batch_handlers_slave_transfer(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    static matrix_row_t last_matrix[(MATRIX_ROWS) / 2] = {0}; // last matrix sent to the master
+    uint8_t            *reply                          = target2initiator_buffer;
+    uint8_t             pseudo_record                  = BATCH_NONE;
+
+    reply[0] = 0;
+    if (initiator2target_buffer_size > 0 && !batch_decode(initiator2target_buffer, true, &pseudo_record)) {
+        batch_close(reply, BATCH_REJECTED);
+        return;
+    }
+    batch_encode(reply, GET_SLAVE_MATRIX_DATA, split_shmem->smatrix.matrix, last_matrix, sizeof(last_matrix), pseudo_record == BATCH_RESYNC);
+    batch_close(reply, BATCH_NONE);
+}
+
+// clang-format off
+#    define TRANSACTIONS_BATCH_MASTER() TRANSACTION_HANDLER_MASTER(batch)
+#    define TRANSACTIONS_BATCH_REGISTRATIONS \
+    [TRANSFER_BATCH] = { \
+        sizeof_member(split_shared_memory_t, batch.m2s), offsetof(split_shared_memory_t, batch.m2s), \
+        sizeof_member(split_shared_memory_t, batch.s2m), offsetof(split_shared_memory_t, batch.s2m), \
+        batch_handlers_slave_transfer, true \
+    }, \
+    [GET_BATCH] = { \
+        0, 0, \
+        sizeof_member(split_shared_memory_t, batch.s2m), offsetof(split_shared_memory_t, batch.s2m), \
+        batch_handlers_slave_transfer, true \
+    },
+// clang-format on
+
+#else // SPLIT_TRANSACTIONS_BATCHED
+
+#    define TRANSACTIONS_BATCH_MASTER()
+#    define TRANSACTIONS_BATCH_REGISTRATIONS
+
+#endif // SPLIT_TRANSACTIONS_BATCHED
+
 ////////////////////////////////////////////////////
 // Master matrix
 
@@ -302,7 +571,7 @@ static bool sync_timer_handlers_master(matrix_row_t master_matrix[], matrix_row_
     bool okay = true;
     if (timer_elapsed32(last_update) >= FORCED_SYNC_THROTTLE_MS) {
         uint32_t sync_timer = sync_timer_read32() + SYNC_TIMER_OFFSET;
-        okay &= transport_write(PUT_SYNC_TIMER, &sync_timer, sizeof(sync_timer));
+        okay &= transport_put(PUT_SYNC_TIMER, &sync_timer, sizeof(sync_timer), true);
         if (okay) {
             last_update = timer_read32();
         }
@@ -402,7 +671,8 @@ static void led_state_handlers_slave(matrix_row_t master_matrix[], matrix_row_t
 
 static bool mods_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     static uint32_t   last_update    = 0;
-    bool              mods_need_sync = timer_elapsed32(last_update) >= FORCED_SYNC_THROTTLE_MS;
+    bool              mods_forced    = timer_elapsed32(last_update) >= FORCED_SYNC_THROTTLE_MS;
+    bool              mods_need_sync = mods_forced;
     split_mods_sync_t new_mods;
     new_mods.real_mods = get_mods();
     if (!mods_need_sync && new_mods.real_mods != split_shmem->mods.real_mods) {
@@ -427,7 +697,7 @@ static bool mods_handlers_master(matrix_row_t master_matrix[], matrix_row_t slav
 
     bool okay = true;
     if (mods_need_sync) {
-        okay &= transport_write(PUT_MODS, &new_mods, sizeof(new_mods));
+        okay &= transport_put(PUT_MODS, &new_mods, sizeof(new_mods), mods_forced);
         if (okay) {
             last_update = timer_read32();
         }
@@ -504,6 +774,10 @@ static bool rgblight_handlers_master(matrix_row_t master_matrix[], matrix_row_t
     rgblight_get_syncinfo(&rgblight_sync);
     if (send_if_condition(PUT_RGBLIGHT, &last_update, (rgblight_sync.status.change_flags != 0), &rgblight_sync, sizeof(rgblight_sync))) {
         rgblight_clear_change_flags();
+#    ifdef SPLIT_TRANSACTIONS_BATCHED
+        // The slave clears them once applied, so that the next changes always carry their flags
+        split_shmem->rgblight_sync.status.change_flags = 0;
+#    endif // SPLIT_TRANSACTIONS_BATCHED
     } else {
         return false;
     }
@@ -926,6 +1200,7 @@ split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
 
     // clang-format off
     TRANSACTIONS_SLAVE_MATRIX_REGISTRATIONS
+    TRANSACTIONS_BATCH_REGISTRATIONS
     TRANSACTIONS_MASTER_MATRIX_REGISTRATIONS
     TRANSACTIONS_ENCODERS_REGISTRATIONS
     TRANSACTIONS_SYNC_TIMER_REGISTRATIONS
@@ -974,6 +1249,7 @@ bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix
     TRANSACTIONS_HAPTIC_MASTER();
     TRANSACTIONS_ACTIVITY_MASTER();
     TRANSACTIONS_DETECTED_OS_MASTER();
+    TRANSACTIONS_BATCH_MASTER();
     return true;
 }
 
@@ -32,6 +32,7 @@ typedef struct _split_transaction_desc_t {
     uint8_t          target2initiator_buffer_size;
     uint16_t         target2initiator_offset;
     slave_callback_t slave_callback;
+    bool             framed;
 } split_transaction_desc_t;
 
 // Forward declaration for the split transactions
@@ -41,6 +42,11 @@ extern split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS];
 #define split_trans_initiator2target_buffer(trans) (split_shmem_offset_ptr((trans)->initiator2target_offset))
 #define split_trans_target2initiator_buffer(trans) (split_shmem_offset_ptr((trans)->target2initiator_offset))
 
+// Framed buffers start with the number of bytes following, only those need to be transferred
+#define split_trans_frame_size(trans, buffer, buffer_size) ((trans)->framed ? (uint8_t)(1 + *(const uint8_t *)(buffer)) : (buffer_size))
+#define split_trans_initiator2target_size(trans) split_trans_frame_size(trans, split_trans_initiator2target_buffer(trans), (trans)->initiator2target_buffer_size)
+#define split_trans_target2initiator_size(trans) split_trans_frame_size(trans, split_trans_target2initiator_buffer(trans), (trans)->target2initiator_buffer_size)
+
 // returns false if valid data not received from slave
 bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
 void transactions_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
@@ -0,0 +1,53 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "task_deadline.h"
+#include "compiler_support.h"
+#include "timer.h"
+
+#define TASK_BIT(task) ((uint16_t)1 << (task))
+
+STATIC_ASSERT(TASK_DEADLINE_COUNT <= 16, "Too many tasks for the task deadline bitmasks");
+
+// Tasks start out due so that each of them gets to publish its own deadline.
+static uint16_t task_sleeping = 0;
+static uint16_t task_deferred = 0;
+static uint32_t task_deadlines[TASK_DEADLINE_COUNT];
+
+bool task_deadline_due(task_deadline_t task) {
+    if (task_sleeping & TASK_BIT(task)) {
+        return false;
+    }
+    if (task_deferred & TASK_BIT(task)) {
+        if (!timer_expired32(timer_read32(), task_deadlines[task])) {
+            return false;
+        }
+        task_deferred &= ~TASK_BIT(task);
+    }
+    return true;
+}
+
+void task_deadline_wake(task_deadline_t task) {
+    task_sleeping &= ~TASK_BIT(task);
+    task_deferred &= ~TASK_BIT(task);
+}
+
+void task_deadline_wake_all(void) {
+    task_sleeping = 0;
+    task_deferred = 0;
+}
+
+void task_deadline_defer(task_deadline_t task, uint32_t delay_ms) {
+    task_sleeping &= ~TASK_BIT(task);
+    if (delay_ms == 0) {
+        task_deferred &= ~TASK_BIT(task);
+        return;
+    }
+    task_deadlines[task] = timer_read32() + delay_ms;
+    task_deferred |= TASK_BIT(task);
+}
+
+void task_deadline_sleep(task_deadline_t task) {
+    task_deferred &= ~TASK_BIT(task);
+    task_sleeping |= TASK_BIT(task);
+}
@@ -0,0 +1,76 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @enum Subsystem tasks called from `quantum_task()` that publish when they next need servicing.
+ */
+typedef enum {
+    TASK_DEADLINE_COMBO,
+    TASK_DEADLINE_TAP_DANCE,
+    TASK_DEADLINE_LEADER,
+    TASK_DEADLINE_KEY_OVERRIDE,
+    TASK_DEADLINE_WPM,
+    TASK_DEADLINE_AUTO_SHIFT,
+    TASK_DEADLINE_CAPS_WORD,
+    TASK_DEADLINE_SECURE,
+    TASK_DEADLINE_LAYER_LOCK,
+    TASK_DEADLINE_SLIDER,
+    TASK_DEADLINE_SLIDER_MIDI,
+    TASK_DEADLINE_SEND_STRING,
+    TASK_DEADLINE_DYNAMIC_MACRO,
+    TASK_DEADLINE_COUNT,
+} task_deadline_t;
+
+#ifdef TASK_DEADLINE_ENABLE
+
+/**
+ * Checks whether the task's deadline has arrived.
+ *
+ * @param task[in] the task to check
+ * @return true if the task should be called on this iteration of the main loop
+ */
+bool task_deadline_due(task_deadline_t task);
+
+/**
+ * Marks the task as due on the next iteration of the main loop. Called whenever the
+ * subsystem's state changes outside of its task.
+ *
+ * @param task[in] the task to wake
+ */
+void task_deadline_wake(task_deadline_t task);
+
+/**
+ * Marks every task as due on the next iteration of the main loop.
+ */
+void task_deadline_wake_all(void);
+
+/**
+ * Publishes that the task has nothing to do for the next `delay_ms` milliseconds.
+ *
+ * @param task[in] the task to defer
+ * @param delay_ms[in] the number of milliseconds until the task is due again
+ */
+void task_deadline_defer(task_deadline_t task, uint32_t delay_ms);
+
+/**
+ * Publishes that the task has nothing to do until it is woken.
+ *
+ * @param task[in] the task to put to sleep
+ */
+void task_deadline_sleep(task_deadline_t task);
+
+#else
+
+// Every task is always due. The delay is not evaluated, but still counts as used.
+#    define task_deadline_due(task) true
+#    define task_deadline_wake(task)
+#    define task_deadline_wake_all()
+#    define task_deadline_defer(task, delay_ms) ((void)sizeof(delay_ms))
+#    define task_deadline_sleep(task)
+
+#endif // TASK_DEADLINE_ENABLE
@@ -0,0 +1,219 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "task_profile.h"
+#include <string.h>
+#include "timer.h"
+#include "debug.h"
+#include "compiler_support.h"
+
+#ifdef RAW_ENABLE
+#    include "raw_hid.h"
+#endif
+
+#if defined(PROTOCOL_LUFA) || defined(PROTOCOL_VUSB)
+#    include <avr/io.h>
+#    include "timer_avr.h"
+#elif defined(PROTOCOL_CHIBIOS)
+#    include <ch.h>
+#endif
+
+STATIC_ASSERT(TASK_PROFILE_COUNT < TASK_PROFILE_RAW_HID_HEADER, "Too many profiled tasks for the raw HID task id");
+
+static const char *const task_names[TASK_PROFILE_COUNT] = {
+    [TASK_PROFILE_MATRIX]            = "matrix",
+    [TASK_PROFILE_QUANTUM]           = "quantum",
+    [TASK_PROFILE_AUDIO]             = "audio",
+    [TASK_PROFILE_MUSIC]             = "music",
+    [TASK_PROFILE_KEY_OVERRIDE]      = "key_override",
+    [TASK_PROFILE_SEQUENCER]         = "sequencer",
+    [TASK_PROFILE_TAP_DANCE]         = "tap_dance",
+    [TASK_PROFILE_COMBO]             = "combo",
+    [TASK_PROFILE_LEADER]            = "leader",
+    [TASK_PROFILE_WPM]               = "wpm",
+    [TASK_PROFILE_DIP_SWITCH]        = "dip_switch",
+    [TASK_PROFILE_AUTO_SHIFT]        = "auto_shift",
+    [TASK_PROFILE_CAPS_WORD]         = "caps_word",
+    [TASK_PROFILE_SECURE]            = "secure",
+    [TASK_PROFILE_LAYER_LOCK]        = "layer_lock",
+    [TASK_PROFILE_SPLIT_WATCHDOG]    = "split_watchdog",
+    [TASK_PROFILE_RGBLIGHT]          = "rgblight",
+    [TASK_PROFILE_LED_MATRIX]        = "led_matrix",
+    [TASK_PROFILE_RGB_MATRIX]        = "rgb_matrix",
+    [TASK_PROFILE_BACKLIGHT]         = "backlight",
+    [TASK_PROFILE_ENCODER]           = "encoder",
+    [TASK_PROFILE_POINTING_DEVICE]   = "pointing_device",
+    [TASK_PROFILE_OLED]              = "oled",
+    [TASK_PROFILE_ST7565]            = "st7565",
+    [TASK_PROFILE_MOUSEKEY]          = "mousekey",
+    [TASK_PROFILE_PS2_MOUSE]         = "ps2_mouse",
+    [TASK_PROFILE_MIDI]              = "midi",
+    [TASK_PROFILE_JOYSTICK]          = "joystick",
+    [TASK_PROFILE_BATTERY]           = "battery",
+    [TASK_PROFILE_BLUETOOTH]         = "bluetooth",
+    [TASK_PROFILE_HAPTIC]            = "haptic",
+    [TASK_PROFILE_LED]               = "led",
+    [TASK_PROFILE_OS_DETECTION]      = "os_detection",
+    [TASK_PROFILE_SLIDER]            = "slider",
+    [TASK_PROFILE_SEND_STRING]       = "send_string",
+    [TASK_PROFILE_HOST_REPORT_QUEUE] = "host_report_queue",
+    [TASK_PROFILE_DYNAMIC_MACRO]     = "dynamic_macro",
+    [TASK_PROFILE_SLIDER_MIDI]       = "slider_midi",
+};
+
+static task_profile_stats_t task_stats[TASK_PROFILE_COUNT];
+static uint32_t             window_start = 0;
+
+#if defined(PROTOCOL_LUFA) || defined(PROTOCOL_VUSB)
+// Timer0 counts from 0 to TIMER_RAW_TOP once per millisecond.
+__attribute__((weak)) uint32_t task_profile_ticks(void) {
+    uint32_t ms;
+    uint8_t  raw;
+    do {
+        ms  = timer_read32();
+        raw = TIMER_RAW;
+    } while (ms != timer_read32());
+    return ms * (TIMER_RAW_TOP + 1) + raw;
+}
+
+uint32_t task_profile_tick_hz(void) {
+    return (uint32_t)(TIMER_RAW_TOP + 1) * 1000;
+}
+#elif defined(PROTOCOL_CHIBIOS)
+// The realtime counter runs at the core clock, which ChibiOS does not expose portably.
+__attribute__((weak)) uint32_t task_profile_ticks(void) {
+    return chSysGetRealtimeCounterX();
+}
+
+uint32_t task_profile_tick_hz(void) {
+#    ifdef TASK_PROFILE_TICK_HZ
+    return TASK_PROFILE_TICK_HZ;
+#    else
+    return 0;
+#    endif
+}
+#else
+__attribute__((weak)) uint32_t task_profile_ticks(void) {
+    return timer_read32();
+}
+
+uint32_t task_profile_tick_hz(void) {
+#    ifdef TASK_PROFILE_TICK_HZ
+    return TASK_PROFILE_TICK_HZ;
+#    else
+    return 1000;
+#    endif
+}
+#endif
+
+static uint8_t histogram_bucket(uint32_t ticks) {
+    ticks >>= TASK_PROFILE_HISTOGRAM_SHIFT;
+    uint8_t bucket = 0;
+    while (ticks && bucket < TASK_PROFILE_HISTOGRAM_BUCKETS - 1) {
+        ticks >>= 2;
+        bucket++;
+    }
+    return bucket;
+}
+
+void task_profile_record(task_profile_t task, uint32_t start_ticks) {
+    uint32_t              ticks = task_profile_ticks() - start_ticks;
+    task_profile_stats_t *stats = &task_stats[task];
+
+    stats->count++;
+    stats->total_ticks += ticks;
+    if (ticks > stats->max_ticks) {
+        stats->max_ticks = ticks;
+    }
+    uint16_t *bucket = &stats->histogram[histogram_bucket(ticks)];
+    if (*bucket < UINT16_MAX) {
+        (*bucket)++;
+    }
+}
+
+const task_profile_stats_t *task_profile_get(task_profile_t task) {
+    return &task_stats[task];
+}
+
+const char *task_profile_name(task_profile_t task) {
+    return task < TASK_PROFILE_COUNT ? task_names[task] : "unknown";
+}
+
+void task_profile_reset(void) {
+    memset(task_stats, 0, sizeof(task_stats));
+    window_start = timer_read32();
+}
+
+static void pack_u32(uint8_t *data, uint32_t value) {
+    data[0] = value & 0xFF;
+    data[1] = (value >> 8) & 0xFF;
+    data[2] = (value >> 16) & 0xFF;
+    data[3] = (value >> 24) & 0xFF;
+}
+
+void task_profile_pack(uint8_t task, uint8_t *data) {
+    memset(data, 0, 32);
+    data[0] = TASK_PROFILE_RAW_HID_ID;
+    data[1] = task;
+    data[2] = TASK_PROFILE_COUNT;
+    data[3] = TASK_PROFILE_HISTOGRAM_SHIFT;
+
+    if (task == TASK_PROFILE_RAW_HID_HEADER) {
+        pack_u32(&data[4], timer_elapsed32(window_start));
+        pack_u32(&data[8], task_profile_tick_hz());
+        return;
+    }
+    if (task >= TASK_PROFILE_COUNT) {
+        return;
+    }
+
+    const task_profile_stats_t *stats = &task_stats[task];
+    pack_u32(&data[4], stats->count);
+    pack_u32(&data[8], stats->total_ticks);
+    pack_u32(&data[12], stats->max_ticks);
+    for (uint8_t i = 0; i < TASK_PROFILE_HISTOGRAM_BUCKETS; i++) {
+        data[16 + i * 2]     = stats->histogram[i] & 0xFF;
+        data[16 + i * 2 + 1] = stats->histogram[i] >> 8;
+    }
+}
+
+static void print_summary(void) {
+#ifdef CONSOLE_ENABLE
+    dprintf("tprof window=%lu tick_hz=%lu shift=%u\n", timer_elapsed32(window_start), task_profile_tick_hz(), TASK_PROFILE_HISTOGRAM_SHIFT);
+    for (uint8_t task = 0; task < TASK_PROFILE_COUNT; task++) {
+        const task_profile_stats_t *stats = &task_stats[task];
+        if (stats->count == 0) {
+            continue;
+        }
+        dprintf("tprof %s n=%lu total=%lu max=%lu hist=", task_names[task], stats->count, stats->total_ticks, stats->max_ticks);
+        for (uint8_t i = 0; i < TASK_PROFILE_HISTOGRAM_BUCKETS; i++) {
+            dprintf(i ? ",%u" : "%u", stats->histogram[i]);
+        }
+        dprintf("\n");
+    }
+#endif
+}
+
+static void send_summary(void) {
+#if defined(RAW_ENABLE) && defined(TASK_PROFILE_RAW_HID)
+    uint8_t data[32];
+    task_profile_pack(TASK_PROFILE_RAW_HID_HEADER, data);
+    raw_hid_send(data, sizeof(data));
+    for (uint8_t task = 0; task < TASK_PROFILE_COUNT; task++) {
+        if (task_stats[task].count == 0) {
+            continue;
+        }
+        task_profile_pack(task, data);
+        raw_hid_send(data, sizeof(data));
+    }
+#endif
+}
+
+void task_profile_task(void) {
+    if (timer_elapsed32(window_start) < TASK_PROFILE_INTERVAL) {
+        return;
+    }
+    print_summary();
+    send_summary();
+    task_profile_reset();
+}
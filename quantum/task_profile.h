@@ -0,0 +1,161 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+    Per-task CPU profiler for the tasks called from `keyboard_task()`.
+
+    Every wrapped call records its duration in hardware timer ticks. At the end of
+    each `TASK_PROFILE_INTERVAL` window the per-task call count, total and maximum
+    duration, and a duration histogram are printed over the console and, if
+    `TASK_PROFILE_RAW_HID` is defined, sent as raw HID packets. The window is then
+    cleared. `util/task_profile.py` decodes either stream.
+
+    Usage example:
+
+        // Original code:
+        rgb_matrix_task();
+
+        // Replace with:
+        TASK_PROFILE_CALL(TASK_PROFILE_RGB_MATRIX, rgb_matrix_task());
+*/
+
+/** \brief Interval between summaries, in milliseconds. */
+#ifndef TASK_PROFILE_INTERVAL
+#    define TASK_PROFILE_INTERVAL 1000
+#endif
+
+/**
+ * \brief Number of ticks covered by the first histogram bucket, as a power of two.
+ *
+ * Each following bucket covers four times the durations of the previous one, the last
+ * bucket collects everything longer.
+ */
+#ifndef TASK_PROFILE_HISTOGRAM_SHIFT
+#    define TASK_PROFILE_HISTOGRAM_SHIFT 0
+#endif
+
+#define TASK_PROFILE_HISTOGRAM_BUCKETS 8
+
+/** \brief First byte of every raw HID packet sent by the profiler. */
+#ifndef TASK_PROFILE_RAW_HID_ID
+#    define TASK_PROFILE_RAW_HID_ID 0xF7
+#endif
+
+/** \brief Task id of the raw HID packet that opens each summary. */
+#define TASK_PROFILE_RAW_HID_HEADER 0xFF
+
+typedef enum {
+    TASK_PROFILE_MATRIX,
+    TASK_PROFILE_QUANTUM,
+    TASK_PROFILE_AUDIO,
+    TASK_PROFILE_MUSIC,
+    TASK_PROFILE_KEY_OVERRIDE,
+    TASK_PROFILE_SEQUENCER,
+    TASK_PROFILE_TAP_DANCE,
+    TASK_PROFILE_COMBO,
+    TASK_PROFILE_LEADER,
+    TASK_PROFILE_WPM,
+    TASK_PROFILE_DIP_SWITCH,
+    TASK_PROFILE_AUTO_SHIFT,
+    TASK_PROFILE_CAPS_WORD,
+    TASK_PROFILE_SECURE,
+    TASK_PROFILE_LAYER_LOCK,
+    TASK_PROFILE_SPLIT_WATCHDOG,
+    TASK_PROFILE_RGBLIGHT,
+    TASK_PROFILE_LED_MATRIX,
+    TASK_PROFILE_RGB_MATRIX,
+    TASK_PROFILE_BACKLIGHT,
+    TASK_PROFILE_ENCODER,
+    TASK_PROFILE_POINTING_DEVICE,
+    TASK_PROFILE_OLED,
+    TASK_PROFILE_ST7565,
+    TASK_PROFILE_MOUSEKEY,
+    TASK_PROFILE_PS2_MOUSE,
+    TASK_PROFILE_MIDI,
+    TASK_PROFILE_JOYSTICK,
+    TASK_PROFILE_BATTERY,
+    TASK_PROFILE_BLUETOOTH,
+    TASK_PROFILE_HAPTIC,
+    TASK_PROFILE_LED,
+    TASK_PROFILE_OS_DETECTION,
+    TASK_PROFILE_SLIDER,
+    TASK_PROFILE_SEND_STRING,
+    TASK_PROFILE_HOST_REPORT_QUEUE,
+    TASK_PROFILE_DYNAMIC_MACRO,
+    TASK_PROFILE_SLIDER_MIDI,
+    TASK_PROFILE_COUNT,
+} task_profile_t;
+
+typedef struct {
+    uint32_t count;
+    uint32_t total_ticks;
+    uint32_t max_ticks;
+    uint16_t histogram[TASK_PROFILE_HISTOGRAM_BUCKETS];
+} task_profile_stats_t;
+
+#ifdef TASK_PROFILE_ENABLE
+
+/**
+ * \brief Reads the free-running tick counter used to time tasks.
+ *
+ * Weak, so that keyboards can provide a finer-grained timer than the platform default.
+ */
+uint32_t task_profile_ticks(void);
+
+/**
+ * \brief Frequency of `task_profile_ticks()` in Hz, or 0 if unknown.
+ */
+uint32_t task_profile_tick_hz(void);
+
+/**
+ * \brief Records one call of `task` that started at `start_ticks`.
+ */
+void task_profile_record(task_profile_t task, uint32_t start_ticks);
+
+/**
+ * \brief Returns the statistics collected for `task` in the current window.
+ */
+const task_profile_stats_t *task_profile_get(task_profile_t task);
+
+/**
+ * \brief Returns the printable name of `task`.
+ */
+const char *task_profile_name(task_profile_t task);
+
+/**
+ * \brief Clears the statistics of every task and starts a new window.
+ */
+void task_profile_reset(void);
+
+/**
+ * \brief Fills a 32 byte raw HID packet with the statistics of `task`, or with the
+ * summary header if `task` is `TASK_PROFILE_RAW_HID_HEADER`.
+ */
+void task_profile_pack(uint8_t task, uint8_t *data);
+
+/**
+ * \brief Emits the summary and starts a new window once `TASK_PROFILE_INTERVAL` has passed.
+ */
+void task_profile_task(void);
+
+#    define TASK_PROFILE_CALL(task, call)                  \
+        do {                                               \
+            uint32_t profile_start = task_profile_ticks(); \
+            call;                                          \
+            task_profile_record(task, profile_start);      \
+        } while (0)
+
+#else
+
+#    define TASK_PROFILE_CALL(task, call) \
+        do {                              \
+            call;                         \
+        } while (0)
+#    define task_profile_task()
+
+#endif // TASK_PROFILE_ENABLE
@@ -31,6 +31,11 @@ void MockBackingStore::reset_instance() {
     lock_success_callback   = [](std::uint64_t) { return true; };
 
     write_log.clear();
+
+    backing_write_time_us   = MOCK_WRITE_TIME_US::value;
+    backing_erase_time_us   = MOCK_ERASE_TIME_US::value;
+    backing_elapsed_time_us = 0;
+    backing_max_latency_us  = 0;
 }
 
 bool MockBackingStore::init(void) {
@@ -56,6 +61,7 @@ bool MockBackingStore::unlock(void) {
 
 bool MockBackingStore::erase(void) {
     ++backing_erase_invoke_count;
+    backing_elapsed_time_us += backing_erase_time_us;
 
     // Erase each slot
     for (std::size_t i = 0; i < backing_storage.size(); ++i) {
@@ -83,6 +89,8 @@ bool MockBackingStore::write(uint32_t address, backing_store_int_t value) {
     EXPECT_TRUE(address + BACKING_STORE_WRITE_SIZE <= WEAR_LEVELING_BACKING_SIZE) << "Address would result of out-of-bounds access";
     EXPECT_FALSE(is_locked()) << "Write was attempted without being unlocked first";
 
+    backing_elapsed_time_us += backing_write_time_us;
+
     // Drop out of write early with failure if we need to
     if (write_success_callback && !write_success_callback(backing_write_invoke_count, address)) {
         return false;
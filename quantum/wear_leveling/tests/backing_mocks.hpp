@@ -21,6 +21,10 @@ using MOCK_WRITE_LOG_MAX_ENTRIES = std::integral_constant<std::size_t, 1024>;
 using BACKING_STORE_INTEGRAL_COMPLEMENT = std::integral_constant<backing_store_int_t, ((backing_store_int_t)(~(backing_store_int_t)0))>;
 // Total number of elements stored in the backing arrays
 using BACKING_STORE_ELEMENT_COUNT = std::integral_constant<std::size_t, (WEAR_LEVELING_BACKING_SIZE / sizeof(backing_store_int_t))>;
+// Default simulated time taken by a single backing store write, in microseconds
+using MOCK_WRITE_TIME_US = std::integral_constant<std::uint64_t, 50>;
+// Default simulated time taken by a backing store erase, in microseconds
+using MOCK_ERASE_TIME_US = std::integral_constant<std::uint64_t, 20000>;
 
 class MockBackingStoreElement {
    private:
@@ -90,6 +94,14 @@ class MockBackingStore {
     // The write log for the backing store
     std::vector<MockBackingStoreLogEntry> write_log;
 
+    // The simulated time taken by each write and erase
+    std::uint64_t backing_write_time_us;
+    std::uint64_t backing_erase_time_us;
+    // The total simulated time spent writing and erasing
+    std::uint64_t backing_elapsed_time_us;
+    // The longest simulated time spent in a single measured operation
+    std::uint64_t backing_max_latency_us;
+
     // The number of times each API was invoked
     std::uint64_t backing_init_invoke_count;
     std::uint64_t backing_unlock_invoke_count;
@@ -130,6 +142,41 @@ class MockBackingStore {
     std::uint64_t total_write_count() const {
         return backing_total_write_count;
     }
+    // The max number of erases of an element of the backing store
+    std::uint64_t max_erase_count() const {
+        std::uint64_t count = 0;
+        for (auto&& e : backing_storage)
+            count = std::max<std::uint64_t>(count, e.num_erases());
+        return count;
+    }
+
+    // Simulated timing of the backing store
+    std::uint64_t elapsed_time_us() const {
+        return backing_elapsed_time_us;
+    }
+    std::uint64_t max_latency_us() const {
+        return backing_max_latency_us;
+    }
+    void set_timing(std::uint64_t write_time_us, std::uint64_t erase_time_us) {
+        backing_write_time_us = write_time_us;
+        backing_erase_time_us = erase_time_us;
+    }
+    void reset_max_latency() {
+        backing_max_latency_us = 0;
+    }
+
+    // Invokes the operation, keeping track of the longest simulated time any measured operation spent in the backing store
+    template <typename Operation>
+    auto measure(Operation&& operation) -> decltype(operation()) {
+        struct Measurement {
+            MockBackingStore& store;
+            std::uint64_t     start;
+            ~Measurement() {
+                store.backing_max_latency_us = std::max(store.backing_max_latency_us, store.backing_elapsed_time_us - start);
+            }
+        } measurement{*this, backing_elapsed_time_us};
+        return operation();
+    }
 
     // The number of times each API was invoked
     std::uint64_t init_invoke_count() const {
@@ -64,3 +64,57 @@ wear_leveling_8byte_SRC := \
 	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_8byte.cpp
 wear_leveling_8byte_INC := \
 	$(wear_leveling_common_INC)
+
+wear_leveling_write_behind_DEFS := \
+	$(wear_leveling_common_DEFS) \
+	-DBACKING_STORE_WRITE_SIZE=2 \
+	-DWEAR_LEVELING_BACKING_SIZE=512 \
+	-DWEAR_LEVELING_LOGICAL_SIZE=128 \
+	-DWEAR_LEVELING_WRITE_BEHIND \
+	-DWEAR_LEVELING_WRITE_BEHIND_RANGES=4
+wear_leveling_write_behind_SRC := \
+	$(wear_leveling_common_SRC) \
+	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_write_behind.cpp
+wear_leveling_write_behind_INC := \
+	$(wear_leveling_common_INC)
+
+wear_leveling_simulation_common_SRC := \
+	$(wear_leveling_common_SRC) \
+	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_simulation.cpp
+wear_leveling_simulation_common_DEFS := \
+	$(wear_leveling_common_DEFS) \
+	-DWEAR_LEVELING_BACKING_SIZE=4096 \
+	-DWEAR_LEVELING_LOGICAL_SIZE=1024
+
+wear_leveling_simulation_2byte_DEFS := \
+	$(wear_leveling_simulation_common_DEFS) \
+	-DBACKING_STORE_WRITE_SIZE=2
+wear_leveling_simulation_2byte_SRC := \
+	$(wear_leveling_simulation_common_SRC)
+wear_leveling_simulation_2byte_INC := \
+	$(wear_leveling_common_INC)
+
+wear_leveling_simulation_4byte_DEFS := \
+	$(wear_leveling_simulation_common_DEFS) \
+	-DBACKING_STORE_WRITE_SIZE=4
+wear_leveling_simulation_4byte_SRC := \
+	$(wear_leveling_simulation_common_SRC)
+wear_leveling_simulation_4byte_INC := \
+	$(wear_leveling_common_INC)
+
+wear_leveling_simulation_8byte_DEFS := \
+	$(wear_leveling_simulation_common_DEFS) \
+	-DBACKING_STORE_WRITE_SIZE=8
+wear_leveling_simulation_8byte_SRC := \
+	$(wear_leveling_simulation_common_SRC)
+wear_leveling_simulation_8byte_INC := \
+	$(wear_leveling_common_INC)
+
+wear_leveling_simulation_2byte_write_behind_DEFS := \
+	$(wear_leveling_simulation_common_DEFS) \
+	-DBACKING_STORE_WRITE_SIZE=2 \
+	-DWEAR_LEVELING_WRITE_BEHIND
+wear_leveling_simulation_2byte_write_behind_SRC := \
+	$(wear_leveling_simulation_common_SRC)
+wear_leveling_simulation_2byte_write_behind_INC := \
+	$(wear_leveling_common_INC)
@@ -3,4 +3,9 @@ TEST_LIST += \
 	wear_leveling_2byte_optimized_writes \
 	wear_leveling_2byte \
 	wear_leveling_4byte \
-	wear_leveling_8byte
+	wear_leveling_8byte \
+	wear_leveling_write_behind \
+	wear_leveling_simulation_2byte \
+	wear_leveling_simulation_4byte \
+	wear_leveling_simulation_8byte \
+	wear_leveling_simulation_2byte_write_behind
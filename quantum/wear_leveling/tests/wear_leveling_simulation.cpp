@@ -0,0 +1,221 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <functional>
+#include <string>
+#include "benchmark_util.hpp"
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "backing_mocks.hpp"
+
+/*
+    Replays long synthetic usage traces against the mock backing store and reports:
+        - write amplification: bytes written to the backing store, including
+            consolidation, per logical byte written
+        - erases per logical byte written, which scales inversely with the
+            flash lifetime
+        - the longest time a single write, or a single housekeeping step in
+            write-behind mode, spends in the backing store
+
+    The same traces are built for each BACKING_STORE_WRITE_SIZE, with the same
+    backing and logical sizes, so that the results can be compared directly.
+    Every backing store write costs the same simulated time regardless of its
+    width, see backing_mocks.hpp.
+
+    Logical addresses follow the default EEPROM layout: eeconfig, then VIA's
+    config block, then the dynamic keymap of a 60-key board with 4 layers.
+
+    Run a single configuration with, for example:
+        make test:wear_leveling_simulation_4byte
+*/
+
+#ifdef WEAR_LEVELING_WRITE_BEHIND
+#    define SIM_MODE "write-behind"
+#else
+#    define SIM_MODE "write-through"
+#endif
+
+// Offsets into eeprom_core_t, see nvm_eeprom_eeconfig_internal.h
+#define SIM_EECONFIG_KEYMAP 4
+#define SIM_EECONFIG_RGB_MATRIX 23
+#define SIM_EECONFIG_RGB_MATRIX_SIZE 8
+// Start of the dynamic keymap, after eeconfig and VIA's magic and layout options
+#define SIM_DYNAMIC_KEYMAP_ADDR 41
+#define SIM_DYNAMIC_KEYMAP_KEYS (4 * 60)
+
+STATIC_ASSERT(SIM_DYNAMIC_KEYMAP_ADDR + SIM_DYNAMIC_KEYMAP_KEYS * 2 <= WEAR_LEVELING_LOGICAL_SIZE, "Simulated keymap does not fit in the logical size");
+
+class WearLevelingSimulation : public ::testing::Test {
+   protected:
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> shadow;
+
+    std::uint64_t logical_writes;
+    std::uint64_t logical_bytes;
+    std::uint64_t max_write_us;
+    std::uint64_t max_housekeeping_us;
+    std::uint32_t rng;
+
+    void SetUp() override {
+        MockBackingStore::Instance().reset_instance();
+        wear_leveling_init();
+        shadow.fill(0);
+        logical_writes      = 0;
+        logical_bytes       = 0;
+        max_write_us        = 0;
+        max_housekeeping_us = 0;
+        rng                 = 1;
+    }
+
+    std::uint32_t random(std::uint32_t range) {
+        rng = rng * 1664525 + 1013904223;
+        return (rng >> 8) % range;
+    }
+
+    // Writes through the same path as eeprom_update_block(): nothing is written unless the block changed
+    void update(std::uint32_t address, const void* value, std::size_t length) {
+        if (memcmp(&shadow[address], value, length) == 0) {
+            return;
+        }
+        memcpy(&shadow[address], value, length);
+        ++logical_writes;
+        logical_bytes += length;
+
+        auto& inst = MockBackingStore::Instance();
+        inst.reset_max_latency();
+        EXPECT_NE(inst.measure([&] { return wear_leveling_write(address, value, length); }), WEAR_LEVELING_FAILED) << "Write failed at logical address " << address;
+        max_write_us = std::max(max_write_us, inst.max_latency_us());
+    }
+
+    void update_byte(std::uint32_t address, std::uint8_t value) {
+        update(address, &value, sizeof(value));
+    }
+
+    // dynamic_keymap_set_keycode() stores keycodes big-endian, one byte at a time
+    void update_keycode(std::uint16_t key, std::uint16_t keycode) {
+        update_byte(SIM_DYNAMIC_KEYMAP_ADDR + key * 2, keycode >> 8);
+        update_byte(SIM_DYNAMIC_KEYMAP_ADDR + key * 2 + 1, keycode & 0xFF);
+    }
+
+    // Mostly basic keycodes, with some KC_NO/KC_TRNS and modified keycodes
+    std::uint16_t random_keycode() {
+        switch (random(8)) {
+            case 0:
+                return random(2);
+            case 1:
+                return 0x0200 | (0x04 + random(0x64));
+            default:
+                return 0x04 + random(0x64);
+        }
+    }
+
+    // The keyboard goes idle, giving write-behind housekeeping a chance to run
+    void idle() {
+        auto& inst = MockBackingStore::Instance();
+        while (wear_leveling_pending() > 0) {
+            inst.reset_max_latency();
+            EXPECT_NE(inst.measure([] { return wear_leveling_housekeeping(); }), WEAR_LEVELING_FAILED) << "Housekeeping failed";
+            max_housekeeping_us = std::max(max_housekeeping_us, inst.max_latency_us());
+        }
+    }
+
+    // Power cycles, and checks that everything written is played back
+    void verify() {
+        idle();
+        EXPECT_NE(wear_leveling_init(), WEAR_LEVELING_FAILED) << "Initialisation failed";
+        std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> data;
+        wear_leveling_read(0, data.data(), data.size());
+        EXPECT_EQ(data, shadow) << "Data was not played back after power loss";
+    }
+
+    void report(const char* trace) {
+        auto&  inst          = MockBackingStore::Instance();
+        double amplification = (double)(inst.total_write_count() * BACKING_STORE_WRITE_SIZE) / logical_bytes;
+        double erases        = (double)inst.erasure_count() / logical_bytes;
+        report_benchmark(std::to_string(BACKING_STORE_WRITE_SIZE) + "-byte " + SIM_MODE + " " + trace, {{"writes", logical_writes}, {"bytes", logical_bytes}, {"write-amplification", amplification}, {"erases/MB", erases * 1000000}, {"longest-write", max_write_us, "us"}, {"longest-housekeeping", max_housekeeping_us, "us"}});
+    }
+
+    void replay(const char* trace, std::size_t iterations, std::function<void()> step) {
+        for (std::size_t i = 1; i <= iterations; ++i) {
+            step();
+            idle();
+            if (i % 1000 == 0) {
+                verify();
+            }
+        }
+        verify();
+        report(trace);
+        EXPECT_GT(logical_bytes, 0) << "Trace did not write anything";
+    }
+};
+
+/**
+ * Changing single keys in VIA's keymap editor.
+ */
+TEST_F(WearLevelingSimulation, ViaKeycodeEdits) {
+    replay("via_keycode_edits", 20000, [&] { update_keycode(random(SIM_DYNAMIC_KEYMAP_KEYS), random_keycode()); });
+}
+
+/**
+ * Loading a whole layout from a file in VIA, which writes the keymap one byte at a time.
+ */
+TEST_F(WearLevelingSimulation, ViaLayoutLoads) {
+    replay("via_layout_loads", 200, [&] {
+        for (std::uint16_t key = 0; key < SIM_DYNAMIC_KEYMAP_KEYS; ++key) {
+            update_keycode(key, random(3) ? random_keycode() : 1);
+        }
+    });
+}
+
+/**
+ * Holding down a hue or brightness key, saving the RGB matrix config on every step.
+ */
+TEST_F(WearLevelingSimulation, RgbAdjustments) {
+    std::uint8_t config[SIM_EECONFIG_RGB_MATRIX_SIZE] = {1, 1, 0, 255, 255, 128, 0, 0};
+    replay("rgb_adjustments", 5000, [&] {
+        std::uint8_t field = 2 + random(3);
+        for (std::uint32_t step = 5 + random(25); step > 0; --step) {
+            config[field] += 8;
+            update(SIM_EECONFIG_RGB_MATRIX, config, sizeof(config));
+        }
+        if (random(10) == 0) {
+            config[1] = 1 + random(40); // mode change
+            update(SIM_EECONFIG_RGB_MATRIX, config, sizeof(config));
+        }
+    });
+}
+
+/**
+ * Toggling autocorrect, stored as a bit of the keymap config.
+ */
+TEST_F(WearLevelingSimulation, AutocorrectToggles) {
+    std::uint16_t keymap_config = 0x0400;
+    replay("autocorrect_toggles", 20000, [&] {
+        keymap_config ^= 0x4000;
+        update(SIM_EECONFIG_KEYMAP, &keymap_config, sizeof(keymap_config));
+    });
+}
+
+/**
+ * A mix of all of the above, weighted towards lighting and autocorrect changes.
+ */
+TEST_F(WearLevelingSimulation, MixedUsage) {
+    std::uint8_t  config[SIM_EECONFIG_RGB_MATRIX_SIZE] = {1, 1, 0, 255, 255, 128, 0, 0};
+    std::uint16_t keymap_config                        = 0x0400;
+    replay("mixed_usage", 20000, [&] {
+        std::uint32_t kind = random(100);
+        if (kind < 50) {
+            for (std::uint32_t step = 1 + random(10); step > 0; --step) {
+                config[2] += 8;
+                update(SIM_EECONFIG_RGB_MATRIX, config, sizeof(config));
+            }
+        } else if (kind < 80) {
+            keymap_config ^= 0x4000;
+            update(SIM_EECONFIG_KEYMAP, &keymap_config, sizeof(keymap_config));
+        } else if (kind < 99) {
+            update_keycode(random(SIM_DYNAMIC_KEYMAP_KEYS), random_keycode());
+        } else {
+            for (std::uint16_t key = 0; key < SIM_DYNAMIC_KEYMAP_KEYS; ++key) {
+                update_keycode(key, random_keycode());
+            }
+        }
+    });
+}
@@ -0,0 +1,245 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "benchmark_util.hpp"
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "backing_mocks.hpp"
+
+class WearLevelingWriteBehind : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        MockBackingStore::Instance().reset_instance();
+        wear_leveling_init();
+    }
+};
+
+template <typename T>
+static T read_value(uint32_t address) {
+    T value{};
+    wear_leveling_read(address, &value, sizeof(value));
+    return value;
+}
+
+/**
+ * This test verifies that writes only reach the backing store once housekeeping is performed, and are served from the
+ * cache in the meantime.
+ */
+TEST_F(WearLevelingWriteBehind, WritesAreStagedUntilHousekeeping) {
+    auto&    inst  = MockBackingStore::Instance();
+    uint32_t value = 0x12345678;
+    EXPECT_EQ(wear_leveling_write(80, &value, sizeof(value)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    EXPECT_EQ(inst.write_invoke_count(), 0) << "Staged write reached the backing store";
+    EXPECT_EQ(wear_leveling_pending(), 1) << "Write was not staged";
+    EXPECT_EQ(read_value<uint32_t>(80), value) << "Staged data was not served from the cache";
+
+    // A 4-byte multibyte log entry uses 4 backing store writes
+    EXPECT_EQ(wear_leveling_housekeeping(), WEAR_LEVELING_SUCCESS) << "Housekeeping returned incorrect status";
+    EXPECT_EQ(wear_leveling_pending(), 0) << "Range was still staged after housekeeping";
+    EXPECT_EQ(inst.write_invoke_count(), 4) << "Unexpected number of backing store writes";
+    EXPECT_TRUE(inst.is_locked()) << "Backing store was left unlocked";
+
+    // Nothing left to do
+    EXPECT_EQ(wear_leveling_housekeeping(), WEAR_LEVELING_SUCCESS) << "Housekeeping returned incorrect status";
+    EXPECT_EQ(inst.write_invoke_count(), 4) << "Unexpected number of backing store writes";
+
+    // The data is played back from the write log
+    wear_leveling_init();
+    EXPECT_EQ(read_value<uint32_t>(80), value) << "Data was not written to the backing store";
+}
+
+/**
+ * This test verifies that repeated writes to the same or neighbouring addresses are merged into a single staged range.
+ */
+TEST_F(WearLevelingWriteBehind, OverlappingAndAdjacentWritesAreMerged) {
+    auto& inst = MockBackingStore::Instance();
+    for (uint16_t i = 2; i < 100; ++i) {
+        uint16_t next = i + 1;
+        wear_leveling_write(100, &i, sizeof(i));
+        wear_leveling_write(102, &next, sizeof(next));
+    }
+    EXPECT_EQ(wear_leveling_pending(), 1) << "Adjacent writes were not merged";
+
+    uint8_t value = 0x42;
+    wear_leveling_write(99, &value, sizeof(value));
+    EXPECT_EQ(wear_leveling_pending(), 1) << "Touching write was not merged";
+    wear_leveling_write(110, &value, sizeof(value));
+    EXPECT_EQ(wear_leveling_pending(), 2) << "Separate write was merged";
+    EXPECT_EQ(inst.write_invoke_count(), 0) << "Staged write reached the backing store";
+
+    // 99..103 fits in a single multibyte log entry, 110 in another
+    EXPECT_EQ(wear_leveling_flush(), WEAR_LEVELING_SUCCESS) << "Flush returned incorrect status";
+    EXPECT_EQ(wear_leveling_pending(), 0) << "Ranges were still staged after flush";
+    EXPECT_EQ(inst.write_invoke_count(), 4 + 2) << "Unexpected number of backing store writes";
+
+    wear_leveling_init();
+    EXPECT_EQ(read_value<uint8_t>(99), 0x42) << "Merged data was not written to the backing store";
+    EXPECT_EQ(read_value<uint16_t>(100), 99) << "Merged data was not written to the backing store";
+    EXPECT_EQ(read_value<uint16_t>(102), 100) << "Merged data was not written to the backing store";
+    EXPECT_EQ(read_value<uint8_t>(110), 0x42) << "Merged data was not written to the backing store";
+}
+
+/**
+ * This test verifies that a write to an older staged range does not get it written out after the ranges staged since,
+ * such as when clearing a length, writing the data, and then setting the length.
+ */
+TEST_F(WearLevelingWriteBehind, WritesToOlderRangesKeepTheirOrder) {
+    auto&    inst   = MockBackingStore::Instance();
+    uint16_t length = 5;
+    wear_leveling_write(64, &length, sizeof(length));
+    EXPECT_EQ(wear_leveling_flush(), WEAR_LEVELING_SUCCESS) << "Flush returned incorrect status";
+
+    uint8_t data[10];
+    memset(data, 0x42, sizeof(data));
+    length = 0;
+    wear_leveling_write(64, &length, sizeof(length));
+    wear_leveling_write(80, data, sizeof(data));
+    std::uint64_t writes = inst.write_invoke_count();
+    length               = sizeof(data);
+    wear_leveling_write(64, &length, sizeof(length));
+    EXPECT_GT(inst.write_invoke_count(), writes) << "Older staged range was not written out";
+    EXPECT_EQ(wear_leveling_pending(), 2) << "Unexpected number of staged ranges";
+
+    // Power loss after writing out the data, but not the new length
+    EXPECT_EQ(wear_leveling_housekeeping(), WEAR_LEVELING_SUCCESS) << "Housekeeping returned incorrect status";
+    wear_leveling_init();
+    EXPECT_EQ(read_value<uint16_t>(64), 0) << "Length was not cleared before the data was written";
+    EXPECT_EQ(read_value<uint8_t>(80), 0x42) << "Data was not written";
+}
+
+/**
+ * This test verifies that once all staging slots are in use, the oldest staged range is written out to make room, and
+ * that only data which is still staged is lost on power loss.
+ */
+TEST_F(WearLevelingWriteBehind, OldestRangeIsWrittenWhenFull) {
+    auto&   inst  = MockBackingStore::Instance();
+    uint8_t value = 0x55;
+    for (uint32_t address = 70; address < 70 + 10 * (WEAR_LEVELING_WRITE_BEHIND_RANGES + 1); address += 10) {
+        EXPECT_EQ(wear_leveling_write(address, &value, sizeof(value)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    }
+    EXPECT_EQ(wear_leveling_pending(), WEAR_LEVELING_WRITE_BEHIND_RANGES) << "Unexpected number of staged ranges";
+    EXPECT_EQ(inst.write_invoke_count(), 2) << "Only the oldest range should have been written";
+
+    wear_leveling_init();
+    EXPECT_EQ(read_value<uint8_t>(70), 0x55) << "Oldest range was not written";
+    for (uint32_t address = 80; address < 70 + 10 * (WEAR_LEVELING_WRITE_BEHIND_RANGES + 1); address += 10) {
+        EXPECT_EQ(read_value<uint8_t>(address), 0) << "Staged range was written";
+    }
+}
+
+/**
+ * This test verifies that housekeeping consolidates instead of writing staged data that would overflow the write log.
+ */
+TEST_F(WearLevelingWriteBehind, ConsolidatesInsteadOfOverflowingLog) {
+    auto& inst = MockBackingStore::Instance();
+
+    // Each 5-byte write is one 8-byte log entry; 45 of them leave room for two more
+    uint8_t value[5];
+    for (uint8_t i = 0; i < 45; ++i) {
+        memset(value, i + 2, sizeof(value));
+        wear_leveling_write(64, value, sizeof(value));
+        EXPECT_EQ(wear_leveling_housekeeping(), WEAR_LEVELING_SUCCESS) << "Housekeeping returned incorrect status";
+    }
+    EXPECT_EQ(inst.erasure_count(), 0) << "Log was consolidated early";
+
+    memset(value, 0xAA, sizeof(value));
+    wear_leveling_write(64, value, sizeof(value));
+    memset(value, 0xBB, sizeof(value));
+    wear_leveling_write(80, value, sizeof(value));
+    EXPECT_EQ(wear_leveling_pending(), 2) << "Unexpected number of staged ranges";
+
+    // Consolidation writes the logical area and its hash, and nothing to the write log
+    std::uint64_t writes = inst.write_invoke_count();
+    EXPECT_EQ(wear_leveling_housekeeping(), WEAR_LEVELING_CONSOLIDATED) << "Housekeeping returned incorrect status";
+    EXPECT_EQ(wear_leveling_pending(), 0) << "Ranges were still staged after consolidation";
+    EXPECT_EQ(inst.erasure_count(), 1) << "Unexpected number of erases";
+    EXPECT_EQ(inst.write_invoke_count() - writes, (WEAR_LEVELING_LOGICAL_SIZE + 8) / BACKING_STORE_WRITE_SIZE) << "Unexpected number of backing store writes";
+
+    wear_leveling_init();
+    EXPECT_EQ(read_value<uint8_t>(64), 0xAA) << "Staged data was not consolidated";
+    EXPECT_EQ(read_value<uint8_t>(84), 0xBB) << "Staged data was not consolidated";
+}
+
+/**
+ * This test verifies that erasing drops any staged data.
+ */
+TEST_F(WearLevelingWriteBehind, EraseDropsStagedWrites) {
+    auto&    inst  = MockBackingStore::Instance();
+    uint16_t value = 0x1234;
+    wear_leveling_write(90, &value, sizeof(value));
+    EXPECT_EQ(wear_leveling_erase(), WEAR_LEVELING_SUCCESS) << "Erase returned incorrect status";
+    EXPECT_EQ(wear_leveling_pending(), 0) << "Range was still staged after erase";
+    EXPECT_EQ(read_value<uint16_t>(90), 0) << "Cache was not cleared";
+    EXPECT_EQ(wear_leveling_flush(), WEAR_LEVELING_SUCCESS) << "Flush returned incorrect status";
+    EXPECT_EQ(inst.write_invoke_count(), 0) << "Erased data reached the backing store";
+}
+
+/**
+ * This test verifies that a failed write during housekeeping leaves the data staged, so that it can be retried.
+ */
+TEST_F(WearLevelingWriteBehind, FailedHousekeepingKeepsDataStaged) {
+    auto&    inst  = MockBackingStore::Instance();
+    uint16_t value = 0x4321;
+    wear_leveling_write(90, &value, sizeof(value));
+
+    inst.set_write_callback([](std::uint64_t, std::uint32_t) { return false; });
+    EXPECT_EQ(wear_leveling_housekeeping(), WEAR_LEVELING_FAILED) << "Housekeeping returned incorrect status";
+    EXPECT_EQ(wear_leveling_pending(), 1) << "Range was dropped after a failure";
+    EXPECT_TRUE(inst.is_locked()) << "Backing store was left unlocked";
+
+    inst.set_write_callback([](std::uint64_t, std::uint32_t) { return true; });
+    EXPECT_EQ(wear_leveling_housekeeping(), WEAR_LEVELING_SUCCESS) << "Housekeeping returned incorrect status";
+    EXPECT_EQ(wear_leveling_pending(), 0) << "Range was still staged after housekeeping";
+
+    wear_leveling_init();
+    EXPECT_EQ(read_value<uint16_t>(90), 0x4321) << "Data was not written on retry";
+}
+
+/**
+ * Replays bursts of lighting adjustments and keymap edits, each followed by idle time in which housekeeping runs, and
+ * reports the longest time any single write and any single housekeeping step spends in the backing store.
+ */
+TEST_F(WearLevelingWriteBehind, BenchmarkWriteLatency) {
+    auto&         inst             = MockBackingStore::Instance();
+    std::uint64_t max_write_us     = 0;
+    std::uint64_t max_housekeep_us = 0;
+    std::uint64_t logical_writes   = 0;
+    uint32_t      rng              = 1;
+    auto          random           = [&](uint32_t range) {
+        rng = rng * 1664525 + 1013904223;
+        return (rng >> 8) % range;
+    };
+
+    for (int burst = 0; burst < 500; ++burst) {
+        if (random(2)) {
+            // Holding down a lighting adjustment key saves the lighting config on every step
+            uint32_t config = random(0x10000);
+            for (uint32_t step = random(20) + 5; step > 0; --step) {
+                config += 0x010203;
+                inst.reset_max_latency();
+                EXPECT_NE(inst.measure([&] { return wear_leveling_write(32, &config, sizeof(config)); }), WEAR_LEVELING_FAILED);
+                max_write_us = std::max(max_write_us, inst.max_latency_us());
+                ++logical_writes;
+            }
+        } else {
+            // Changing a key in the keymap editor
+            uint16_t keycode = random(4) ? random(0x100) : random(2);
+            inst.reset_max_latency();
+            EXPECT_NE(inst.measure([&] { return wear_leveling_write(64 + 2 * random(32), &keycode, sizeof(keycode)); }), WEAR_LEVELING_FAILED);
+            max_write_us = std::max(max_write_us, inst.max_latency_us());
+            ++logical_writes;
+        }
+
+        while (wear_leveling_pending() > 0) {
+            inst.reset_max_latency();
+            EXPECT_NE(inst.measure([] { return wear_leveling_housekeeping(); }), WEAR_LEVELING_FAILED);
+            max_housekeep_us = std::max(max_housekeep_us, inst.max_latency_us());
+        }
+    }
+
+    report_benchmark("write-behind", {{"writes", logical_writes}, {"backing-writes", inst.total_write_count()}, {"erases", inst.erasure_count()}, {"longest-write", max_write_us, "us"}, {"longest-housekeeping", max_housekeep_us, "us"}});
+
+    // Erases only ever happen during housekeeping
+    EXPECT_GT(inst.erasure_count(), 0) << "Benchmark did not exercise consolidation";
+    EXPECT_EQ(max_write_us, 0) << "Writes reached the backing store in-line";
+    EXPECT_GE(max_housekeep_us, MOCK_ERASE_TIME_US::value) << "Consolidation was not measured";
+}
@@ -77,6 +77,15 @@
             * A new write log entry is appended to the log.
             * If the log's full, data is consolidated and the write log cleared.
 
+        During writes, in write-behind mode (WEAR_LEVELING_WRITE_BEHIND):
+            * The cache is updated with the new data.
+            * Any staged range but the newest that the write overlaps is
+                written out first, along with every range staged before it.
+            * The written range is merged with the newest staged range if it
+                overlaps or touches it, or staged after it otherwise.
+            * Housekeeping later appends the staged ranges to the write log,
+                or consolidates directly if they would not fit in it.
+
     Write log structure:
 
         The first 8 bytes of the write log are a FNV1a_64 hash of the contents
@@ -165,6 +174,25 @@ static struct __attribute__((__aligned__(BACKING_STORE_WRITE_SIZE))) {
     bool                                                           unlocked;
 } wear_leveling;
 
+#ifdef WEAR_LEVELING_WRITE_BEHIND
+/**
+ * A range of logical data updated in the cache but not yet written to the backing store.
+ */
+typedef struct wear_leveling_range_t {
+    uint32_t address;
+    uint32_t length;
+} wear_leveling_range_t;
+
+/**
+ * Storage area for staged writes, oldest first. Staged ranges never overlap each other, and are written out in the
+ * order they were staged.
+ */
+static struct {
+    wear_leveling_range_t ranges[(WEAR_LEVELING_WRITE_BEHIND_RANGES)];
+    uint8_t               count;
+} write_behind;
+#endif // WEAR_LEVELING_WRITE_BEHIND
+
 /**
  * Locking helper: status
  */
@@ -204,6 +232,9 @@ static inline backing_store_lock_status_t wear_leveling_lock(void) {
 static void wear_leveling_clear_cache(void) {
     memset(wear_leveling.cache, 0, (WEAR_LEVELING_LOGICAL_SIZE));
     wear_leveling.write_address = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 is due to the FNV1a_64 of the consolidated buffer
+#ifdef WEAR_LEVELING_WRITE_BEHIND
+    write_behind.count = 0;
+#endif // WEAR_LEVELING_WRITE_BEHIND
 }
 
 /**
@@ -319,6 +350,13 @@ static wear_leveling_status_t wear_leveling_consolidate_force(void) {
     // Next write of the log occurs after the consolidated values at the start of the backing store.
     wear_leveling.write_address = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 due to the FNV1a_64 of the consolidated area
 
+#ifdef WEAR_LEVELING_WRITE_BEHIND
+    // The consolidated data is the whole cache, so anything staged has now been written
+    if (status != WEAR_LEVELING_FAILED) {
+        write_behind.count = 0;
+    }
+#endif // WEAR_LEVELING_WRITE_BEHIND
+
     return status;
 }
 
@@ -470,6 +508,89 @@ static wear_leveling_status_t wear_leveling_write_raw(uint32_t address, const vo
     return status;
 }
 
+#ifdef WEAR_LEVELING_WRITE_BEHIND
+/**
+ * Upper bound of the write log space needed to store a staged range, ignoring the 2-byte backing store optimizations.
+ */
+static uint32_t wear_leveling_staged_log_size(uint32_t length) {
+    uint32_t size = (length / LOG_ENTRY_MULTIBYTE_MAX_BYTES) * LOG_ENTRY_MULTIBYTE_SIZE(LOG_ENTRY_MULTIBYTE_MAX_BYTES);
+    if (length % LOG_ENTRY_MULTIBYTE_MAX_BYTES) {
+        size += LOG_ENTRY_MULTIBYTE_SIZE(length % LOG_ENTRY_MULTIBYTE_MAX_BYTES);
+    }
+    return size;
+}
+
+/**
+ * Removes a staged range, keeping the remainder in order of age.
+ */
+static void wear_leveling_unstage(uint8_t index) {
+    memmove(&write_behind.ranges[index], &write_behind.ranges[index + 1], (write_behind.count - index - 1) * sizeof(wear_leveling_range_t));
+    write_behind.count--;
+}
+
+/**
+ * Writes out the staged ranges up to the newest one, other than the newest staged range, that a write to the given
+ * range overlaps. Staged ranges are written out with whatever the cache holds at the time, so this has to happen
+ * before the cache is updated, and merging the write into such a range instead would get it written out ahead of the
+ * ranges staged after it.
+ */
+static wear_leveling_status_t wear_leveling_write_out_overlapped(uint32_t address, size_t length) {
+    const uint32_t end   = address + (uint32_t)length;
+    uint8_t        count = 0;
+    for (uint8_t i = 0; i + 1 < write_behind.count; ++i) {
+        const wear_leveling_range_t range = write_behind.ranges[i];
+        if (range.address < end && address < range.address + range.length) {
+            count = i + 1;
+        }
+    }
+
+    wear_leveling_status_t status = WEAR_LEVELING_SUCCESS;
+    for (; count > 0 && write_behind.count > 0; --count) {
+        // Consolidation empties the staging area, ending the loop
+        status = wear_leveling_housekeeping();
+        if (status == WEAR_LEVELING_FAILED) {
+            return status;
+        }
+    }
+    return status;
+}
+
+/**
+ * Stages a range of the cache to be written to the backing store later, merging it with the newest staged range if it
+ * overlaps or touches it. Merged writes are written out together, in address order rather than in the order they were
+ * made. The oldest staged range is written out first if there's no room left.
+ */
+static wear_leveling_status_t wear_leveling_stage(uint32_t address, size_t length) {
+    uint32_t start = address;
+    uint32_t end   = address + (uint32_t)length;
+    if (write_behind.count > 0) {
+        wear_leveling_range_t *newest = &write_behind.ranges[write_behind.count - 1];
+        if (newest->address <= end && start <= newest->address + newest->length) {
+            if (newest->address < start) {
+                start = newest->address;
+            }
+            if (newest->address + newest->length > end) {
+                end = newest->address + newest->length;
+            }
+            *newest = (wear_leveling_range_t){.address = start, .length = end - start};
+            return WEAR_LEVELING_SUCCESS;
+        }
+    }
+
+    if (write_behind.count == (WEAR_LEVELING_WRITE_BEHIND_RANGES)) {
+        wear_leveling_status_t status = wear_leveling_housekeeping();
+        if (status != WEAR_LEVELING_SUCCESS) {
+            // If consolidation occurred, then the cache, including this write, has already been written to the consolidated area.
+            // If a failure occurred, pass it on.
+            return status;
+        }
+    }
+
+    write_behind.ranges[write_behind.count++] = (wear_leveling_range_t){.address = start, .length = end - start};
+    return WEAR_LEVELING_SUCCESS;
+}
+#endif // WEAR_LEVELING_WRITE_BEHIND
+
 /**
  * "Replays" the write log from the backing store, updating the local cache with updated values.
  */
@@ -689,9 +810,20 @@ wear_leveling_status_t wear_leveling_write(const uint32_t address, const void *v
         return true;
     }
 
+#ifdef WEAR_LEVELING_WRITE_BEHIND
+    // Older staged ranges keep their place in the write order
+    if (wear_leveling_write_out_overlapped(address, length) == WEAR_LEVELING_FAILED) {
+        return WEAR_LEVELING_FAILED;
+    }
+#endif // WEAR_LEVELING_WRITE_BEHIND
+
     // Update the cache before writing to the backing store -- if we hit the end of the backing store during writes to the log then we'll force a consolidation in-line
     memcpy(&wear_leveling.cache[address], value, length);
 
+#ifdef WEAR_LEVELING_WRITE_BEHIND
+    // Defer the write to the backing store until housekeeping or a flush
+    return wear_leveling_stage(address, length);
+#else
     // Unlock the backing store
     backing_store_lock_status_t lock_status = wear_leveling_unlock();
     if (lock_status == STATUS_FAILURE) {
@@ -725,6 +857,85 @@ wear_leveling_status_t wear_leveling_write(const uint32_t address, const void *v
     }
 
     return status;
+#endif // WEAR_LEVELING_WRITE_BEHIND
+}
+
+/**
+ * Writes out all data staged by write-behind mode.
+ */
+wear_leveling_status_t wear_leveling_flush(void) {
+    wear_leveling_status_t status = WEAR_LEVELING_SUCCESS;
+#ifdef WEAR_LEVELING_WRITE_BEHIND
+    while (write_behind.count > 0) {
+        switch (wear_leveling_housekeeping()) {
+            case WEAR_LEVELING_FAILED:
+                return WEAR_LEVELING_FAILED;
+            case WEAR_LEVELING_CONSOLIDATED:
+                status = WEAR_LEVELING_CONSOLIDATED;
+                break;
+            default:
+                break;
+        }
+    }
+#endif // WEAR_LEVELING_WRITE_BEHIND
+    return status;
+}
+
+/**
+ * Writes out the oldest staged range, or consolidates if the staged data would not fit in the write log.
+ */
+wear_leveling_status_t wear_leveling_housekeeping(void) {
+#ifdef WEAR_LEVELING_WRITE_BEHIND
+    if (write_behind.count == 0) {
+        return WEAR_LEVELING_SUCCESS;
+    }
+
+    // Unlock the backing store
+    backing_store_lock_status_t lock_status = wear_leveling_unlock();
+    if (lock_status == STATUS_FAILURE) {
+        wear_leveling_lock();
+        return WEAR_LEVELING_FAILED;
+    }
+
+    uint32_t needed = 0;
+    for (uint8_t i = 0; i < write_behind.count; ++i) {
+        needed += wear_leveling_staged_log_size(write_behind.ranges[i].length);
+    }
+
+    wear_leveling_status_t status;
+    if (wear_leveling.write_address + needed >= (WEAR_LEVELING_BACKING_SIZE)) {
+        // Writing the staged data would fill the log and consolidate anyway, so skip straight to consolidation
+        status = wear_leveling_consolidate_force();
+    } else {
+        const wear_leveling_range_t range = write_behind.ranges[0];
+        status                            = wear_leveling_write_raw(range.address, &wear_leveling.cache[range.address], range.length);
+        if (status == WEAR_LEVELING_SUCCESS) {
+            wear_leveling_unstage(0);
+            status = wear_leveling_consolidate_if_needed();
+        }
+    }
+
+    if (lock_status == STATUS_SUCCESS) {
+        if (wear_leveling_lock() == STATUS_FAILURE) {
+            status = WEAR_LEVELING_FAILED;
+        }
+    }
+
+    return status;
+#else
+    return WEAR_LEVELING_SUCCESS;
+#endif // WEAR_LEVELING_WRITE_BEHIND
+}
+
+/**
+ * Number of staged ranges not yet written to the backing store.
+ */
+size_t wear_leveling_pending(void) {
+#ifdef WEAR_LEVELING_WRITE_BEHIND
+    return write_behind.count;
+#else
+    return 0;
+#endif // WEAR_LEVELING_WRITE_BEHIND
 }
 
 /**
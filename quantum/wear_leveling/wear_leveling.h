@@ -36,6 +36,11 @@ wear_leveling_status_t wear_leveling_erase(void);
  * determine if an overwrite should occur -- if there is any data mismatch the entire block will be written to the log,
  * not just the changed bytes.
  *
+ * With WEAR_LEVELING_WRITE_BEHIND defined, the cache is updated and the range is staged for a later
+ * wear_leveling_housekeeping() or wear_leveling_flush() instead. Staged ranges which overlap or touch are merged, and the
+ * oldest is written out in-line only once all WEAR_LEVELING_WRITE_BEHIND_RANGES slots are in use. Staged data is lost
+ * if power is removed before it is written out.
+ *
  * @param address[in] the logical address to write data
  * @param value[in] pointer to the source buffer
  * @param length[in] length of the data
@@ -52,3 +57,31 @@ wear_leveling_status_t wear_leveling_write(uint32_t address, const void* value,
  * @return Status of the request
  */
 wear_leveling_status_t wear_leveling_read(uint32_t address, void* value, size_t length);
+
+/**
+ * Writes out all data staged by write-behind mode.
+ *
+ * Without WEAR_LEVELING_WRITE_BEHIND every write goes to the backing store immediately, and this does nothing.
+ *
+ * @return Status of the request
+ */
+wear_leveling_status_t wear_leveling_flush(void);
+
+/**
+ * Performs one bounded step of write-behind housekeeping, intended to be called when the keyboard is idle.
+ *
+ * Writes the oldest staged range to the write log. If the staged data would not fit in the remainder of the write log,
+ * consolidates instead, as consolidation writes the entire cache including everything staged.
+ *
+ * Without WEAR_LEVELING_WRITE_BEHIND this does nothing.
+ *
+ * @return Status of the request
+ */
+wear_leveling_status_t wear_leveling_housekeeping(void);
+
+/**
+ * Number of staged ranges of logical data not yet written to the backing store.
+ *
+ * @return Number of staged ranges, always zero without WEAR_LEVELING_WRITE_BEHIND
+ */
+size_t wear_leveling_pending(void);
@@ -59,10 +59,19 @@ typedef uint64_t backing_store_int_t;
         } while (0)
 #endif // WEAR_LEVELING_ASSERTS
 
+#ifdef WEAR_LEVELING_WRITE_BEHIND
+#    ifndef WEAR_LEVELING_WRITE_BEHIND_RANGES
+#        define WEAR_LEVELING_WRITE_BEHIND_RANGES 16
+#    endif
+#endif // WEAR_LEVELING_WRITE_BEHIND
+
 // Compile-time validation of configurable options
 STATIC_ASSERT(WEAR_LEVELING_BACKING_SIZE >= (WEAR_LEVELING_LOGICAL_SIZE * 2), "Total backing size must be at least twice the size of the logical size");
 STATIC_ASSERT(WEAR_LEVELING_LOGICAL_SIZE % BACKING_STORE_WRITE_SIZE == 0, "Logical size must be a multiple of write size");
 STATIC_ASSERT(WEAR_LEVELING_BACKING_SIZE % WEAR_LEVELING_LOGICAL_SIZE == 0, "Backing size must be a multiple of logical size");
+#ifdef WEAR_LEVELING_WRITE_BEHIND
+STATIC_ASSERT(WEAR_LEVELING_WRITE_BEHIND_RANGES > 0 && WEAR_LEVELING_WRITE_BEHIND_RANGES <= 255, "Write-behind range count must be between 1 and 255");
+#endif // WEAR_LEVELING_WRITE_BEHIND
 
 // Backing Store API, to be implemented elsewhere by flash driver etc.
 bool backing_store_init(void);
@@ -109,6 +118,7 @@ STATIC_ASSERT(LOG_ENTRY_TYPES <= (1 << 2), "Too many log entry types to fit into
 #define LOG_ENTRY_GET_TYPE(entry) (((entry).raw8[0] >> 6) & BITMASK_FOR_BITCOUNT(2))
 
 #define LOG_ENTRY_MULTIBYTE_MAX_BYTES 5
+#define LOG_ENTRY_MULTIBYTE_SIZE(length) (((3 + (length) + (BACKING_STORE_WRITE_SIZE)-1) / (BACKING_STORE_WRITE_SIZE)) * (BACKING_STORE_WRITE_SIZE))
 #define LOG_ENTRY_MULTIBYTE_GET_ADDRESS(entry) (((((uint32_t)((entry).raw8[0])) & BITMASK_FOR_BITCOUNT(3)) << 16) | (((uint32_t)((entry).raw8[1])) << 8) | (entry).raw8[2])
 #define LOG_ENTRY_MULTIBYTE_GET_LENGTH(entry) ((uint8_t)(((entry).raw8[0] >> 3) & BITMASK_FOR_BITCOUNT(3)))
 #define LOG_ENTRY_MAKE_MULTIBYTE(address, length)                                                       \
@@ -20,6 +20,7 @@
 #include "keycode.h"
 #include "quantum_keycodes.h"
 #include "action_util.h"
+#include "task_deadline.h"
 #include <math.h>
 
 // WPM Stuff
@@ -60,6 +61,7 @@ static uint8_t  next_wpm        = 0;
 
 void set_current_wpm(uint8_t new_wpm) {
     current_wpm = new_wpm;
+    task_deadline_wake(TASK_DEADLINE_WPM);
 }
 uint8_t get_current_wpm(void) {
     return current_wpm;
@@ -175,4 +177,19 @@ void decay_wpm(void) {
 
     current_wpm = prev_wpm + (latency * ((int)next_wpm - (int)prev_wpm) / LATENCY);
 #endif
+
+    // While nobody is typing the result only changes when a period or smoothing window rolls over.
+    uint32_t next_decay = PERIOD_DURATION + 1 - elapsed;
+    bool     idle       = presses == 0 && current_wpm == 0;
+#if !defined(WPM_UNFILTERED)
+    idle = idle && prev_wpm == 0 && next_wpm == 0;
+
+    uint32_t next_smoothing = LATENCY + 1 - timer_elapsed32(smoothing_timer);
+    if (next_smoothing < next_decay) {
+        next_decay = next_smoothing;
+    }
+#endif
+    if (idle) {
+        task_deadline_defer(TASK_DEADLINE_WPM, next_decay);
+    }
 }
@@ -0,0 +1,162 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Generated by `qmk generate-autocorrect-data --large` from the default dictionary.
+
+#pragma once
+
+// Autocorrection dictionary (70 entries):
+//   :guage     -> gauge
+//   :the:the:  -> the
+//   :thier     -> their
+//   :ture      -> true
+//   accomodate -> accommodate
+//   acommodate -> accommodate
+//   aparent    -> apparent
+//   aparrent   -> apparent
+//   apparant   -> apparent
+//   apparrent  -> apparent
+//   aquire     -> acquire
+//   becuase    -> because
+//   cauhgt     -> caught
+//   cheif      -> chief
+//   choosen    -> chosen
+//   cieling    -> ceiling
+//   collegue   -> colleague
+//   concensus  -> consensus
+//   contians   -> contains
+//   cosnt      -> const
+//   dervied    -> derived
+//   fales      -> false
+//   fasle      -> false
+//   fitler     -> filter
+//   flase      -> false
+//   foward     -> forward
+//   frequecy   -> frequency
+//   gaurantee  -> guarantee
+//   guaratee   -> guarantee
+//   heigth     -> height
+//   heirarchy  -> hierarchy
+//   inclued    -> include
+//   interator  -> iterator
+//   intput     -> input
+//   invliad    -> invalid
+//   lenght     -> length
+//   liasion    -> liaison
+//   libary     -> library
+//   listner    -> listener
+//   looses:    -> loses
+//   looup      -> lookup
+//   manefist   -> manifest
+//   namesapce  -> namespace
+//   namespcae  -> namespace
+//   occassion  -> occasion
+//   occured    -> occurred
+//   ouptut     -> output
+//   ouput      -> output
+//   overide    -> override
+//   postion    -> position
+//   priviledge -> privilege
+//   psuedo     -> pseudo
+//   recieve    -> receive
+//   refered    -> referred
+//   relevent   -> relevant
+//   repitition -> repetition
+//   retrun     -> return
+//   retun      -> return
+//   reuslt     -> result
+//   reutrn     -> return
+//   saftey     -> safety
+//   seperate   -> separate
+//   singed     -> signed
+//   stirng     -> string
+//   strign     -> string
+//   swithc     -> switch
+//   swtich     -> switch
+//   thresold   -> threshold
+//   udpate     -> update
+//   widht      -> width
+
+#define AUTOCORRECT_MIN_LENGTH 5  // ":ture"
+#define AUTOCORRECT_MAX_LENGTH 10 // "accomodate"
+#define DICTIONARY_SIZE 1204
+#define AUTOCORRECT_LARGE_DICTIONARY
+
+static const uint8_t autocorrect_data[DICTIONARY_SIZE] PROGMEM = {
+    0x4E, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x11, 0x12, 0x13, 0x15, 0x16, 0x17, 0x1C, 0x2C, 0x39,
+    0x00, 0x00, 0x43, 0x00, 0x00, 0xC3, 0x00, 0x00, 0x04, 0x02, 0x00, 0x0E, 0x02, 0x00, 0x30, 0x02,
+    0x00, 0x4D, 0x02, 0x00, 0xE3, 0x02, 0x00, 0xEF, 0x02, 0x00, 0xF9, 0x02, 0x00, 0x3E, 0x03, 0x00,
+    0x70, 0x03, 0x00, 0x52, 0x04, 0x00, 0x96, 0x04, 0x00, 0x0B, 0x17, 0x0C, 0x1A, 0x16, 0x00, 0x81,
+    0x63, 0x68, 0x00, 0x44, 0x04, 0x08, 0x0F, 0x15, 0x54, 0x00, 0x00, 0x60, 0x00, 0x00, 0xAA, 0x00,
+    0x00, 0xB7, 0x00, 0x00, 0x0C, 0x0F, 0x19, 0x11, 0x0C, 0x00, 0x83, 0x61, 0x6C, 0x69, 0x64, 0x00,
+    0x44, 0x0A, 0x0C, 0x15, 0x18, 0x71, 0x00, 0x00, 0x7B, 0x00, 0x00, 0x86, 0x00, 0x00, 0xA1, 0x00,
+    0x00, 0x11, 0x0C, 0x16, 0x00, 0x83, 0x67, 0x6E, 0x65, 0x64, 0x00, 0x19, 0x15, 0x08, 0x07, 0x00,
+    0x83, 0x69, 0x76, 0x65, 0x64, 0x00, 0x42, 0x08, 0x18, 0x8F, 0x00, 0x00, 0x98, 0x00, 0x00, 0x09,
+    0x08, 0x15, 0x00, 0x81, 0x72, 0x65, 0x64, 0x00, 0x06, 0x06, 0x12, 0x00, 0x81, 0x72, 0x65, 0x64,
+    0x00, 0x0F, 0x06, 0x11, 0x0C, 0x00, 0x81, 0x64, 0x65, 0x00, 0x12, 0x16, 0x08, 0x15, 0x0B, 0x17,
+    0x00, 0x82, 0x68, 0x6F, 0x6C, 0x64, 0x00, 0x04, 0x1A, 0x12, 0x09, 0x00, 0x83, 0x72, 0x77, 0x61,
+    0x72, 0x64, 0x00, 0x4B, 0x04, 0x06, 0x07, 0x08, 0x0A, 0x0F, 0x15, 0x16, 0x17, 0x18, 0x19, 0xF0,
+    0x00, 0x00, 0xFD, 0x00, 0x00, 0x0B, 0x01, 0x00, 0x17, 0x01, 0x00, 0x3D, 0x01, 0x00, 0x5C, 0x01,
+    0x00, 0x65, 0x01, 0x00, 0x82, 0x01, 0x00, 0x9F, 0x01, 0x00, 0xEB, 0x01, 0x00, 0xF8, 0x01, 0x00,
+    0x06, 0x13, 0x16, 0x08, 0x10, 0x04, 0x11, 0x00, 0x82, 0x61, 0x63, 0x65, 0x00, 0x13, 0x04, 0x16,
+    0x08, 0x10, 0x04, 0x11, 0x00, 0x83, 0x70, 0x61, 0x63, 0x65, 0x00, 0x0C, 0x15, 0x08, 0x19, 0x12,
+    0x00, 0x82, 0x72, 0x69, 0x64, 0x65, 0x00, 0x17, 0x00, 0x42, 0x04, 0x11, 0x22, 0x01, 0x00, 0x2D,
+    0x01, 0x00, 0x15, 0x04, 0x18, 0x0A, 0x00, 0x82, 0x6E, 0x74, 0x65, 0x65, 0x00, 0x04, 0x15, 0x18,
+    0x04, 0x0A, 0x00, 0x87, 0x75, 0x61, 0x72, 0x61, 0x6E, 0x74, 0x65, 0x65, 0x00, 0x42, 0x04, 0x07,
+    0x46, 0x01, 0x00, 0x50, 0x01, 0x00, 0x18, 0x0A, 0x2C, 0x00, 0x83, 0x61, 0x75, 0x67, 0x65, 0x00,
+    0x08, 0x0F, 0x0C, 0x19, 0x0C, 0x15, 0x13, 0x00, 0x82, 0x67, 0x65, 0x00, 0x16, 0x04, 0x09, 0x00,
+    0x82, 0x6C, 0x73, 0x65, 0x00, 0x42, 0x0C, 0x18, 0x6E, 0x01, 0x00, 0x7A, 0x01, 0x00, 0x18, 0x14,
+    0x04, 0x00, 0x84, 0x63, 0x71, 0x75, 0x69, 0x72, 0x65, 0x00, 0x17, 0x2C, 0x00, 0x82, 0x72, 0x75,
+    0x65, 0x00, 0x04, 0x00, 0x42, 0x0F, 0x18, 0x8D, 0x01, 0x00, 0x95, 0x01, 0x00, 0x09, 0x00, 0x83,
+    0x61, 0x6C, 0x73, 0x65, 0x00, 0x06, 0x08, 0x05, 0x00, 0x83, 0x61, 0x75, 0x73, 0x65, 0x00, 0x04,
+    0x00, 0x43, 0x07, 0x13, 0x15, 0xAE, 0x01, 0x00, 0xD5, 0x01, 0x00, 0xDF, 0x01, 0x00, 0x12, 0x10,
+    0x00, 0x42, 0x10, 0x12, 0xBA, 0x01, 0x00, 0xC9, 0x01, 0x00, 0x12, 0x06, 0x04, 0x00, 0x87, 0x63,
+    0x6F, 0x6D, 0x6D, 0x6F, 0x64, 0x61, 0x74, 0x65, 0x00, 0x06, 0x06, 0x04, 0x00, 0x84, 0x6D, 0x6F,
+    0x64, 0x61, 0x74, 0x65, 0x00, 0x07, 0x18, 0x00, 0x84, 0x70, 0x64, 0x61, 0x74, 0x65, 0x00, 0x08,
+    0x13, 0x08, 0x16, 0x00, 0x84, 0x61, 0x72, 0x61, 0x74, 0x65, 0x00, 0x0A, 0x08, 0x0F, 0x0F, 0x12,
+    0x06, 0x00, 0x82, 0x61, 0x67, 0x75, 0x65, 0x00, 0x08, 0x0C, 0x06, 0x08, 0x15, 0x00, 0x83, 0x65,
+    0x69, 0x76, 0x65, 0x00, 0x0C, 0x08, 0x0B, 0x06, 0x00, 0x82, 0x69, 0x65, 0x66, 0x00, 0x11, 0x00,
+    0x42, 0x0C, 0x15, 0x19, 0x02, 0x00, 0x26, 0x02, 0x00, 0x0F, 0x08, 0x0C, 0x06, 0x00, 0x85, 0x65,
+    0x69, 0x6C, 0x69, 0x6E, 0x67, 0x00, 0x0C, 0x17, 0x16, 0x00, 0x83, 0x72, 0x69, 0x6E, 0x67, 0x00,
+    0x42, 0x06, 0x17, 0x39, 0x02, 0x00, 0x44, 0x02, 0x00, 0x0C, 0x17, 0x1A, 0x16, 0x00, 0x83, 0x69,
+    0x74, 0x63, 0x68, 0x00, 0x0A, 0x0C, 0x08, 0x0B, 0x00, 0x81, 0x68, 0x74, 0x00, 0x45, 0x08, 0x0A,
+    0x12, 0x15, 0x18, 0x62, 0x02, 0x00, 0x6D, 0x02, 0x00, 0x76, 0x02, 0x00, 0xBF, 0x02, 0x00, 0xCA,
+    0x02, 0x00, 0x16, 0x12, 0x12, 0x0B, 0x06, 0x00, 0x83, 0x73, 0x65, 0x6E, 0x00, 0x0C, 0x15, 0x17,
+    0x16, 0x00, 0x81, 0x6E, 0x67, 0x00, 0x0C, 0x00, 0x42, 0x16, 0x17, 0x81, 0x02, 0x00, 0x9D, 0x02,
+    0x00, 0x42, 0x04, 0x16, 0x8A, 0x02, 0x00, 0x93, 0x02, 0x00, 0x0C, 0x0F, 0x00, 0x83, 0x69, 0x73,
+    0x6F, 0x6E, 0x00, 0x04, 0x06, 0x06, 0x12, 0x00, 0x83, 0x69, 0x6F, 0x6E, 0x00, 0x42, 0x0C, 0x16,
+    0xA6, 0x02, 0x00, 0xB5, 0x02, 0x00, 0x17, 0x0C, 0x13, 0x08, 0x15, 0x00, 0x86, 0x65, 0x74, 0x69,
+    0x74, 0x69, 0x6F, 0x6E, 0x00, 0x12, 0x13, 0x00, 0x83, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x17,
+    0x18, 0x08, 0x15, 0x00, 0x83, 0x74, 0x75, 0x72, 0x6E, 0x00, 0x42, 0x15, 0x17, 0xD3, 0x02, 0x00,
+    0xDC, 0x02, 0x00, 0x17, 0x08, 0x15, 0x00, 0x82, 0x75, 0x72, 0x6E, 0x00, 0x08, 0x15, 0x00, 0x80,
+    0x72, 0x6E, 0x00, 0x07, 0x08, 0x18, 0x16, 0x13, 0x00, 0x83, 0x65, 0x75, 0x64, 0x6F, 0x00, 0x18,
+    0x12, 0x12, 0x0F, 0x00, 0x81, 0x6B, 0x75, 0x70, 0x00, 0x42, 0x08, 0x12, 0x02, 0x03, 0x00, 0x2D,
+    0x03, 0x00, 0x43, 0x0C, 0x0F, 0x11, 0x0F, 0x03, 0x00, 0x18, 0x03, 0x00, 0x22, 0x03, 0x00, 0x0B,
+    0x17, 0x2C, 0x00, 0x82, 0x65, 0x69, 0x72, 0x00, 0x17, 0x0C, 0x09, 0x00, 0x83, 0x6C, 0x74, 0x65,
+    0x72, 0x00, 0x17, 0x16, 0x0C, 0x0F, 0x00, 0x82, 0x65, 0x6E, 0x65, 0x72, 0x00, 0x17, 0x04, 0x15,
+    0x08, 0x17, 0x11, 0x0C, 0x00, 0x87, 0x74, 0x65, 0x72, 0x61, 0x74, 0x6F, 0x72, 0x00, 0x43, 0x08,
+    0x11, 0x18, 0x4B, 0x03, 0x00, 0x53, 0x03, 0x00, 0x60, 0x03, 0x00, 0x0F, 0x04, 0x09, 0x00, 0x81,
+    0x73, 0x65, 0x00, 0x04, 0x0C, 0x17, 0x11, 0x12, 0x06, 0x00, 0x83, 0x61, 0x69, 0x6E, 0x73, 0x00,
+    0x16, 0x11, 0x08, 0x06, 0x11, 0x12, 0x06, 0x00, 0x85, 0x73, 0x65, 0x6E, 0x73, 0x75, 0x73, 0x00,
+    0x46, 0x0A, 0x0B, 0x0F, 0x11, 0x16, 0x18, 0x89, 0x03, 0x00, 0x93, 0x03, 0x00, 0xAB, 0x03, 0x00,
+    0xB6, 0x03, 0x00, 0x18, 0x04, 0x00, 0x26, 0x04, 0x00, 0x0B, 0x18, 0x04, 0x06, 0x00, 0x82, 0x67,
+    0x68, 0x74, 0x00, 0x42, 0x07, 0x0A, 0x9C, 0x03, 0x00, 0xA3, 0x03, 0x00, 0x0C, 0x1A, 0x00, 0x81,
+    0x74, 0x68, 0x00, 0x11, 0x08, 0x0F, 0x00, 0x81, 0x74, 0x68, 0x00, 0x16, 0x18, 0x08, 0x15, 0x00,
+    0x83, 0x73, 0x75, 0x6C, 0x74, 0x00, 0x43, 0x04, 0x08, 0x16, 0xC3, 0x03, 0x00, 0xCE, 0x03, 0x00,
+    0x10, 0x04, 0x00, 0x15, 0x04, 0x13, 0x13, 0x04, 0x00, 0x82, 0x65, 0x6E, 0x74, 0x00, 0x42, 0x15,
+    0x19, 0xD7, 0x03, 0x00, 0x06, 0x04, 0x00, 0x42, 0x04, 0x15, 0xE0, 0x03, 0x00, 0xEB, 0x03, 0x00,
+    0x13, 0x04, 0x00, 0x84, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x00, 0x04, 0x13, 0x00, 0x42, 0x04,
+    0x13, 0xF7, 0x03, 0x00, 0xFF, 0x03, 0x00, 0x85, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x00, 0x04,
+    0x00, 0x83, 0x65, 0x6E, 0x74, 0x00, 0x08, 0x0F, 0x08, 0x15, 0x00, 0x82, 0x61, 0x6E, 0x74, 0x00,
+    0x12, 0x06, 0x00, 0x82, 0x6E, 0x73, 0x74, 0x00, 0x0C, 0x09, 0x08, 0x11, 0x04, 0x10, 0x00, 0x84,
+    0x69, 0x66, 0x65, 0x73, 0x74, 0x00, 0x42, 0x13, 0x17, 0x2F, 0x04, 0x00, 0x48, 0x04, 0x00, 0x42,
+    0x17, 0x18, 0x38, 0x04, 0x00, 0x40, 0x04, 0x00, 0x11, 0x0C, 0x00, 0x83, 0x70, 0x75, 0x74, 0x00,
+    0x12, 0x00, 0x82, 0x74, 0x70, 0x75, 0x74, 0x00, 0x13, 0x18, 0x12, 0x00, 0x83, 0x74, 0x70, 0x75,
+    0x74, 0x00, 0x44, 0x06, 0x08, 0x0B, 0x15, 0x63, 0x04, 0x00, 0x6F, 0x04, 0x00, 0x79, 0x04, 0x00,
+    0x8B, 0x04, 0x00, 0x08, 0x18, 0x14, 0x08, 0x15, 0x09, 0x00, 0x81, 0x6E, 0x63, 0x79, 0x00, 0x17,
+    0x09, 0x04, 0x16, 0x00, 0x82, 0x65, 0x74, 0x79, 0x00, 0x06, 0x15, 0x04, 0x15, 0x0C, 0x08, 0x0B,
+    0x00, 0x87, 0x69, 0x65, 0x72, 0x61, 0x72, 0x63, 0x68, 0x79, 0x00, 0x04, 0x05, 0x0C, 0x0F, 0x00,
+    0x82, 0x72, 0x61, 0x72, 0x79, 0x00, 0x42, 0x08, 0x16, 0x9F, 0x04, 0x00, 0xA9, 0x04, 0x00, 0x0B,
+    0x17, 0x2C, 0x08, 0x0B, 0x17, 0x2C, 0x00, 0x84, 0x00, 0x08, 0x16, 0x12, 0x12, 0x0F, 0x00, 0x84,
+    0x73, 0x65, 0x73, 0x00
+};
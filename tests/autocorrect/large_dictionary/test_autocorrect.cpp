@@ -0,0 +1,146 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string>
+#include <vector>
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+struct Autocorrection {
+    const char* typo;
+    const char* correction;
+};
+
+// The dictionary that autocorrect_data.h was generated from.
+static const std::vector<Autocorrection> dictionary = {
+    {":guage", "gauge"},
+    {":the:the:", "the"},
+    {":thier", "their"},
+    {":ture", "true"},
+    {"accomodate", "accommodate"},
+    {"acommodate", "accommodate"},
+    {"aparent", "apparent"},
+    {"aparrent", "apparent"},
+    {"apparant", "apparent"},
+    {"apparrent", "apparent"},
+    {"aquire", "acquire"},
+    {"becuase", "because"},
+    {"cauhgt", "caught"},
+    {"cheif", "chief"},
+    {"choosen", "chosen"},
+    {"cieling", "ceiling"},
+    {"collegue", "colleague"},
+    {"concensus", "consensus"},
+    {"contians", "contains"},
+    {"cosnt", "const"},
+    {"dervied", "derived"},
+    {"fales", "false"},
+    {"fasle", "false"},
+    {"fitler", "filter"},
+    {"flase", "false"},
+    {"foward", "forward"},
+    {"frequecy", "frequency"},
+    {"gaurantee", "guarantee"},
+    {"guaratee", "guarantee"},
+    {"heigth", "height"},
+    {"heirarchy", "hierarchy"},
+    {"inclued", "include"},
+    {"interator", "iterator"},
+    {"intput", "input"},
+    {"invliad", "invalid"},
+    {"lenght", "length"},
+    {"liasion", "liaison"},
+    {"libary", "library"},
+    {"listner", "listener"},
+    {"looses:", "loses"},
+    {"looup", "lookup"},
+    {"manefist", "manifest"},
+    {"namesapce", "namespace"},
+    {"namespcae", "namespace"},
+    {"occassion", "occasion"},
+    {"occured", "occurred"},
+    {"ouptut", "output"},
+    {"ouput", "output"},
+    {"overide", "override"},
+    {"postion", "position"},
+    {"priviledge", "privilege"},
+    {"psuedo", "pseudo"},
+    {"recieve", "receive"},
+    {"refered", "referred"},
+    {"relevent", "relevant"},
+    {"repitition", "repetition"},
+    {"retrun", "return"},
+    {"retun", "return"},
+    {"reuslt", "result"},
+    {"reutrn", "return"},
+    {"saftey", "safety"},
+    {"seperate", "separate"},
+    {"singed", "signed"},
+    {"stirng", "string"},
+    {"strign", "string"},
+    {"swithc", "switch"},
+    {"swtich", "switch"},
+    {"thresold", "threshold"},
+    {"udpate", "update"},
+    {"widht", "width"},
+};
+
+static int         corrections = 0;
+static uint8_t     last_backspaces;
+static std::string last_str;
+
+extern "C" bool apply_autocorrect(uint8_t backspaces, const char* str, char* typo, char* correct) {
+    corrections++;
+    last_backspaces = backspaces;
+    last_str        = str;
+    return false;
+}
+
+class AutoCorrectLargeDictionary : public TestFixture {
+   public:
+    void SetUp() override {
+        autocorrect_enable();
+        corrections = 0;
+    }
+
+    // Feeds `typo` to autocorrect, with ':' standing for a word break.
+    void Type(const std::string& typo) {
+        keyrecord_t record = {.event = {.type = KEY_EVENT, .pressed = true}};
+        process_autocorrect(KC_SPC, &record);
+        for (char c : typo) {
+            process_autocorrect(c == ':' ? KC_SPC : (uint16_t)(KC_A + c - 'a'), &record);
+        }
+    }
+};
+
+// Test that every typo of the dictionary is found, with the same edit as the
+// one the generator derives from the correction.
+TEST_F(AutoCorrectLargeDictionary, finds_every_typo) {
+    for (const auto& entry : dictionary) {
+        std::string typo       = entry.typo;
+        std::string correction = entry.correction;
+        bool        boundary   = typo.back() == ':';
+        typo.erase(0, typo.find_first_not_of(':'));
+        typo.erase(typo.find_last_not_of(':') + 1);
+        size_t common = 0;
+        while (common < typo.size() && common < correction.size() && typo[common] == correction[common]) {
+            common++;
+        }
+
+        corrections = 0;
+        Type(entry.typo);
+        EXPECT_EQ(corrections, 1) << entry.typo;
+        EXPECT_EQ(last_backspaces, typo.size() - common - 1 + boundary) << entry.typo;
+        EXPECT_EQ(last_str, correction.substr(common)) << entry.typo;
+    }
+}
+
+// Test that words close to the typos are left alone.
+TEST_F(AutoCorrectLargeDictionary, ignores_correct_words) {
+    for (const char* word : {"false", "gauge", "their", "accommodate", "falsify", "the", "thee"}) {
+        Type(word);
+    }
+    Type(":");
+    EXPECT_EQ(corrections, 0);
+}
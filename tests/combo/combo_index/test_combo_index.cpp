@@ -0,0 +1,156 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <vector>
+#include "benchmark_util.hpp"
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_benchmark.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+namespace {
+std::vector<std::array<uint16_t, 3>> generated_keys;
+std::vector<combo_t>                 generated_combos;
+uint32_t                             combo_get_calls = 0;
+
+/* Fills the combo table with `count` combos. All but the last two are made of
+ * keycodes that are never typed; the last two are J+K -> Escape and D+F -> Tab,
+ * so that a linear scan has to walk the whole table to find them. */
+void generate_combos(uint16_t count) {
+    generated_keys.clear();
+    generated_combos.clear();
+    for (uint16_t i = 0; i + 2 < count; i++) {
+        generated_keys.push_back({static_cast<uint16_t>(QK_UNICODE + 2 * i), static_cast<uint16_t>(QK_UNICODE + 2 * i + 1), COMBO_END});
+    }
+    generated_keys.push_back({KC_J, KC_K, COMBO_END});
+    generated_keys.push_back({KC_D, KC_F, COMBO_END});
+
+    for (auto& keys : generated_keys) {
+        generated_combos.push_back({.keys = keys.data(), .keycode = KC_NO});
+    }
+    generated_combos[count - 2].keycode = KC_ESCAPE;
+    generated_combos[count - 1].keycode = KC_TAB;
+
+    combo_index_invalidate();
+}
+} // namespace
+
+extern "C" {
+uint16_t combo_count(void) {
+    return generated_combos.size();
+}
+
+combo_t* combo_get(uint16_t combo_idx) {
+    combo_get_calls++;
+    return &generated_combos[combo_idx];
+}
+}
+
+class ComboIndex : public BenchmarkFixture {};
+
+TEST_F(ComboIndex, combo_at_end_of_large_table_is_triggered) {
+    TestDriver driver;
+    KeymapKey  key_j(0, 0, 1, KC_J);
+    KeymapKey  key_k(0, 1, 1, KC_K);
+    set_keymap({key_j, key_k});
+    generate_combos(512);
+
+    EXPECT_REPORT(driver, (KC_ESCAPE));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_j, key_k});
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboIndex, combo_keys_pressed_alone_are_sent_after_combo_term) {
+    TestDriver driver;
+    KeymapKey  key_j(0, 0, 1, KC_J);
+    KeymapKey  key_a(0, 2, 1, KC_A);
+    set_keymap({key_j, key_a});
+    generate_combos(512);
+
+    InSequence s;
+    EXPECT_REPORT(driver, (KC_J));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_j, COMBO_TERM + 10);
+    tap_key(key_a);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboIndex, interleaved_combos_are_triggered) {
+    TestDriver driver;
+    KeymapKey  key_d(0, 0, 1, KC_D);
+    KeymapKey  key_f(0, 1, 1, KC_F);
+    KeymapKey  key_j(0, 2, 1, KC_J);
+    KeymapKey  key_k(0, 3, 1, KC_K);
+    set_keymap({key_d, key_f, key_j, key_k});
+    generate_combos(64);
+
+    InSequence s;
+    EXPECT_REPORT(driver, (KC_TAB));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_ESCAPE));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_d, key_f});
+    tap_combo({key_j, key_k});
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboIndex, combo_is_triggered_when_index_overflows) {
+    TestDriver driver;
+    KeymapKey  key_j(0, 0, 1, KC_J);
+    KeymapKey  key_k(0, 1, 1, KC_K);
+    set_keymap({key_j, key_k});
+    /* Needs more than COMBO_INDEX_LENGTH entries, so the linear scan is used. */
+    generate_combos(COMBO_INDEX_LENGTH);
+
+    EXPECT_REPORT(driver, (KC_ESCAPE));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_j, key_k});
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboIndex, per_keystroke_cost_is_independent_of_combo_count) {
+    KeymapKey key_a(0, 0, 0, KC_A);
+    KeymapKey key_s(0, 1, 0, KC_S);
+    KeymapKey key_d(0, 2, 0, KC_D);
+    KeymapKey key_f(0, 3, 0, KC_F);
+    KeymapKey key_j(0, 4, 0, KC_J);
+    KeymapKey key_k(0, 5, 0, KC_K);
+    set_keymap({key_a, key_s, key_d, key_f, key_j, key_k});
+
+    /* Plain typing, a key that is part of a combo and a full chord. */
+    std::vector<BenchmarkEvent> script;
+    tap(script, key_a, 30, 30);
+    tap(script, key_s, 30, 30);
+    tap(script, key_f, COMBO_TERM + 10, 30);
+    press(script, key_j, 5);
+    press(script, key_k, 30);
+    release(script, key_j);
+    release(script, key_k, 30);
+
+    std::vector<double> calls_per_keystroke;
+    for (uint16_t count : {8, 64, 512}) {
+        generate_combos(count);
+        /* Building the index and the first clear after it touch every combo once. */
+        replay("warm_up", script, 1);
+        combo_get_calls = 0;
+
+        auto result = replay("combos_" + std::to_string(count), script);
+        report(result);
+        calls_per_keystroke.push_back(static_cast<double>(combo_get_calls) / result.keystrokes);
+        report_benchmark(result.name, {{"combo_get/keystroke", calls_per_keystroke.back()}});
+
+        EXPECT_EQ(result.unanswered, 0);
+        EXPECT_LE(result.latency_p99_ms, COMBO_TERM + 1);
+    }
+
+    /* Only the combos containing the pressed keycode are looked at. */
+    EXPECT_DOUBLE_EQ(calls_per_keystroke[0], calls_per_keystroke[1]);
+    EXPECT_DOUBLE_EQ(calls_per_keystroke[0], calls_per_keystroke[2]);
+}
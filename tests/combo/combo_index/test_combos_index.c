@@ -0,0 +1,13 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "quantum.h"
+
+/* The combos used by the tests are generated at runtime, see test_combo_index.cpp. */
+
+uint16_t const placeholder_combo[] = {KC_Y, KC_U, COMBO_END};
+
+// clang-format off
+combo_t key_combos[] = {
+    COMBO(placeholder_combo, KC_SPACE)
+};
+// clang-format on
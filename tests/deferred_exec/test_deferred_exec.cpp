@@ -0,0 +1,283 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "benchmark_util.hpp"
+#include "test_common.hpp"
+
+extern "C" {
+#include "deferred_exec.h"
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+class DeferredExec : public TestFixture {
+   public:
+    struct Call {
+        uint32_t trigger_time;
+        uint32_t now;
+        int      id;
+    };
+
+    static std::vector<Call>           calls;
+    static std::vector<uint32_t>       repeats;
+    static std::vector<deferred_token> tokens;
+
+    void SetUp() override {
+        /* The executor throttles on the last time it ran, which is not reset between tests, so every test starts on a
+         * fresh timeline well after the previous one. */
+        static uint32_t epoch = 0;
+        epoch += 1 << 20;
+        set_time(epoch);
+        calls.clear();
+        repeats.clear();
+        tokens.clear();
+    }
+
+    void TearDown() override {
+        for (auto token : tokens) {
+            cancel_deferred_exec(token);
+        }
+        uint32_t trigger_time;
+        EXPECT_FALSE(deferred_exec_next_trigger_time(&trigger_time));
+    }
+
+    /* Runs the executor once per millisecond for `ms` milliseconds. */
+    void run_for(uint32_t ms) {
+        for (uint32_t i = 0; i < ms; i++) {
+            advance_time(1);
+            deferred_exec_task();
+        }
+    }
+
+    /* Records the call and returns the next entry of `repeats` for this id, if any. */
+    static uint32_t record(uint32_t trigger_time, void *cb_arg) {
+        int id = (int)(intptr_t)cb_arg;
+        calls.push_back({trigger_time, timer_read32(), id});
+        return id < (int)repeats.size() ? repeats[id] : 0;
+    }
+
+    deferred_token defer(uint32_t delay_ms, int id) {
+        deferred_token token = defer_exec(delay_ms, record, (void *)(intptr_t)id);
+        tokens.push_back(token);
+        return token;
+    }
+};
+
+std::vector<DeferredExec::Call> DeferredExec::calls;
+std::vector<uint32_t>           DeferredExec::repeats;
+std::vector<deferred_token>     DeferredExec::tokens;
+
+TEST_F(DeferredExec, runs_after_delay) {
+    uint32_t start = timer_read32();
+    EXPECT_NE(defer(10, 0), INVALID_DEFERRED_TOKEN);
+
+    run_for(9);
+    EXPECT_TRUE(calls.empty());
+    run_for(1);
+    ASSERT_EQ(calls.size(), 1);
+    EXPECT_EQ(calls[0].trigger_time, start + 10);
+    run_for(100);
+    EXPECT_EQ(calls.size(), 1);
+}
+
+TEST_F(DeferredExec, rejects_zero_delay_and_missing_callback) {
+    EXPECT_EQ(defer_exec(0, record, NULL), INVALID_DEFERRED_TOKEN);
+    EXPECT_EQ(defer_exec(10, NULL, NULL), INVALID_DEFERRED_TOKEN);
+}
+
+TEST_F(DeferredExec, repeats_relative_to_previous_trigger) {
+    uint32_t start = timer_read32();
+    repeats        = {7};
+    defer(5, 0);
+
+    /* Late execution doesn't push back the following ones. */
+    advance_time(8);
+    deferred_exec_task();
+    run_for(11);
+    ASSERT_EQ(calls.size(), 3);
+    EXPECT_EQ(calls[0].trigger_time, start + 5);
+    EXPECT_EQ(calls[1].trigger_time, start + 12);
+    EXPECT_EQ(calls[2].trigger_time, start + 19);
+
+    /* Returning zero stops the repetition and frees the token. */
+    repeats = {0};
+    run_for(7);
+    EXPECT_EQ(calls.size(), 4);
+    run_for(50);
+    EXPECT_EQ(calls.size(), 4);
+    EXPECT_FALSE(cancel_deferred_exec(tokens[0]));
+}
+
+TEST_F(DeferredExec, overdue_repeat_runs_once_per_pass) {
+    repeats = {1};
+    defer(1, 0);
+
+    advance_time(20);
+    deferred_exec_task();
+    EXPECT_EQ(calls.size(), 1);
+    run_for(1);
+    EXPECT_EQ(calls.size(), 2);
+}
+
+TEST_F(DeferredExec, runs_in_trigger_order) {
+    defer(30, 0);
+    defer(10, 1);
+    defer(20, 2);
+    defer(15, 3);
+
+    advance_time(40);
+    deferred_exec_task();
+    ASSERT_EQ(calls.size(), 4);
+    EXPECT_EQ(calls[0].id, 1);
+    EXPECT_EQ(calls[1].id, 3);
+    EXPECT_EQ(calls[2].id, 2);
+    EXPECT_EQ(calls[3].id, 0);
+}
+
+TEST_F(DeferredExec, extends_and_cancels) {
+    uint32_t       start = timer_read32();
+    deferred_token a     = defer(10, 0);
+    deferred_token b     = defer(20, 1);
+
+    run_for(5);
+    EXPECT_TRUE(extend_deferred_exec(a, 30));
+    EXPECT_TRUE(cancel_deferred_exec(b));
+    EXPECT_FALSE(cancel_deferred_exec(b));
+    EXPECT_FALSE(extend_deferred_exec(b, 10));
+    EXPECT_FALSE(extend_deferred_exec(a, 0));
+    EXPECT_FALSE(extend_deferred_exec(INVALID_DEFERRED_TOKEN, 10));
+
+    run_for(100);
+    ASSERT_EQ(calls.size(), 1);
+    EXPECT_EQ(calls[0].id, 0);
+    EXPECT_EQ(calls[0].trigger_time, start + 35);
+}
+
+TEST_F(DeferredExec, reused_slot_gets_new_token) {
+    deferred_token a = defer(10, 0);
+    EXPECT_TRUE(cancel_deferred_exec(a));
+    deferred_token b = defer(10, 1);
+    EXPECT_NE(a, b);
+    EXPECT_FALSE(cancel_deferred_exec(a));
+    EXPECT_TRUE(cancel_deferred_exec(b));
+}
+
+TEST_F(DeferredExec, reports_next_trigger_time) {
+    uint32_t start = timer_read32();
+    uint32_t trigger_time;
+
+    EXPECT_FALSE(deferred_exec_next_trigger_time(&trigger_time));
+    defer(50, 0);
+    deferred_token b = defer(20, 1);
+    defer(30, 2);
+    ASSERT_TRUE(deferred_exec_next_trigger_time(&trigger_time));
+    EXPECT_EQ(trigger_time, start + 20);
+
+    cancel_deferred_exec(b);
+    ASSERT_TRUE(deferred_exec_next_trigger_time(&trigger_time));
+    EXPECT_EQ(trigger_time, start + 30);
+
+    run_for(30);
+    ASSERT_TRUE(deferred_exec_next_trigger_time(&trigger_time));
+    EXPECT_EQ(trigger_time, start + 50);
+}
+
+static deferred_token chained_token;
+
+static uint32_t cancel_and_requeue(uint32_t trigger_time, void *cb_arg) {
+    cancel_deferred_exec(chained_token);
+    chained_token = defer_exec(10, DeferredExec::record, cb_arg);
+    return 5;
+}
+
+TEST_F(DeferredExec, callback_can_cancel_and_requeue_itself) {
+    chained_token        = defer_exec(10, cancel_and_requeue, (void *)(intptr_t)7);
+    deferred_token first = chained_token;
+
+    run_for(10);
+    EXPECT_NE(chained_token, first);
+    EXPECT_NE(chained_token, INVALID_DEFERRED_TOKEN);
+    /* The returned delay is ignored, as the original execution was cancelled. */
+    run_for(10);
+    ASSERT_EQ(calls.size(), 1);
+    EXPECT_EQ(calls[0].id, 7);
+    EXPECT_FALSE(cancel_deferred_exec(chained_token));
+}
+
+TEST_F(DeferredExec, fails_when_full) {
+    for (int i = 0; i < MAX_DEFERRED_EXECUTORS; i++) {
+        ASSERT_NE(defer(1000 + i, i), INVALID_DEFERRED_TOKEN);
+    }
+    EXPECT_EQ(defer_exec(10, record, NULL), INVALID_DEFERRED_TOKEN);
+
+    cancel_deferred_exec(tokens[100]);
+    EXPECT_NE(defer(10, 0), INVALID_DEFERRED_TOKEN);
+    run_for(10);
+    EXPECT_EQ(calls.size(), 1);
+}
+
+/* Compares the cost of the basic executor against a linearly scanned table of the same size, while `count` executors
+ * are pending far in the future and one of them repeats every millisecond. */
+class DeferredExecBenchmark : public DeferredExec {
+   public:
+    static uint32_t every_ms(uint32_t trigger_time, void *cb_arg) {
+        return 1;
+    }
+
+    static uint32_t never(uint32_t trigger_time, void *cb_arg) {
+        return 0;
+    }
+
+    void bench(unsigned count) {
+        const unsigned                   ticks = 20000;
+        std::vector<deferred_executor_t> table(count);
+        uint32_t                         last_table_check = 0;
+
+        for (unsigned i = 1; i < count; i++) {
+            tokens.push_back(defer_exec(60000 + i * 7919 % 1000, never, NULL));
+            defer_exec_advanced(table.data(), count, 60000 + i * 7919 % 1000, never, NULL);
+        }
+        tokens.push_back(defer_exec(1, every_ms, NULL));
+        defer_exec_advanced(table.data(), count, 1, every_ms, NULL);
+
+        auto start = std::chrono::steady_clock::now();
+        for (unsigned i = 0; i < ticks; i++) {
+            advance_time(1);
+            deferred_exec_task();
+        }
+        auto   mid      = std::chrono::steady_clock::now();
+        double basic_ns = std::chrono::duration<double, std::nano>(mid - start).count() / ticks;
+        for (unsigned i = 0; i < ticks; i++) {
+            advance_time(1);
+            deferred_exec_advanced_task(table.data(), count, &last_table_check);
+        }
+        double table_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - mid).count() / ticks;
+
+        /* Scheduling churn: defer and cancel one executor while the others stay pending. */
+        cancel_deferred_exec(tokens.back());
+        start = std::chrono::steady_clock::now();
+        for (unsigned i = 0; i < ticks; i++) {
+            cancel_deferred_exec(defer_exec(1 + i % 1000, never, NULL));
+        }
+        double churn_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / ticks;
+
+        std::string name = "deferred_exec_" + std::to_string(count);
+        report_benchmark(name, {{"pending", count}, {"task/ms", basic_ns, "ns"}, {"linear-task/ms", table_ns, "ns"}, {"defer+cancel", churn_ns, "ns"}});
+    }
+};
+
+TEST_F(DeferredExecBenchmark, pending_8) {
+    bench(8);
+}
+
+TEST_F(DeferredExecBenchmark, pending_64) {
+    bench(64);
+}
+
+TEST_F(DeferredExecBenchmark, pending_512) {
+    bench(512);
+}
@@ -0,0 +1,9 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define DYNAMIC_MACRO_SIZE 32
+#define DYNAMIC_MACRO_PERSISTENT
@@ -0,0 +1,299 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <initializer_list>
+#include <utility>
+#include <vector>
+
+#include "benchmark_util.hpp"
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "crc.h"
+#include "eeconfig.h"
+#include "nvm_dynamic_macro.h"
+#include "process_dynamic_macro.h"
+}
+
+using testing::_;
+using testing::AnyNumber;
+using testing::Invoke;
+
+typedef std::vector<std::pair<uint32_t, report_keyboard_t>> timeline_t;
+
+static report_keyboard_t keys_report(std::initializer_list<uint8_t> keys) {
+    report_keyboard_t report = {};
+    uint8_t           index  = 0;
+    for (uint8_t key : keys) {
+        report.keys[index++] = key;
+    }
+    return report;
+}
+
+class DynamicMacro : public TestFixture {
+   public:
+    KeymapKey key_rec1{0, 0, 0, DM_REC1};
+    KeymapKey key_rec2{0, 1, 0, DM_REC2};
+    KeymapKey key_stop{0, 2, 0, DM_RSTP};
+    KeymapKey key_play1{0, 3, 0, DM_PLY1};
+    KeymapKey key_play2{0, 4, 0, DM_PLY2};
+    KeymapKey key_a{0, 5, 0, KC_A};
+    KeymapKey key_b{0, 6, 0, KC_B};
+    KeymapKey key_c{0, 7, 0, KC_C};
+    KeymapKey key_lsft{0, 8, 0, KC_LSFT};
+
+    timeline_t reports;
+
+    /* A key pressed or released, and how long to wait after it. */
+    struct Step {
+        KeymapKey *key;
+        bool       pressed;
+        uint32_t   wait_ms;
+    };
+
+    void SetUp() override {
+        eeconfig_init();
+        dynamic_macro_init();
+        set_keymap({key_rec1, key_rec2, key_stop, key_play1, key_play2, key_a, key_b, key_c, key_lsft});
+        reports.clear();
+    }
+
+    void TearDown() override {
+        dynamic_macro_stop_playing();
+    }
+
+    void capture_reports(TestDriver &driver) {
+        EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber()).WillRepeatedly(Invoke([this](report_keyboard_t &report) {
+            reports.push_back({timer_read32(), report});
+        }));
+    }
+
+    void run(const std::vector<Step> &steps) {
+        for (auto &step : steps) {
+            if (step.pressed) {
+                step.key->press();
+            } else {
+                step.key->release();
+            }
+            run_one_scan_loop();
+            idle_for(step.wait_ms);
+        }
+    }
+
+    /* Records the steps in a macro, and returns the index of the first report sent while recording. */
+    size_t record(KeymapKey &key_rec, const std::vector<Step> &steps) {
+        size_t start = reports.size();
+        tap_key(key_rec);
+        run(steps);
+        tap_key(key_stop);
+        return start;
+    }
+
+    /* Plays a macro until it ends, and returns the index of the first report it sent. */
+    size_t play(KeymapKey &key_play) {
+        size_t start = reports.size();
+        tap_key(key_play);
+        for (int i = 0; i < 60000 && dynamic_macro_is_playing(); i++) {
+            run_one_scan_loop();
+        }
+        EXPECT_FALSE(dynamic_macro_is_playing());
+        return start;
+    }
+
+    /* The reports sent from `start` to `end`, timed from the first one, leaving out repeated reports. */
+    timeline_t timeline(size_t start, size_t end = SIZE_MAX) {
+        timeline_t        result;
+        report_keyboard_t previous = {};
+        uint32_t          first    = 0;
+        for (size_t i = start; i < reports.size() && i < end; i++) {
+            if (reports[i].second == previous) continue;
+            if (result.empty()) first = reports[i].first;
+            result.push_back({reports[i].first - first, reports[i].second});
+            previous = reports[i].second;
+        }
+        return result;
+    }
+
+    static void expect_same_timeline(const timeline_t &recorded, const timeline_t &played) {
+        ASSERT_EQ(played.size(), recorded.size());
+        for (size_t i = 0; i < recorded.size(); i++) {
+            EXPECT_EQ(played[i].first, recorded[i].first) << "report " << i;
+            EXPECT_EQ(played[i].second, recorded[i].second) << "report " << i;
+        }
+    }
+};
+
+TEST_F(DynamicMacro, replays_recorded_timing) {
+    TestDriver driver;
+    capture_reports(driver);
+
+    size_t recorded = record(key_rec1, {
+                                           {&key_a, true, 40},
+                                           {&key_a, false, 150},
+                                           {&key_lsft, true, 20},
+                                           {&key_b, true, 60},
+                                           {&key_b, false, 5},
+                                           {&key_lsft, false, 2000},
+                                           {&key_c, true, 10},
+                                           {&key_c, false, 5000},
+                                           {&key_a, true, 0},
+                                           {&key_a, false, 100},
+                                       });
+    size_t     played   = play(key_play1);
+    timeline_t expected = timeline(recorded, played);
+
+    EXPECT_EQ(expected.size(), 10);
+    expect_same_timeline(expected, timeline(played));
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+TEST_F(DynamicMacro, keys_are_scanned_while_playing) {
+    TestDriver driver;
+    capture_reports(driver);
+
+    record(key_rec1, {{&key_a, true, 500}, {&key_a, false, 10}});
+
+    size_t start = reports.size();
+    tap_key(key_play1);
+    idle_for(100);
+    EXPECT_TRUE(dynamic_macro_is_playing());
+
+    // A key pressed during the playback is reported along with the keys the macro holds
+    key_c.press();
+    run_one_scan_loop();
+    EXPECT_EQ(reports.back().second, keys_report({KC_A, KC_C}));
+    key_c.release();
+    run_one_scan_loop();
+
+    while (dynamic_macro_is_playing()) {
+        run_one_scan_loop();
+    }
+    timeline_t played = timeline(start);
+    ASSERT_EQ(played.size(), 4);
+    // The macro held A for the 500 ms and the scan loop it was recorded with
+    EXPECT_EQ(played.back().first, 501);
+    EXPECT_EQ(played.back().second, keys_report({}));
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+TEST_F(DynamicMacro, macros_survive_power_loss) {
+    TestDriver driver;
+    capture_reports(driver);
+
+    size_t     recorded = record(key_rec2, {{&key_lsft, true, 30}, {&key_b, true, 70}, {&key_b, false, 0}, {&key_lsft, false, 300}, {&key_c, true, 20}, {&key_c, false, 0}});
+    timeline_t expected = timeline(recorded);
+
+    // Power loss: the RAM buffer is gone, and is read back from EEPROM
+    dynamic_macro_init();
+    expect_same_timeline(expected, timeline(play(key_play2)));
+
+    // Resetting EEPROM forgets them
+    eeconfig_init();
+    dynamic_macro_init();
+    EXPECT_TRUE(timeline(play(key_play2)).empty());
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+TEST_F(DynamicMacro, corrupt_saved_macro_is_dropped) {
+    TestDriver driver;
+    capture_reports(driver);
+
+    record(key_rec1, {{&key_a, true, 10}, {&key_a, false, 10}});
+    uint8_t key;
+    nvm_dynamic_macro_read_buffer(1, 1, &key);
+    key ^= 2; // A becomes C
+    nvm_dynamic_macro_update_buffer(1, 1, &key);
+
+    dynamic_macro_init();
+    EXPECT_TRUE(timeline(play(key_play1)).empty());
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+TEST_F(DynamicMacro, playback_stops_at_truncated_event) {
+    TestDriver driver;
+    capture_reports(driver);
+
+    // A pressed, then a press whose delay is cut short by the end of the macro
+    uint8_t saved[] = {0x80, 0 * MATRIX_COLS + 5, 0x80 | 0x20};
+    nvm_dynamic_macro_update_length(0, 0);
+    nvm_dynamic_macro_update_buffer(0, sizeof(saved), saved);
+    nvm_dynamic_macro_update_crc(0, crc8(saved, sizeof(saved)));
+    nvm_dynamic_macro_update_length(0, sizeof(saved));
+    dynamic_macro_init();
+
+    timeline_t played = timeline(play(key_play1));
+    ASSERT_EQ(played.size(), 2);
+    EXPECT_EQ(played[0].second, keys_report({KC_A}));
+    EXPECT_EQ(played[1].second, keys_report({}));
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+TEST_F(DynamicMacro, trailing_key_downs_are_trimmed) {
+    TestDriver driver;
+    capture_reports(driver);
+
+    // Shift is still held when the recording stops
+    record(key_rec1, {{&key_a, true, 10}, {&key_a, false, 10}, {&key_lsft, true, 10}});
+    key_lsft.release();
+    run_one_scan_loop();
+
+    timeline_t played = timeline(play(key_play1));
+    ASSERT_EQ(played.size(), 2);
+    EXPECT_EQ(played[0].second, keys_report({KC_A}));
+    EXPECT_EQ(played[1].second, keys_report({}));
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+TEST_F(DynamicMacro, macro_plays_other_macro) {
+    TestDriver driver;
+    capture_reports(driver);
+
+    record(key_rec2, {{&key_b, true, 50}, {&key_b, false, 0}});
+    // Macro 1 plays macro 2 in the middle, and itself, which is ignored
+    record(key_rec1, {{&key_a, true, 10}, {&key_a, false, 100}, {&key_play2, true, 10}, {&key_play2, false, 10}, {&key_play1, true, 10}, {&key_play1, false, 100}, {&key_c, true, 10}, {&key_c, false, 0}});
+
+    timeline_t played = timeline(play(key_play1));
+    ASSERT_EQ(played.size(), 6);
+    EXPECT_EQ(played[0].second, keys_report({KC_A}));
+    EXPECT_EQ(played[2].second, keys_report({KC_B}));
+    EXPECT_EQ(played[4].second, keys_report({KC_C}));
+    // Macro 2 starts when it was played, and macro 1 carries on after it ends
+    EXPECT_EQ(played[2].first, 123);
+    EXPECT_EQ(played[3].first, 123 + 51);
+    EXPECT_EQ(played[4].first, 123 + 51 + 123);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+/* Types random text into a macro until the buffer is full, and compares how many
+ * events it holds with a buffer of keyrecord_t the same size.
+ */
+TEST_F(DynamicMacro, benchmark_buffer_capacity) {
+    TestDriver driver;
+    capture_reports(driver);
+
+    KeymapKey       *keys[] = {&key_a, &key_b, &key_c};
+    std::vector<Step> steps;
+    uint32_t          rng = 1;
+    for (int i = 0; i < 100; i++) {
+        rng = rng * 1664525 + 1013904223;
+        steps.push_back({keys[(rng >> 8) % 3], true, 20 + (rng >> 12) % 100});
+        steps.push_back({steps.back().key, false, 30 + (rng >> 20) % 300});
+    }
+    size_t     recorded = record(key_rec1, steps);
+    size_t     played   = play(key_play1);
+    timeline_t expected = timeline(recorded, played);
+    timeline_t actual   = timeline(played);
+
+    // The macro is the start of the recording
+    ASSERT_LT(actual.size(), expected.size());
+    expected.resize(actual.size());
+    expect_same_timeline(expected, actual);
+
+    size_t keyrecords = DYNAMIC_MACRO_BUFFER_SIZE / sizeof(keyrecord_t);
+    report_benchmark("dynamic macro buffer", {{"events", actual.size()}, {"buffer-bytes", DYNAMIC_MACRO_BUFFER_SIZE}, {"bytes/event", (double)DYNAMIC_MACRO_BUFFER_SIZE / actual.size()}, {"keyrecord_t-events", keyrecords}});
+
+    EXPECT_GT(actual.size(), 2 * keyrecords);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
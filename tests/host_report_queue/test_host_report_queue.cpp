@@ -0,0 +1,436 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+
+#include "benchmark_util.hpp"
+#include "keycode.h"
+#include "mouse_report_util.hpp"
+#include "test_common.hpp"
+
+extern "C" {
+#include "host.h"
+
+void advance_time(uint32_t ms);
+}
+
+using testing::_;
+using testing::AnyNumber;
+using testing::InSequence;
+using testing::Invoke;
+
+class HostReportQueue : public TestFixture {
+   public:
+    host_report_queue_stats_t stats;
+
+    void SetUp() override {
+        host_report_queue_clear_stats();
+    }
+
+    host_report_queue_stats_t &get_stats() {
+        host_report_queue_get_stats(&stats);
+        return stats;
+    }
+};
+
+static report_mouse_t mouse_report(int16_t x, int16_t y, uint8_t buttons) {
+    report_mouse_t report = {};
+    report.x              = x;
+    report.y              = y;
+    report.buttons        = buttons;
+    return report;
+}
+
+TEST_F(HostReportQueue, ready_driver_gets_reports_right_away) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  key_a(0, 0, 0, KC_A);
+    set_keymap({key_a});
+
+    EXPECT_REPORT(driver, (KC_A));
+    key_a.press();
+    run_one_scan_loop();
+    EXPECT_EQ(host_report_queue_pending(), 0);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_a.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(get_stats().sent, 2);
+    EXPECT_EQ(stats.coalesced, 0);
+    EXPECT_EQ(stats.deferred, 0);
+}
+
+TEST_F(HostReportQueue, presses_are_not_coalesced_while_busy) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  key_lsft(0, 0, 0, KC_LSFT);
+    KeymapKey  key_a(0, 1, 0, KC_A);
+    KeymapKey  key_s(0, 2, 0, KC_S);
+    set_keymap({key_lsft, key_a, key_s});
+
+    driver.set_ready(false);
+    EXPECT_NO_REPORT(driver);
+    key_lsft.press();
+    run_one_scan_loop();
+    key_a.press();
+    run_one_scan_loop();
+    key_s.press();
+    run_one_scan_loop();
+    EXPECT_EQ(host_report_queue_pending(), 3);
+    VERIFY_AND_CLEAR(driver);
+
+    // The host gets the keys down in the order they were pressed
+    driver.set_ready(true);
+    EXPECT_REPORT(driver, (KC_LSFT));
+    EXPECT_REPORT(driver, (KC_LSFT, KC_A));
+    EXPECT_REPORT(driver, (KC_LSFT, KC_A, KC_S));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(get_stats().coalesced, 0);
+    EXPECT_EQ(stats.sent, 3);
+    EXPECT_GT(stats.deferred, 0);
+    EXPECT_EQ(stats.max_depth, 3);
+
+    EXPECT_REPORT(driver, (KC_LSFT, KC_S));
+    EXPECT_REPORT(driver, (KC_S));
+    EXPECT_EMPTY_REPORT(driver);
+    key_a.release();
+    run_one_scan_loop();
+    key_lsft.release();
+    run_one_scan_loop();
+    key_s.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(HostReportQueue, modifier_pressed_after_key_is_not_coalesced) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  key_a(0, 0, 0, KC_A);
+    KeymapKey  key_lsft(0, 1, 0, KC_LSFT);
+    set_keymap({key_a, key_lsft});
+
+    driver.set_ready(false);
+    EXPECT_NO_REPORT(driver);
+    key_a.press();
+    run_one_scan_loop();
+    key_lsft.press();
+    run_one_scan_loop();
+    EXPECT_EQ(host_report_queue_pending(), 2);
+    VERIFY_AND_CLEAR(driver);
+
+    // A is typed unshifted before shift goes down
+    driver.set_ready(true);
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_REPORT(driver, (KC_A, KC_LSFT));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(get_stats().coalesced, 0);
+
+    EXPECT_REPORT(driver, (KC_LSFT));
+    EXPECT_EMPTY_REPORT(driver);
+    key_a.release();
+    run_one_scan_loop();
+    key_lsft.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(HostReportQueue, keys_pressed_in_sequence_are_not_coalesced) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  key_a(0, 0, 0, KC_A);
+    KeymapKey  key_b(0, 1, 0, KC_B);
+    set_keymap({key_a, key_b});
+
+    driver.set_ready(false);
+    EXPECT_NO_REPORT(driver);
+    key_a.press();
+    run_one_scan_loop();
+    key_b.press();
+    run_one_scan_loop();
+    EXPECT_EQ(host_report_queue_pending(), 2);
+    VERIFY_AND_CLEAR(driver);
+
+    // A goes down on its own, so the host types "ab" and not "ba"
+    driver.set_ready(true);
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_REPORT(driver, (KC_A, KC_B));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(get_stats().coalesced, 0);
+
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    key_a.release();
+    run_one_scan_loop();
+    key_b.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(HostReportQueue, releases_are_coalesced_while_busy) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  key_a(0, 0, 0, KC_A);
+    KeymapKey  key_s(0, 1, 0, KC_S);
+    KeymapKey  key_d(0, 2, 0, KC_D);
+    set_keymap({key_a, key_s, key_d});
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_REPORT(driver, (KC_A, KC_S));
+    EXPECT_REPORT(driver, (KC_A, KC_S, KC_D));
+    key_a.press();
+    run_one_scan_loop();
+    key_s.press();
+    run_one_scan_loop();
+    key_d.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    driver.set_ready(false);
+    EXPECT_NO_REPORT(driver);
+    key_a.release();
+    run_one_scan_loop();
+    key_s.release();
+    run_one_scan_loop();
+    key_d.release();
+    run_one_scan_loop();
+    EXPECT_EQ(host_report_queue_pending(), 1);
+    VERIFY_AND_CLEAR(driver);
+
+    // Releases type nothing, so the host can get them all at once
+    driver.set_ready(true);
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(get_stats().coalesced, 2);
+    EXPECT_EQ(stats.sent, 4);
+}
+
+TEST_F(HostReportQueue, modifier_released_after_key_is_not_coalesced) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  key_lsft(0, 0, 0, KC_LSFT);
+    KeymapKey  key_a(0, 1, 0, KC_A);
+    set_keymap({key_lsft, key_a});
+
+    EXPECT_REPORT(driver, (KC_LSFT));
+    EXPECT_REPORT(driver, (KC_LSFT, KC_A));
+    key_lsft.press();
+    run_one_scan_loop();
+    key_a.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    driver.set_ready(false);
+    EXPECT_NO_REPORT(driver);
+    key_a.release();
+    run_one_scan_loop();
+    key_lsft.release();
+    run_one_scan_loop();
+    EXPECT_EQ(host_report_queue_pending(), 2);
+    VERIFY_AND_CLEAR(driver);
+
+    driver.set_ready(true);
+    EXPECT_REPORT(driver, (KC_LSFT));
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(get_stats().coalesced, 0);
+}
+
+TEST_F(HostReportQueue, repeated_report_is_coalesced) {
+    TestDriver        driver;
+    InSequence        s;
+    report_keyboard_t report = {};
+    report.keys[0]           = KC_A;
+
+    driver.set_ready(false);
+    EXPECT_NO_REPORT(driver);
+    host_keyboard_send(&report);
+    host_keyboard_send(&report);
+    EXPECT_EQ(host_report_queue_pending(), 1);
+    VERIFY_AND_CLEAR(driver);
+
+    driver.set_ready(true);
+    EXPECT_REPORT(driver, (KC_A));
+    host_report_queue_task();
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(get_stats().coalesced, 1);
+
+    EXPECT_EMPTY_REPORT(driver);
+    report.keys[0] = KC_NO;
+    host_keyboard_send(&report);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(HostReportQueue, tap_is_not_coalesced) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  key_a(0, 0, 0, KC_A);
+    KeymapKey  key_s(0, 1, 0, KC_S);
+    set_keymap({key_a, key_s});
+
+    // A key pressed then released, or released while another is pressed, must reach the host
+    driver.set_ready(false);
+    EXPECT_NO_REPORT(driver);
+    key_a.press();
+    run_one_scan_loop();
+    key_a.release();
+    key_s.press();
+    run_one_scan_loop();
+    key_s.release();
+    run_one_scan_loop();
+    EXPECT_EQ(host_report_queue_pending(), 4);
+    VERIFY_AND_CLEAR(driver);
+
+    driver.set_ready(true);
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_S));
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(get_stats().coalesced, 0);
+    EXPECT_EQ(stats.sent, 4);
+}
+
+TEST_F(HostReportQueue, mouse_movement_is_added_up) {
+    TestDriver driver;
+    InSequence s;
+
+    driver.set_ready(false);
+    for (auto report : {mouse_report(10, 0, 0), mouse_report(10, -5, 0), mouse_report(10, 0, 0), mouse_report(0, 0, 1), mouse_report(120, 0, 1), mouse_report(120, 0, 1)}) {
+        host_mouse_send(&report);
+    }
+    // Moving, pressing the button, and moving further than a single report can hold
+    EXPECT_EQ(host_report_queue_pending(), 3);
+
+    driver.set_ready(true);
+    EXPECT_MOUSE_REPORT(driver, (30, -5, 0, 0, 0));
+    EXPECT_MOUSE_REPORT(driver, (120, 0, 0, 0, 1));
+    EXPECT_MOUSE_REPORT(driver, (120, 0, 0, 0, 1));
+    host_report_queue_task();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(get_stats().coalesced, 3);
+}
+
+TEST_F(HostReportQueue, full_queue_waits_on_driver) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  key_a(0, 0, 0, KC_A);
+    set_keymap({key_a});
+
+    driver.set_ready(false);
+    for (int i = 0; i < HOST_REPORT_QUEUE_SIZE; i++) {
+        EXPECT_REPORT(driver, (KC_A));
+        EXPECT_EMPTY_REPORT(driver);
+    }
+    for (int i = 0; i < HOST_REPORT_QUEUE_SIZE; i++) {
+        tap_key(key_a);
+    }
+    // The oldest reports were sent to make room, the others wait
+    EXPECT_EQ(host_report_queue_pending(), HOST_REPORT_QUEUE_SIZE);
+    EXPECT_EQ(get_stats().forced, HOST_REPORT_QUEUE_SIZE);
+    EXPECT_EQ(stats.max_depth, HOST_REPORT_QUEUE_SIZE);
+
+    host_report_queue_flush();
+    EXPECT_EQ(host_report_queue_pending(), 0);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(HostReportQueue, reports_are_dropped_without_driver) {
+    TestDriver driver;
+    KeymapKey  key_a(0, 0, 0, KC_A);
+    set_keymap({key_a});
+
+    driver.set_ready(false);
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_a);
+    EXPECT_EQ(host_report_queue_pending(), 2);
+
+    host_set_driver(NULL);
+    host_report_queue_task();
+    EXPECT_EQ(host_report_queue_pending(), 0);
+    EXPECT_EQ(get_stats().dropped, 2);
+    EXPECT_EQ(stats.sent, 0);
+    VERIFY_AND_CLEAR(driver);
+}
+
+/* Types for ten seconds at about 150 wpm, rolling over keys, with a burst of
+ * backspaces every second as autocorrect sends, to a host polling every 8 ms.
+ */
+TEST_F(HostReportQueue, benchmark_slow_polling) {
+    TestDriver             driver;
+    std::vector<KeymapKey> keys;
+    for (uint8_t col = 0; col < 8; col++) {
+        keys.emplace_back(0, col, 0, KC_A + col);
+    }
+    set_keymap({keys[0], keys[1], keys[2], keys[3], keys[4], keys[5], keys[6], keys[7]});
+
+    report_keyboard_t last = {};
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber()).WillRepeatedly(Invoke([&](report_keyboard_t &report) {
+        last = report;
+        driver.set_ready(false);
+    }));
+
+    uint32_t rng    = 1;
+    auto     random = [&](uint32_t range) {
+        rng = rng * 1664525 + 1013904223;
+        return (rng >> 8) % range;
+    };
+    std::vector<uint32_t> release_at(keys.size(), 0);
+
+    for (uint32_t ms = 0; ms < 10000; ms++) {
+        if (ms % 8 == 0) {
+            driver.set_ready(true);
+        }
+        if (ms % 80 == 0) {
+            uint8_t key = random(keys.size());
+            if (!release_at[key]) {
+                keys[key].press();
+                release_at[key] = ms + 60 + random(60);
+            }
+        }
+        for (uint8_t key = 0; key < keys.size(); key++) {
+            if (release_at[key] && release_at[key] <= ms) {
+                keys[key].release();
+                release_at[key] = 0;
+            }
+        }
+        if (ms % 1000 == 500) {
+            for (int i = 0; i < 5; i++) {
+                tap_code(KC_BACKSPACE);
+            }
+        }
+        keyboard_task();
+        advance_time(1);
+    }
+    for (uint8_t key = 0; key < keys.size(); key++) {
+        if (release_at[key]) {
+            keys[key].release();
+        }
+    }
+    driver.set_ready(true);
+    run_one_scan_loop();
+    host_report_queue_flush();
+    VERIFY_AND_CLEAR(driver);
+
+    get_stats();
+    report_benchmark("8 ms polling", {{"reports", stats.sent + stats.coalesced}, {"sent", stats.sent}, {"coalesced", stats.coalesced}, {"waited-on-driver", stats.forced}, {"max-depth", stats.max_depth}});
+
+    // Every key ends up released on the host
+    EXPECT_EQ(last.mods, 0);
+    for (uint8_t key : last.keys) {
+        EXPECT_EQ(key, KC_NO);
+    }
+    EXPECT_GT(stats.coalesced, 0);
+}
@@ -12,8 +12,10 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <chrono>
 #include <iostream>
 
+#include "benchmark_util.hpp"
 #include "test_common.hpp"
 
 enum {
@@ -151,3 +153,89 @@ TEST_F(KeycodeStringTest, get_keycode_string) {
         EXPECT_EQ(get_keycode_string(keycode), expected) << "where keycode = 0x" << std::hex << keycode;
     }
 }
+
+TEST_F(KeycodeStringTest, parse_keycode_string) {
+    struct TestParams {
+        std::string str;
+        uint16_t    expected;
+    };
+    for (const auto [str, expected] : std::vector<TestParams>({
+             {"KC_A", KC_A},
+             {"KC_0", KC_0},
+             {"KC_KP_0", KC_KP_0},
+             {"KC_F24", KC_F24},
+             {"KC_RGUI", KC_RGUI},
+             {"KC_ENT", KC_ENT},
+             {"S(KC_SCLN)", KC_COLN},
+             {"RALT(KC_BSPC)", RALT(KC_BSPC)},
+             {"LT(15,KC_QUOT)", LT(15, KC_QUOT)},
+             {"LM(3,MOD_RALT)", LM(3, MOD_RALT)},
+             {"OSM(0x19)", OSM(MOD_RCTL | MOD_RGUI)},
+             {"PDF(12)", PDF(12)},
+             {"RCTL_T(KC_RGHT)", RCTL_T(KC_RGHT)},
+             {"MT(0x16,KC_LBRC)", RSA_T(KC_LBRC)},
+             {"SH_T(KC_PSCR)", SH_T(KC_PSCR)},
+             {"QK_MAGIC+7", QK_MAGIC + 7},
+             {"QK_USER_31", QK_USER_31},
+             {"MYMACRO1", MYMACRO1},
+             {"KC_EXLM", KC_EXLM},
+             {"0x4207", LT(2, KC_D)},
+             {"16903", LT(2, KC_D)},
+         })) {
+        uint16_t keycode = 0;
+        EXPECT_TRUE(parse_keycode_string(str.c_str(), &keycode)) << "where str = " << str;
+        EXPECT_EQ(keycode, expected) << "where str = " << str;
+    }
+
+    for (const std::string str : {"", "KC_", "KC_AB", "KC_F25", "MO(32)", "LT(1,MO(2))", "S(KC_A", "S(KC_A))", "C(KC_A),", "0x10000", "QK_KB_32", "KC_LBRCX"}) {
+        uint16_t keycode = 0x1234;
+        EXPECT_FALSE(parse_keycode_string(str.c_str(), &keycode)) << "where str = " << str;
+        EXPECT_EQ(keycode, 0x1234) << "where str = " << str;
+    }
+}
+
+TEST_F(KeycodeStringTest, common_names_are_sorted) {
+    // Every name in the table is found by the binary search when formatting.
+    for (const std::string name : {
+             "KC_TRNS", "KC_ENT",  "KC_ESC",  "KC_BSPC", "KC_TAB",  "KC_SPC",  "KC_MINS", "KC_EQL",  "KC_LBRC", "KC_RBRC", "KC_BSLS", "KC_NUHS", "KC_SCLN", "KC_QUOT", "KC_GRV",  "KC_COMM", "KC_DOT",  "KC_SLSH", "KC_CAPS", "KC_PSCR", "KC_PAUS", "KC_INS",  "KC_HOME", "KC_PGUP", "KC_DEL",  "KC_END",  "KC_PGDN", "KC_RGHT", "KC_LEFT", "KC_DOWN", "KC_UP",   "KC_NUBS",
+             "KC_MUTE", "KC_VOLU", "KC_VOLD", "KC_MNXT", "KC_MPRV", "KC_MPLY", "KC_WHOM", "KC_WBAK", "KC_WFWD", "KC_WSTP", "KC_WREF", "MS_UP",   "MS_DOWN", "MS_LEFT", "MS_RGHT", "MS_WHLU", "MS_WHLD", "MS_WHLL", "MS_WHLR", "KC_MEH",  "KC_HYPR", "SH_TOGG", "SH_TT",   "SH_MON",  "SH_MOFF", "SH_OFF",  "SH_ON",   "SH_OS",   "QK_BOOT", "DB_TOGG", "EE_CLR",
+             "QK_GESC", "QK_LEAD", "QK_LOCK", "SE_LOCK", "SE_UNLK", "SE_TOGG", "SE_REQ",  "CW_TOGG", "TL_LOWR", "TL_UPPR", "QK_LLCK",
+         }) {
+        uint16_t keycode = 0;
+        EXPECT_TRUE(parse_keycode_string(name.c_str(), &keycode)) << "where name = " << name;
+        EXPECT_EQ(get_keycode_string(keycode), name) << "where keycode = 0x" << std::hex << keycode;
+    }
+}
+
+/* Formats every 16-bit keycode, parses the string back and reports how long
+ * each direction takes per keycode.
+ */
+TEST_F(KeycodeStringTest, benchmark_all_keycodes) {
+    const unsigned           keycodes = 0x10000;
+    std::vector<std::string> strings(keycodes);
+
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned keycode = 0; keycode < keycodes; ++keycode) {
+        strings[keycode] = get_keycode_string(keycode);
+    }
+    double format_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / keycodes;
+
+    std::vector<uint16_t> parsed(keycodes);
+    unsigned              failures = 0;
+    start                          = std::chrono::steady_clock::now();
+    for (unsigned keycode = 0; keycode < keycodes; ++keycode) {
+        failures += !parse_keycode_string(strings[keycode].c_str(), &parsed[keycode]);
+    }
+    double parse_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / keycodes;
+
+    report_benchmark("keycode_string", {{"keycodes", keycodes}, {"format", format_ns, "ns"}, {"parse", parse_ns, "ns"}});
+
+    EXPECT_EQ(failures, 0);
+    unsigned mismatches = 0;
+    for (unsigned keycode = 0; keycode < keycodes; ++keycode) {
+        if (parsed[keycode] != keycode && ++mismatches <= 10) {
+            ADD_FAILURE() << strings[keycode] << " parses to 0x" << std::hex << parsed[keycode] << " instead of 0x" << keycode;
+        }
+    }
+    EXPECT_EQ(mismatches, 0);
+}
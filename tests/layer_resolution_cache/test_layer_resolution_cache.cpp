@@ -0,0 +1,173 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+
+#include "benchmark_util.hpp"
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+extern "C" {
+#include "action_layer.h"
+}
+
+using testing::_;
+using testing::InSequence;
+
+class LayerResolutionCache : public TestFixture {
+   public:
+    /* Fills every layer of a 32 layer keymap with KC_TRNS, except for layer 0. */
+    void set_transparent_keymap() {
+        set_keymap({});
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                add_key(KeymapKey(0, col, row, KC_A + (row * MATRIX_COLS + col) % 26));
+                for (uint8_t layer = 1; layer < MAX_LAYER; layer++) {
+                    if (layer != 7 || row != 0 || col != 0) {
+                        add_key(KeymapKey(layer, col, row, KC_TRNS));
+                    }
+                }
+            }
+        }
+        add_key(KeymapKey(7, 0, 0, KC_B));
+    }
+
+    static uint8_t resolve(uint8_t col, uint8_t row) {
+        return layer_switch_get_layer((keypos_t){.col = col, .row = row});
+    }
+};
+
+TEST_F(LayerResolutionCache, resolves_through_transparent_layers) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+    set_transparent_keymap();
+
+    layer_state_set(UINT32_MAX);
+    EXPECT_EQ(resolve(0, 0), 7);
+    EXPECT_EQ(resolve(1, 0), 0);
+    /* And again, from the cache. */
+    EXPECT_EQ(resolve(0, 0), 7);
+    EXPECT_EQ(resolve(1, 0), 0);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LayerResolutionCache, layer_state_change_invalidates) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+    set_transparent_keymap();
+
+    layer_state_set(UINT32_MAX);
+    EXPECT_EQ(resolve(0, 0), 7);
+    layer_off(7);
+    EXPECT_EQ(resolve(0, 0), 0);
+    layer_on(7);
+    EXPECT_EQ(resolve(0, 0), 7);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LayerResolutionCache, default_layer_change_invalidates) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+    set_transparent_keymap();
+
+    layer_clear();
+    EXPECT_EQ(resolve(0, 0), 0);
+    default_layer_set((layer_state_t)1 << 7);
+    EXPECT_EQ(resolve(0, 0), 7);
+    default_layer_set(1);
+    EXPECT_EQ(resolve(0, 0), 0);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LayerResolutionCache, keymap_change_invalidates) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+    set_transparent_keymap();
+
+    layer_state_set(UINT32_MAX);
+    EXPECT_EQ(resolve(0, 0), 7);
+    set_keymap({KeymapKey(0, 0, 0, KC_A), KeymapKey(31, 0, 0, KC_C)});
+    EXPECT_EQ(resolve(0, 0), 31);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LayerResolutionCache, momentary_layer_reaches_host) {
+    TestDriver driver;
+    InSequence s;
+    auto       layer_key = KeymapKey(0, 9, 3, MO(7));
+    auto       key       = KeymapKey(0, 0, 0, KC_A);
+
+    set_keymap({layer_key, key, KeymapKey(7, 0, 0, KC_B)});
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_REPORT(driver);
+    layer_key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_REPORT(driver);
+    layer_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LayerResolutionCache, benchmark_32_transparent_layers) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+    set_transparent_keymap();
+    layer_state_set(UINT32_MAX);
+
+    /* Every key but one falls through 31 transparent layers down to layer 0. */
+    const unsigned rounds  = 200;
+    const unsigned lookups = rounds * MATRIX_ROWS * MATRIX_COLS;
+    uint32_t       sum     = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned i = 0; i < rounds; i++) {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                layer_resolution_cache_clear();
+                sum += resolve(col, row);
+            }
+        }
+    }
+    double uncached_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / lookups;
+
+    /* Fill the cache, then every lookup is a single read of it. */
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            sum += resolve(col, row);
+        }
+    }
+    start = std::chrono::steady_clock::now();
+    for (unsigned i = 0; i < rounds; i++) {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                sum += resolve(col, row);
+            }
+        }
+    }
+    double cached_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / lookups;
+
+    report_benchmark("layer_resolution_32", {{"layers", MAX_LAYER}, {"lookup", uncached_ns, "ns"}, {"cached-lookup", cached_ns, "ns"}});
+    EXPECT_EQ(sum, (2 * rounds + 1) * 7);
+    EXPECT_LT(cached_ns, uncached_ns);
+    VERIFY_AND_CLEAR(driver);
+}
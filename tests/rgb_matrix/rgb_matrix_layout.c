@@ -0,0 +1,40 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "rgb_matrix.h"
+
+/*
+ * 16 by 8 LEDs spread evenly over the whole LED area, with the keys of the
+ * 4 by 10 test matrix in the middle of rows 1 to 4 and underglow around them.
+ * The outer key columns are modifiers.
+ */
+// clang-format off
+led_config_t g_led_config = {
+    {
+        { 19,  20,  21,  22,  23,  24,  25,  26,  27,  28},
+        { 35,  36,  37,  38,  39,  40,  41,  42,  43,  44},
+        { 51,  52,  53,  54,  55,  56,  57,  58,  59,  60},
+        { 67,  68,  69,  70,  71,  72,  73,  74,  75,  76},
+    },
+    {
+        {  0,  0}, { 14,  0}, { 29,  0}, { 44,  0}, { 59,  0}, { 74,  0}, { 89,  0}, {104,  0}, {119,  0}, {134,  0}, {149,  0}, {164,  0}, {179,  0}, {194,  0}, {209,  0}, {224,  0},
+        {  0,  9}, { 14,  9}, { 29,  9}, { 44,  9}, { 59,  9}, { 74,  9}, { 89,  9}, {104,  9}, {119,  9}, {134,  9}, {149,  9}, {164,  9}, {179,  9}, {194,  9}, {209,  9}, {224,  9},
+        {  0, 18}, { 14, 18}, { 29, 18}, { 44, 18}, { 59, 18}, { 74, 18}, { 89, 18}, {104, 18}, {119, 18}, {134, 18}, {149, 18}, {164, 18}, {179, 18}, {194, 18}, {209, 18}, {224, 18},
+        {  0, 27}, { 14, 27}, { 29, 27}, { 44, 27}, { 59, 27}, { 74, 27}, { 89, 27}, {104, 27}, {119, 27}, {134, 27}, {149, 27}, {164, 27}, {179, 27}, {194, 27}, {209, 27}, {224, 27},
+        {  0, 36}, { 14, 36}, { 29, 36}, { 44, 36}, { 59, 36}, { 74, 36}, { 89, 36}, {104, 36}, {119, 36}, {134, 36}, {149, 36}, {164, 36}, {179, 36}, {194, 36}, {209, 36}, {224, 36},
+        {  0, 45}, { 14, 45}, { 29, 45}, { 44, 45}, { 59, 45}, { 74, 45}, { 89, 45}, {104, 45}, {119, 45}, {134, 45}, {149, 45}, {164, 45}, {179, 45}, {194, 45}, {209, 45}, {224, 45},
+        {  0, 54}, { 14, 54}, { 29, 54}, { 44, 54}, { 59, 54}, { 74, 54}, { 89, 54}, {104, 54}, {119, 54}, {134, 54}, {149, 54}, {164, 54}, {179, 54}, {194, 54}, {209, 54}, {224, 54},
+        {  0, 64}, { 14, 64}, { 29, 64}, { 44, 64}, { 59, 64}, { 74, 64}, { 89, 64}, {104, 64}, {119, 64}, {134, 64}, {149, 64}, {164, 64}, {179, 64}, {194, 64}, {209, 64}, {224, 64},
+    },
+    {
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 5, 4, 4, 4, 4, 4, 4, 4, 4, 5, 2, 2, 2,
+        2, 2, 2, 5, 4, 4, 4, 4, 4, 4, 4, 4, 5, 2, 2, 2,
+        2, 2, 2, 5, 4, 4, 4, 4, 4, 4, 4, 4, 5, 2, 2, 2,
+        2, 2, 2, 5, 4, 4, 4, 4, 4, 4, 4, 4, 5, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    }
+};
+// clang-format on
@@ -0,0 +1,95 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Generated from rgb_matrix_layout.c the way qmk generate-keyboard-c does for an info.json layout,
+// lib/python/qmk/tests/test_qmk_keyboard_c.py checks that it still is.
+
+#include "rgb_matrix.h"
+
+// clang-format off
+#ifdef RGB_MATRIX_TYPING_HEATMAP_NEIGHBOURS
+__attribute__ ((weak)) const uint16_t g_typing_heatmap_neighbours_start[] PROGMEM = { 0, 11, 26, 44, 62, 80, 98, 116, 134, 149, 160, 172, 188, 208, 228, 248, 268, 288, 308, 324, 336, 348, 364, 384, 404, 424, 444, 464, 484, 500, 512, 523, 538, 556, 574, 592, 610, 628, 646, 661, 672 };
+__attribute__ ((weak)) const typing_heatmap_neighbour_t g_typing_heatmap_neighbours[] PROGMEM = {
+  // 0, 0
+  {0, 0, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(0)}, {0, 1, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {0, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {1, 0, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(9)}, {1, 1, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {1, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {2, 0, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(18)}, {2, 1, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {2, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(34)}, {3, 0, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(27)}, {3, 1, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)},
+  // 0, 1
+  {0, 0, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {0, 1, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(0)}, {0, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {0, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {1, 0, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {1, 1, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(9)}, {1, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {1, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {2, 0, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {2, 1, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(18)}, {2, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {2, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(34)}, {3, 0, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {3, 1, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(27)}, {3, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)},
+  // 0, 2
+  {0, 0, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {0, 1, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {0, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(0)}, {0, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {0, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {1, 0, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {1, 1, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {1, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(9)}, {1, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {1, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {2, 0, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(34)}, {2, 1, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {2, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(18)}, {2, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {2, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(34)}, {3, 1, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {3, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(27)}, {3, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)},
+  // 0, 3
+  {0, 1, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {0, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {0, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(0)}, {0, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {0, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {1, 1, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {1, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {1, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(9)}, {1, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {1, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {2, 1, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(34)}, {2, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {2, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(18)}, {2, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {2, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(34)}, {3, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {3, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(27)}, {3, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)},
+  // 0, 4
+  {0, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {0, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {0, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(0)}, {0, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {0, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {1, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {1, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {1, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(9)}, {1, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {1, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {2, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(34)}, {2, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {2, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(18)}, {2, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {2, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(34)}, {3, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {3, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(27)}, {3, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)},
+  // 0, 5
+  {0, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {0, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {0, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(0)}, {0, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {0, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {1, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {1, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {1, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(9)}, {1, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {1, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {2, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(34)}, {2, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {2, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(18)}, {2, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {2, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(34)}, {3, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {3, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(27)}, {3, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)},
+  // 0, 6
+  {0, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {0, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {0, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(0)}, {0, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {0, 8, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {1, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {1, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {1, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(9)}, {1, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {1, 8, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {2, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(34)}, {2, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {2, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(18)}, {2, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {2, 8, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(34)}, {3, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {3, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(27)}, {3, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)},
+  // 0, 7
+  {0, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {0, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {0, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(0)}, {0, 8, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {0, 9, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {1, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {1, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {1, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(9)}, {1, 8, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {1, 9, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {2, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(34)}, {2, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {2, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(18)}, {2, 8, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {2, 9, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(34)}, {3, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {3, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(27)}, {3, 8, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)},
+  // 0, 8
+  {0, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {0, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {0, 8, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(0)}, {0, 9, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {1, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {1, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {1, 8, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(9)}, {1, 9, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {2, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(34)}, {2, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {2, 8, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(18)}, {2, 9, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {3, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {3, 8, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(27)}, {3, 9, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)},
+  // 0, 9
+  {0, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {0, 8, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {0, 9, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(0)}, {1, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {1, 8, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {1, 9, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(9)}, {2, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(34)}, {2, 8, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {2, 9, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(18)}, {3, 8, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {3, 9, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(27)},
+  // 1, 0
+  {0, 0, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(9)}, {0, 1, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {0, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {1, 0, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(0)}, {1, 1, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {1, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {2, 0, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(9)}, {2, 1, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {2, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {3, 0, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(18)}, {3, 1, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {3, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(34)},
+  // 1, 1
+  {0, 0, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {0, 1, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(9)}, {0, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {0, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {1, 0, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {1, 1, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(0)}, {1, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {1, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {2, 0, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {2, 1, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(9)}, {2, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {2, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {3, 0, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {3, 1, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(18)}, {3, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {3, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(34)},
+  // 1, 2
+  {0, 0, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {0, 1, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {0, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(9)}, {0, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {0, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {1, 0, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {1, 1, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {1, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(0)}, {1, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {1, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {2, 0, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {2, 1, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {2, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(9)}, {2, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {2, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {3, 0, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(34)}, {3, 1, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {3, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(18)}, {3, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {3, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(34)},
+  // 1, 3
+  {0, 1, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {0, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {0, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(9)}, {0, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {0, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {1, 1, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {1, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {1, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(0)}, {1, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {1, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {2, 1, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {2, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {2, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(9)}, {2, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {2, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {3, 1, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(34)}, {3, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {3, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(18)}, {3, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {3, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(34)},
+  // 1, 4
+  {0, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {0, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {0, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(9)}, {0, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {0, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {1, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {1, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {1, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(0)}, {1, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {1, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {2, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {2, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {2, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(9)}, {2, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {2, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {3, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(34)}, {3, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {3, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(18)}, {3, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {3, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(34)},
+  // 1, 5
+  {0, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {0, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {0, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(9)}, {0, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {0, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {1, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {1, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {1, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(0)}, {1, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {1, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {2, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {2, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {2, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(9)}, {2, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {2, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {3, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(34)}, {3, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {3, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(18)}, {3, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {3, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(34)},
+  // 1, 6
+  {0, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {0, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {0, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(9)}, {0, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {0, 8, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {1, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {1, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {1, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(0)}, {1, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {1, 8, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {2, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {2, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {2, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(9)}, {2, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {2, 8, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {3, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(34)}, {3, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {3, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(18)}, {3, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {3, 8, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(34)},
+  // 1, 7
+  {0, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {0, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {0, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(9)}, {0, 8, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {0, 9, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {1, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {1, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {1, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(0)}, {1, 8, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {1, 9, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {2, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {2, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {2, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(9)}, {2, 8, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {2, 9, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {3, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(34)}, {3, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {3, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(18)}, {3, 8, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {3, 9, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(34)},
+  // 1, 8
+  {0, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {0, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {0, 8, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(9)}, {0, 9, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {1, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {1, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {1, 8, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(0)}, {1, 9, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {2, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {2, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {2, 8, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(9)}, {2, 9, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {3, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(34)}, {3, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {3, 8, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(18)}, {3, 9, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)},
+  // 1, 9
+  {0, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {0, 8, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {0, 9, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(9)}, {1, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {1, 8, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {1, 9, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(0)}, {2, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {2, 8, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {2, 9, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(9)}, {3, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(34)}, {3, 8, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {3, 9, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(18)},
+  // 2, 0
+  {0, 0, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(18)}, {0, 1, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {0, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(34)}, {1, 0, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(9)}, {1, 1, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {1, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {2, 0, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(0)}, {2, 1, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {2, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {3, 0, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(9)}, {3, 1, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {3, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)},
+  // 2, 1
+  {0, 0, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {0, 1, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(18)}, {0, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {0, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(34)}, {1, 0, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {1, 1, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(9)}, {1, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {1, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {2, 0, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {2, 1, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(0)}, {2, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {2, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {3, 0, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {3, 1, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(9)}, {3, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {3, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)},
+  // 2, 2
+  {0, 0, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(34)}, {0, 1, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {0, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(18)}, {0, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {0, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(34)}, {1, 0, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {1, 1, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {1, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(9)}, {1, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {1, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {2, 0, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {2, 1, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {2, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(0)}, {2, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {2, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {3, 0, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {3, 1, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {3, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(9)}, {3, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {3, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)},
+  // 2, 3
+  {0, 1, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(34)}, {0, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {0, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(18)}, {0, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {0, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(34)}, {1, 1, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {1, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {1, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(9)}, {1, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {1, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {2, 1, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {2, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {2, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(0)}, {2, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {2, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {3, 1, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {3, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {3, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(9)}, {3, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {3, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)},
+  // 2, 4
+  {0, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(34)}, {0, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {0, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(18)}, {0, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {0, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(34)}, {1, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {1, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {1, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(9)}, {1, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {1, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {2, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {2, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {2, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(0)}, {2, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {2, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {3, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {3, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {3, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(9)}, {3, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {3, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)},
+  // 2, 5
+  {0, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(34)}, {0, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {0, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(18)}, {0, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {0, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(34)}, {1, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {1, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {1, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(9)}, {1, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {1, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {2, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {2, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {2, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(0)}, {2, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {2, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {3, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {3, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {3, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(9)}, {3, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {3, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)},
+  // 2, 6
+  {0, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(34)}, {0, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {0, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(18)}, {0, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {0, 8, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(34)}, {1, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {1, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {1, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(9)}, {1, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {1, 8, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {2, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {2, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {2, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(0)}, {2, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {2, 8, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {3, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {3, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {3, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(9)}, {3, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {3, 8, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)},
+  // 2, 7
+  {0, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(34)}, {0, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {0, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(18)}, {0, 8, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {0, 9, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(34)}, {1, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {1, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {1, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(9)}, {1, 8, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {1, 9, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {2, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {2, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {2, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(0)}, {2, 8, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {2, 9, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {3, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {3, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {3, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(9)}, {3, 8, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {3, 9, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)},
+  // 2, 8
+  {0, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(34)}, {0, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {0, 8, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(18)}, {0, 9, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {1, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {1, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {1, 8, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(9)}, {1, 9, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {2, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {2, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {2, 8, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(0)}, {2, 9, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {3, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {3, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {3, 8, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(9)}, {3, 9, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)},
+  // 2, 9
+  {0, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(34)}, {0, 8, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {0, 9, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(18)}, {1, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {1, 8, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {1, 9, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(9)}, {2, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {2, 8, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {2, 9, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(0)}, {3, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {3, 8, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {3, 9, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(9)},
+  // 3, 0
+  {0, 0, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(27)}, {0, 1, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {1, 0, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(18)}, {1, 1, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {1, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(34)}, {2, 0, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(9)}, {2, 1, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {2, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {3, 0, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(0)}, {3, 1, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {3, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)},
+  // 3, 1
+  {0, 0, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {0, 1, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(27)}, {0, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {1, 0, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {1, 1, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(18)}, {1, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {1, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(34)}, {2, 0, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {2, 1, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(9)}, {2, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {2, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {3, 0, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {3, 1, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(0)}, {3, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {3, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)},
+  // 3, 2
+  {0, 1, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {0, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(27)}, {0, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {1, 0, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(34)}, {1, 1, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {1, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(18)}, {1, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {1, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(34)}, {2, 0, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {2, 1, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {2, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(9)}, {2, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {2, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {3, 0, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {3, 1, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {3, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(0)}, {3, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {3, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)},
+  // 3, 3
+  {0, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {0, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(27)}, {0, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {1, 1, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(34)}, {1, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {1, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(18)}, {1, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {1, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(34)}, {2, 1, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {2, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {2, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(9)}, {2, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {2, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {3, 1, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {3, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {3, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(0)}, {3, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {3, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)},
+  // 3, 4
+  {0, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {0, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(27)}, {0, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {1, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(34)}, {1, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {1, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(18)}, {1, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {1, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(34)}, {2, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {2, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {2, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(9)}, {2, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {2, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {3, 2, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {3, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {3, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(0)}, {3, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {3, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)},
+  // 3, 5
+  {0, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {0, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(27)}, {0, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {1, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(34)}, {1, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {1, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(18)}, {1, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {1, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(34)}, {2, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {2, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {2, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(9)}, {2, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {2, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {3, 3, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {3, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {3, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(0)}, {3, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {3, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)},
+  // 3, 6
+  {0, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {0, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(27)}, {0, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {1, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(34)}, {1, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {1, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(18)}, {1, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {1, 8, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(34)}, {2, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {2, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {2, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(9)}, {2, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {2, 8, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {3, 4, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {3, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {3, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(0)}, {3, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {3, 8, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)},
+  // 3, 7
+  {0, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {0, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(27)}, {0, 8, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {1, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(34)}, {1, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {1, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(18)}, {1, 8, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {1, 9, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(34)}, {2, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {2, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {2, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(9)}, {2, 8, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {2, 9, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {3, 5, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {3, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {3, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(0)}, {3, 8, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {3, 9, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)},
+  // 3, 8
+  {0, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {0, 8, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(27)}, {0, 9, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {1, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(34)}, {1, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {1, 8, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(18)}, {1, 9, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {2, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {2, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {2, 8, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(9)}, {2, 9, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {3, 6, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {3, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {3, 8, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(0)}, {3, 9, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)},
+  // 3, 9
+  {0, 8, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {0, 9, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(27)}, {1, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(34)}, {1, 8, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(23)}, {1, 9, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(18)}, {2, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(31)}, {2, 8, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(17)}, {2, 9, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(9)}, {3, 7, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(30)}, {3, 8, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(15)}, {3, 9, RGB_MATRIX_TYPING_HEATMAP_AMOUNT(0)},
+};
+#endif
+// clang-format on
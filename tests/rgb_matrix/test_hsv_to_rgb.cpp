@@ -0,0 +1,103 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+
+#include "benchmark_util.hpp"
+#include "test_common.hpp"
+
+extern "C" {
+#include "color.h"
+#include "led_tables.h"
+}
+
+/* How hsv_to_rgb() worked out colours, with a division and five multiplies. */
+static rgb_t reference_hsv_to_rgb(hsv_t hsv) {
+    rgb_t    rgb;
+    uint8_t  region, remainder, p, q, t;
+    uint16_t h = hsv.h, s = hsv.s, v = hsv.v;
+
+#ifdef USE_CIE1931_CURVE
+    v = CIE1931_CURVE[hsv.v];
+#endif
+    if (s == 0) {
+        return {(uint8_t)v, (uint8_t)v, (uint8_t)v};
+    }
+
+    region    = h * 6 / 255;
+    remainder = (h * 2 - region * 85) * 3;
+
+    p = (v * (255 - s)) >> 8;
+    q = (v * (255 - ((s * remainder) >> 8))) >> 8;
+    t = (v * (255 - ((s * (255 - remainder)) >> 8))) >> 8;
+
+    switch (region) {
+        case 6:
+        case 0:
+            rgb = {(uint8_t)v, t, p};
+            break;
+        case 1:
+            rgb = {q, (uint8_t)v, p};
+            break;
+        case 2:
+            rgb = {p, (uint8_t)v, t};
+            break;
+        case 3:
+            rgb = {p, q, (uint8_t)v};
+            break;
+        case 4:
+            rgb = {t, p, (uint8_t)v};
+            break;
+        default:
+            rgb = {(uint8_t)v, p, q};
+            break;
+    }
+    return rgb;
+}
+
+class HsvToRgb : public TestFixture {};
+
+/* Every hue and saturation, for every value, in runs of 7 one colour at a time and in runs of 255 eight at a time where the host can. */
+TEST_F(HsvToRgb, array_matches_one_at_a_time_for_every_colour) {
+    using clock = std::chrono::steady_clock;
+
+    static hsv_t hsv[256 * 256];
+    static rgb_t rgb[256 * 256];
+    static rgb_t single[256 * 256];
+
+    clock::duration array_time  = clock::duration::zero();
+    clock::duration single_time = clock::duration::zero();
+
+    for (uint16_t v = 0; v < 256; v++) {
+        for (uint32_t i = 0; i < 256 * 256; i++) {
+            hsv[i] = {(uint8_t)(i >> 8), (uint8_t)i, (uint8_t)v};
+        }
+
+        for (uint8_t run : {7, 255}) {
+            auto start = clock::now();
+            for (uint32_t i = 0; i < 256 * 256; i += run) {
+                hsv_to_rgb_array(&hsv[i], &rgb[i], std::min<uint32_t>(run, 256 * 256 - i));
+            }
+            if (run == 255) array_time += clock::now() - start;
+
+            for (uint32_t i = 0; i < 256 * 256; i++) {
+                rgb_t expected = reference_hsv_to_rgb(hsv[i]);
+                ASSERT_TRUE(rgb[i].r == expected.r && rgb[i].g == expected.g && rgb[i].b == expected.b) << "hsv " << +hsv[i].h << ", " << +hsv[i].s << ", " << +hsv[i].v << " in runs of " << +run;
+            }
+        }
+
+        auto start = clock::now();
+        for (uint32_t i = 0; i < 256 * 256; i++) {
+            single[i] = hsv_to_rgb(hsv[i]);
+        }
+        single_time += clock::now() - start;
+
+        for (uint32_t i = 0; i < 256 * 256; i++) {
+            ASSERT_TRUE(single[i].r == rgb[i].r && single[i].g == rgb[i].g && single[i].b == rgb[i].b) << "hsv " << +hsv[i].h << ", " << +hsv[i].s << ", " << +hsv[i].v;
+        }
+    }
+
+    /* Host times are only comparable between runs on the same machine. */
+    double colours = 256.0 * 256 * 256;
+    report_benchmark("hsv_to_rgb", {{"single", std::chrono::duration<double, std::nano>(single_time).count() / colours, "ns/colour"}, {"array", std::chrono::duration<double, std::nano>(array_time).count() / colours, "ns/colour"}});
+}
@@ -0,0 +1,202 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <string>
+
+#include "benchmark_util.hpp"
+#include "test_common.hpp"
+#include "test_rgb_matrix_driver.h"
+
+extern "C" {
+#include "rgb_matrix.h"
+#include "lib/lib8tion/lib8tion.h"
+
+void advance_time(uint32_t ms);
+}
+
+using testing::_;
+
+// Frames rendered per effect, 16 seconds at the default flush limit
+#define EFFECT_FRAMES 1000
+// A key is tapped every this many frames, for the reactive and framebuffer effects
+#define EFFECT_TAP_INTERVAL 8
+
+// Render slices needed to cover every LED
+#define RGB_MATRIX_SLICES ((RGB_MATRIX_LED_COUNT + RGB_MATRIX_LED_PROCESS_LIMIT - 1) / RGB_MATRIX_LED_PROCESS_LIMIT)
+
+static const char *const effect_names[] = {
+    "NONE",
+#define RGB_MATRIX_EFFECT(name, ...) #name,
+#include "rgb_matrix_effects.inc"
+#undef RGB_MATRIX_EFFECT
+};
+
+/*
+ * FNV-1a of the LEDs after each of EFFECT_FRAMES frames rendered on the 128 LED test
+ * layout from the default settings. A change here means the effect looks different.
+ */
+// clang-format off
+static const std::map<std::string, uint32_t> golden_checksums = {
+    {"SOLID_COLOR",               0xf11691c5},
+    {"ALPHAS_MODS",               0x29941745},
+    {"GRADIENT_UP_DOWN",          0x2b8f42c5},
+    {"GRADIENT_LEFT_RIGHT",       0x11c08ec5},
+    {"BREATHING",                 0xdca817c5},
+    {"BAND_SAT",                  0xa18e3ec5},
+    {"BAND_VAL",                  0xc257b105},
+    {"BAND_PINWHEEL_SAT",         0xd7528a45},
+    {"BAND_PINWHEEL_VAL",         0xb72e4ec8},
+    {"BAND_SPIRAL_SAT",           0x0189a54d},
+    {"BAND_SPIRAL_VAL",           0x114a0a56},
+    {"CYCLE_ALL",                 0xd77db2c5},
+    {"CYCLE_LEFT_RIGHT",          0x714ceb15},
+    {"CYCLE_UP_DOWN",             0xe8d1a605},
+    {"RAINBOW_MOVING_CHEVRON",    0xc7389323},
+    {"CYCLE_OUT_IN",              0x590fb33b},
+    {"CYCLE_OUT_IN_DUAL",         0x030fc861},
+    {"CYCLE_PINWHEEL",            0x9119e0fb},
+    {"CYCLE_SPIRAL",              0xc79d619b},
+    {"DUAL_BEACON",               0xa68d5029},
+    {"RAINBOW_BEACON",            0xca153109},
+    {"RAINBOW_PINWHEELS",         0x07accbe9},
+    {"FLOWER_BLOOMING",           0x36f2be67},
+    {"RAINDROPS",                 0x25a0d911},
+    {"JELLYBEAN_RAINDROPS",       0x3b84e698},
+    {"HUE_BREATHING",             0xd24bfdc5},
+    {"HUE_PENDULUM",              0x61948b65},
+    {"HUE_WAVE",                  0x46613165},
+    {"PIXEL_RAIN",                0x42367650},
+    {"PIXEL_FLOW",                0xd0dff800},
+    {"PIXEL_FRACTAL",             0xb5311dd7},
+    {"TYPING_HEATMAP",            0x05a60b65},
+    {"DIGITAL_RAIN",              0x31be4eac},
+    {"SOLID_REACTIVE_SIMPLE",     0x17a45c53},
+    {"SOLID_REACTIVE",            0x0773b76d},
+    {"SOLID_REACTIVE_WIDE",       0x5ab67615},
+    {"SOLID_REACTIVE_MULTIWIDE",  0x3efb84b4},
+    {"SOLID_REACTIVE_CROSS",      0xdf18b442},
+    {"SOLID_REACTIVE_MULTICROSS", 0x78fbcc0d},
+    {"SOLID_REACTIVE_NEXUS",      0x2a4cbcea},
+    {"SOLID_REACTIVE_MULTINEXUS", 0x0b197d36},
+    {"SPLASH",                    0x46320253},
+    {"MULTISPLASH",               0x4108a829},
+    {"SOLID_SPLASH",              0x3b8aab38},
+    {"SOLID_MULTISPLASH",         0x99b68f8e},
+    {"STARLIGHT_SMOOTH",          0x124c4cd7},
+    {"STARLIGHT",                 0x45cfa557},
+    {"STARLIGHT_DUAL_SAT",        0x56a323e5},
+    {"STARLIGHT_DUAL_HUE",        0x60151d5a},
+    {"RIVERFLOW",                 0x51bf0ad3},
+};
+// clang-format on
+
+static uint32_t render_slices;
+static uint32_t frame_checksum;
+
+/* Called once per render slice of a frame. */
+extern "C" bool rgb_matrix_indicators_advanced_user(uint8_t led_min, uint8_t led_max) {
+    render_slices++;
+    return true;
+}
+
+/* Folds what the LEDs show into the checksum, whether or not the frame was flushed. */
+static void checksum_frame(void) {
+    const uint8_t *bytes = reinterpret_cast<const uint8_t *>(rgb_matrix_test_get_frame());
+    for (size_t i = 0; i < RGB_MATRIX_LED_COUNT * sizeof(rgb_t); i++) {
+        frame_checksum = (frame_checksum ^ bytes[i]) * 16777619;
+    }
+}
+
+class RgbMatrixEffect : public TestFixture, public testing::WithParamInterface<int> {
+   public:
+    using clock = std::chrono::steady_clock;
+
+    clock::duration frame_time = clock::duration::zero();
+    clock::duration slice_time = clock::duration::zero();
+    uint32_t        slices     = 0;
+    uint32_t        max_slices = 0;
+
+    rgb_matrix_flush_stats_t flush_stats;
+
+    void SetUp() override {
+        /* Every effect starts from the same state, whichever ran before it. */
+        rgb_matrix_init();
+        eeconfig_update_rgb_matrix_default();
+        memset(g_rgb_frame_buffer, 0, sizeof(g_rgb_frame_buffer));
+        random16_set_seed(1337);
+        srand(1);
+        render_slices  = 0;
+        frame_checksum = 2166136261;
+        flush_stats    = rgb_matrix_get_flush_stats();
+        rgb_matrix_mode_noeeprom(GetParam());
+    }
+
+    /* Runs rgb_matrix_task() from the start of the next frame until it is done, flushed or not. */
+    void render_frame() {
+        advance_time(RGB_MATRIX_LED_FLUSH_LIMIT);
+
+        uint32_t frames = rgb_matrix_get_flush_stats().frames;
+        uint32_t first  = render_slices;
+        for (uint32_t calls = 0; rgb_matrix_get_flush_stats().frames == frames; calls++) {
+            ASSERT_LT(calls, RGB_MATRIX_SLICES + 8) << "frame was never finished";
+            uint32_t before = render_slices;
+            auto     start  = clock::now();
+            rgb_matrix_task();
+            auto elapsed = clock::now() - start;
+
+            frame_time += elapsed;
+            if (render_slices != before) {
+                slice_time += elapsed;
+            }
+        }
+
+        uint32_t frame_slices = render_slices - first;
+        max_slices            = std::max(max_slices, frame_slices);
+        slices += frame_slices;
+    }
+};
+
+TEST_P(RgbMatrixEffect, renders_within_budget) {
+    TestDriver  driver;
+    const char *name = effect_names[GetParam()];
+    EXPECT_NO_REPORT(driver);
+
+    for (uint32_t frame = 0; frame < EFFECT_FRAMES; frame++) {
+        if (frame % EFFECT_TAP_INTERVAL == 0) {
+            uint8_t key = (frame / EFFECT_TAP_INTERVAL * 7) % (MATRIX_ROWS * MATRIX_COLS);
+            rgb_matrix_handle_key_event(key / MATRIX_COLS, key % MATRIX_COLS, true);
+            rgb_matrix_handle_key_event(key / MATRIX_COLS, key % MATRIX_COLS, false);
+        }
+        render_frame();
+        if (HasFatalFailure()) return;
+        checksum_frame();
+    }
+
+    /* Host times are only comparable between effects, and between runs on the same machine. */
+    double us_per_frame     = std::chrono::duration<double, std::micro>(frame_time).count() / EFFECT_FRAMES;
+    double us_per_slice     = std::chrono::duration<double, std::micro>(slice_time).count() / std::max<uint32_t>(slices, 1);
+    double slices_per_frame = (double)slices / EFFECT_FRAMES;
+    auto   stats            = rgb_matrix_get_flush_stats();
+    double leds_per_frame   = (double)(stats.leds - flush_stats.leds) / EFFECT_FRAMES;
+    char rendered[11];
+    std::snprintf(rendered, sizeof(rendered), "0x%08x", frame_checksum);
+    report_benchmark(name, {{"leds", RGB_MATRIX_LED_COUNT}, {"frame", us_per_frame, "us"}, {"slice", us_per_slice, "us"}, {"slices/frame", slices_per_frame}, {"max-slices", max_slices}, {"LEDs-flushed/frame", leds_per_frame}, {"skipped", stats.skipped - flush_stats.skipped}, {"partial", stats.partial - flush_stats.partial}, {"checksum", rendered}});
+
+    /* A frame spread over more slices than there are LEDs to cover is late for its flush. */
+    EXPECT_LE(max_slices, RGB_MATRIX_SLICES);
+
+    auto golden = golden_checksums.find(name);
+    if (golden == golden_checksums.end()) {
+        ADD_FAILURE() << "No golden checksum for " << name << ", rendered " << rendered;
+    } else {
+        EXPECT_EQ(frame_checksum, golden->second) << name << " renders differently, rendered " << rendered;
+    }
+    VERIFY_AND_CLEAR(driver);
+}
+
+INSTANTIATE_TEST_CASE_P(Effects, RgbMatrixEffect, testing::Range<int>(1, RGB_MATRIX_EFFECT_MAX), [](const testing::TestParamInfo<int> &info) { return std::string(effect_names[info.param]); });
@@ -0,0 +1,128 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_common.hpp"
+#include "test_rgb_matrix_driver.h"
+
+extern "C" {
+#include "rgb_matrix.h"
+
+void advance_time(uint32_t ms);
+}
+
+static bool indicator_on = false;
+static bool reverse_leds = false;
+
+extern "C" bool rgb_matrix_indicators_user(void) {
+    if (indicator_on) {
+        rgb_matrix_set_color(42, RGB_BLUE);
+    }
+    return true;
+}
+
+/* Wires the LEDs to the driver back to front, as a keyboard might. */
+extern "C" int rgb_matrix_led_index(int index) {
+    return reverse_leds ? RGB_MATRIX_LED_COUNT - 1 - index : index;
+}
+
+class RgbMatrixFlush : public TestFixture {
+   public:
+    rgb_matrix_flush_stats_t start;
+    uint32_t                 start_flushes;
+
+    void SetUp() override {
+        indicator_on = false;
+        reverse_leds = false;
+        rgb_matrix_init();
+        eeconfig_update_rgb_matrix_default();
+        rgb_matrix_mode_noeeprom(RGB_MATRIX_SOLID_COLOR);
+        render_frames(2);
+        start         = rgb_matrix_get_flush_stats();
+        start_flushes = rgb_matrix_test_get_flush_count();
+    }
+
+    /* The effect tests share these hooks. */
+    void TearDown() override {
+        indicator_on = false;
+        reverse_leds = false;
+    }
+
+    void render_frames(uint32_t count) {
+        for (uint32_t i = 0; i < count; i++) {
+            advance_time(RGB_MATRIX_LED_FLUSH_LIMIT);
+            uint32_t frames = rgb_matrix_get_flush_stats().frames;
+            while (rgb_matrix_get_flush_stats().frames == frames) {
+                rgb_matrix_task();
+            }
+        }
+    }
+
+    uint32_t flushes() {
+        return rgb_matrix_test_get_flush_count() - start_flushes;
+    }
+
+    static void expect_frame(rgb_t color, int except = -1, rgb_t other = {0, 0, 0}) {
+        const rgb_t *frame = rgb_matrix_test_get_frame();
+        for (int i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+            rgb_t expected = i == except ? other : color;
+            EXPECT_EQ(frame[i].r, expected.r) << "LED " << i;
+            EXPECT_EQ(frame[i].g, expected.g) << "LED " << i;
+            EXPECT_EQ(frame[i].b, expected.b) << "LED " << i;
+        }
+    }
+};
+
+TEST_F(RgbMatrixFlush, static_effect_is_not_flushed_again) {
+    render_frames(100);
+
+    auto stats = rgb_matrix_get_flush_stats();
+    EXPECT_EQ(stats.frames - start.frames, 100);
+    EXPECT_EQ(stats.skipped - start.skipped, 100);
+    EXPECT_EQ(stats.leds - start.leds, 0);
+    EXPECT_EQ(flushes(), 0);
+    expect_frame(hsv_to_rgb(rgb_matrix_get_hsv()));
+}
+
+TEST_F(RgbMatrixFlush, only_changed_led_is_flushed) {
+    rgb_t solid = hsv_to_rgb(rgb_matrix_get_hsv());
+
+    /* Turning the indicator on and off flushes its LED alone, once each. */
+    indicator_on = true;
+    render_frames(10);
+    expect_frame(solid, 42, {RGB_BLUE});
+    indicator_on = false;
+    render_frames(10);
+    expect_frame(solid);
+
+    auto stats = rgb_matrix_get_flush_stats();
+    EXPECT_EQ(flushes(), 2);
+    EXPECT_EQ(stats.partial - start.partial, 2);
+    EXPECT_EQ(stats.skipped - start.skipped, 18);
+    EXPECT_EQ(stats.leds - start.leds, 2);
+}
+
+TEST_F(RgbMatrixFlush, changed_colour_flushes_every_led) {
+    rgb_matrix_sethsv_noeeprom(HSV_BLUE);
+    render_frames(10);
+    expect_frame(hsv_to_rgb(rgb_matrix_get_hsv()));
+
+    auto stats = rgb_matrix_get_flush_stats();
+    EXPECT_EQ(flushes(), 1);
+    EXPECT_EQ(stats.partial - start.partial, 0);
+    EXPECT_EQ(stats.skipped - start.skipped, 9);
+    EXPECT_EQ(stats.leds - start.leds, RGB_MATRIX_LED_COUNT);
+}
+
+TEST_F(RgbMatrixFlush, remapped_leds_are_flushed_where_the_driver_has_them) {
+    rgb_t solid  = hsv_to_rgb(rgb_matrix_get_hsv());
+    reverse_leds = true;
+
+    indicator_on = true;
+    render_frames(1);
+    expect_frame(solid, RGB_MATRIX_LED_COUNT - 1 - 42, {RGB_BLUE});
+
+    auto stats = rgb_matrix_get_flush_stats();
+    EXPECT_EQ(flushes(), 1);
+    EXPECT_EQ(stats.partial - start.partial, 1);
+    EXPECT_EQ(stats.leds - start.leds, 1);
+}
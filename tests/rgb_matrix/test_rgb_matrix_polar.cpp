@@ -0,0 +1,22 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "rgb_matrix.h"
+#include "lib/lib8tion/lib8tion.h"
+
+extern const led_point_t k_rgb_matrix_center;
+}
+
+class RgbMatrixPolar : public TestFixture {};
+
+TEST_F(RgbMatrixPolar, tables_match_geometry) {
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        int16_t dx = g_led_config.point[i].x - k_rgb_matrix_center.x;
+        int16_t dy = g_led_config.point[i].y - k_rgb_matrix_center.y;
+        EXPECT_EQ(g_led_polar.dist[i], sqrt16(dx * dx + dy * dy)) << "LED " << +i;
+        EXPECT_EQ(g_led_polar.angle[i], atan2_8(dy, dx)) << "LED " << +i;
+    }
+}
@@ -0,0 +1,105 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <cstring>
+
+#include "benchmark_util.hpp"
+#include "test_common.hpp"
+
+extern "C" {
+#include "rgb_matrix.h"
+#include "lib/lib8tion/lib8tion.h"
+
+void process_rgb_matrix_typing_heatmap(uint8_t row, uint8_t col);
+}
+
+#ifndef RGB_MATRIX_TYPING_HEATMAP_NEIGHBOURS
+#    error "The typing heatmap should use the keys listed in rgb_matrix_neighbours.c"
+#endif
+
+#define HEATMAP_KEYPRESSES 4000
+
+static uint8_t reference_buffer[MATRIX_ROWS][MATRIX_COLS];
+
+/* What process_rgb_matrix_typing_heatmap() does without the neighbour list, measuring every key. */
+static void reference_typing_heatmap(uint8_t row, uint8_t col) {
+    if (g_led_config.matrix_co[row][col] == NO_LED) {
+        return;
+    }
+    led_point_t pressed = g_led_config.point[g_led_config.matrix_co[row][col]];
+    for (uint8_t i_row = 0; i_row < MATRIX_ROWS; i_row++) {
+        for (uint8_t i_col = 0; i_col < MATRIX_COLS; i_col++) {
+            if (g_led_config.matrix_co[i_row][i_col] == NO_LED) {
+                continue;
+            }
+            if (i_row == row && i_col == col) {
+                reference_buffer[row][col] = qadd8(reference_buffer[row][col], RGB_MATRIX_TYPING_HEATMAP_INCREASE_STEP);
+                continue;
+            }
+            led_point_t other    = g_led_config.point[g_led_config.matrix_co[i_row][i_col]];
+            int16_t     dx       = pressed.x - other.x;
+            int16_t     dy       = pressed.y - other.y;
+            uint8_t     distance = sqrt16(dx * dx + dy * dy);
+            if (distance <= RGB_MATRIX_TYPING_HEATMAP_SPREAD) {
+                uint8_t amount = qsub8(RGB_MATRIX_TYPING_HEATMAP_SPREAD, distance);
+                if (amount > RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT) {
+                    amount = RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT;
+                }
+                reference_buffer[i_row][i_col] = qadd8(reference_buffer[i_row][i_col], amount);
+            }
+        }
+    }
+}
+
+class RgbMatrixTypingHeatmap : public TestFixture {
+   public:
+    void SetUp() override {
+        memset(g_rgb_frame_buffer, 0, sizeof(g_rgb_frame_buffer));
+        memset(reference_buffer, 0, sizeof(reference_buffer));
+    }
+
+    /* Lets the heat fade between presses, so the keys do not all end up at 255. */
+    static void cool_down(uint8_t buffer[MATRIX_ROWS][MATRIX_COLS]) {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                buffer[row][col] = qsub8(buffer[row][col], 5);
+            }
+        }
+    }
+};
+
+TEST_F(RgbMatrixTypingHeatmap, neighbours_heat_up_like_every_key_measured) {
+    using clock = std::chrono::steady_clock;
+
+    clock::duration neighbours_time = clock::duration::zero();
+    clock::duration reference_time  = clock::duration::zero();
+
+    random16_set_seed(1337);
+    for (uint32_t i = 0; i < HEATMAP_KEYPRESSES; i++) {
+        /* Keep typing around the same keys for a while, so some saturate. */
+        uint8_t key = (i / 8 * 3 + random8_max(3)) % (MATRIX_ROWS * MATRIX_COLS);
+        uint8_t row = key / MATRIX_COLS;
+        uint8_t col = key % MATRIX_COLS;
+
+        auto start = clock::now();
+        process_rgb_matrix_typing_heatmap(row, col);
+        neighbours_time += clock::now() - start;
+
+        start = clock::now();
+        reference_typing_heatmap(row, col);
+        reference_time += clock::now() - start;
+
+        ASSERT_EQ(memcmp(g_rgb_frame_buffer, reference_buffer, sizeof(reference_buffer)), 0) << "Frame buffer differs after pressing " << +row << ", " << +col;
+
+        if (i % 4 == 3) {
+            cool_down(g_rgb_frame_buffer);
+            cool_down(reference_buffer);
+        }
+    }
+
+    /* Host times are only comparable between runs on the same machine. */
+    double ns_neighbours = std::chrono::duration<double, std::nano>(neighbours_time).count() / HEATMAP_KEYPRESSES;
+    double ns_reference  = std::chrono::duration<double, std::nano>(reference_time).count() / HEATMAP_KEYPRESSES;
+    report_benchmark("TYPING_HEATMAP keypress", {{"neighbours", ns_neighbours, "ns"}, {"every-key", ns_reference, "ns"}, {"listed", pgm_read_word(&g_typing_heatmap_neighbours_start[MATRIX_ROWS * MATRIX_COLS])}});
+}
@@ -0,0 +1,60 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_benchmark.hpp"
+
+class ScanLatencyAutocorrect : public BenchmarkFixture {
+   public:
+    void SetUp() override {
+        autocorrect_enable();
+    }
+};
+
+TEST_F(ScanLatencyAutocorrect, words_without_typos) {
+    KeymapKey key_t(0, 0, 0, KC_T);
+    KeymapKey key_h(0, 1, 0, KC_H);
+    KeymapKey key_e(0, 2, 0, KC_E);
+    KeymapKey key_i(0, 3, 0, KC_I);
+    KeymapKey key_r(0, 4, 0, KC_R);
+    KeymapKey key_space(0, 5, 0, KC_SPACE);
+    set_keymap({key_t, key_h, key_e, key_i, key_r, key_space});
+
+    /* "their " */
+    std::vector<BenchmarkEvent> script;
+    for (auto key : {key_t, key_h, key_e, key_i, key_r, key_space}) {
+        tap(script, key, 30, 40);
+    }
+
+    auto result = replay("autocorrect_clean", script);
+    report(result);
+
+    EXPECT_EQ(result.unanswered, 0);
+    EXPECT_EQ(result.latency_p99_ms, 0);
+    EXPECT_DOUBLE_EQ(result.reports_per_keystroke, 2.0);
+}
+
+TEST_F(ScanLatencyAutocorrect, words_with_typos) {
+    KeymapKey key_t(0, 0, 0, KC_T);
+    KeymapKey key_h(0, 1, 0, KC_H);
+    KeymapKey key_e(0, 2, 0, KC_E);
+    KeymapKey key_i(0, 3, 0, KC_I);
+    KeymapKey key_r(0, 4, 0, KC_R);
+    KeymapKey key_space(0, 5, 0, KC_SPACE);
+    set_keymap({key_t, key_h, key_e, key_i, key_r, key_space});
+
+    /* "thier " is corrected to "their " by the default dictionary. The release of the
+     * key that triggers the correction sends nothing, so it waits for the next key. */
+    std::vector<BenchmarkEvent> script;
+    for (auto key : {key_t, key_h, key_i, key_e, key_r, key_space}) {
+        tap(script, key, 30, 40);
+    }
+
+    auto result = replay("autocorrect_typo", script);
+    report(result);
+
+    EXPECT_EQ(result.unanswered, 0);
+    EXPECT_EQ(result.latency_p50_ms, 0);
+    EXPECT_GT(result.reports_per_keystroke, 2.0);
+}
@@ -0,0 +1,17 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "quantum.h"
+
+enum combos { jk_escape, df_tab, sdf_enter };
+
+uint16_t const jk_escape_combo[] = {KC_J, KC_K, COMBO_END};
+uint16_t const df_tab_combo[]    = {KC_D, KC_F, COMBO_END};
+uint16_t const sdf_enter_combo[] = {KC_S, KC_D, KC_F, COMBO_END};
+
+// clang-format off
+combo_t key_combos[] = {
+    [jk_escape] = COMBO(jk_escape_combo, KC_ESCAPE),
+    [df_tab]    = COMBO(df_tab_combo, KC_TAB),
+    [sdf_enter] = COMBO(sdf_enter_combo, KC_ENTER)
+};
+// clang-format on
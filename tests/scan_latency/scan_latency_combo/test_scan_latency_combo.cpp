@@ -0,0 +1,57 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_benchmark.hpp"
+
+class ScanLatencyCombo : public BenchmarkFixture {};
+
+TEST_F(ScanLatencyCombo, combo_keys_typed_without_chording) {
+    KeymapKey key_s(0, 1, 0, KC_S);
+    KeymapKey key_d(0, 2, 0, KC_D);
+    KeymapKey key_f(0, 3, 0, KC_F);
+    KeymapKey key_j(0, 4, 0, KC_J);
+    KeymapKey key_k(0, 5, 0, KC_K);
+    set_keymap({key_s, key_d, key_f, key_j, key_k});
+
+    /* Every key is part of a combo, so each press waits for the combo term to expire. */
+    std::vector<BenchmarkEvent> script;
+    for (auto key : {key_s, key_d, key_f, key_j, key_k}) {
+        tap(script, key, COMBO_TERM + 20, 40);
+    }
+
+    auto result = replay("combo_keys_typed", script);
+    report(result);
+
+    EXPECT_EQ(result.unanswered, 0);
+    EXPECT_LE(result.latency_p99_ms, COMBO_TERM + 1);
+    EXPECT_DOUBLE_EQ(result.reports_per_keystroke, 2.0);
+}
+
+TEST_F(ScanLatencyCombo, combos_chorded) {
+    KeymapKey key_s(0, 1, 0, KC_S);
+    KeymapKey key_d(0, 2, 0, KC_D);
+    KeymapKey key_f(0, 3, 0, KC_F);
+    KeymapKey key_j(0, 4, 0, KC_J);
+    KeymapKey key_k(0, 5, 0, KC_K);
+    set_keymap({key_s, key_d, key_f, key_j, key_k});
+
+    std::vector<BenchmarkEvent> script;
+    press(script, key_j, 5);
+    press(script, key_k, 30);
+    release(script, key_j);
+    release(script, key_k, 40);
+    press(script, key_s, 5);
+    press(script, key_d, 5);
+    press(script, key_f, 30);
+    release(script, key_s);
+    release(script, key_d);
+    release(script, key_f, 40);
+
+    auto result = replay("combos_chorded", script);
+    report(result);
+
+    EXPECT_EQ(result.unanswered, 0);
+    EXPECT_LE(result.latency_p99_ms, COMBO_TERM);
+}
@@ -0,0 +1,13 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "quantum.h"
+
+const key_override_t shift_backspace_override = ko_make_basic(MOD_MASK_SHIFT, KC_BACKSPACE, KC_DELETE);
+const key_override_t shift_escape_override    = ko_make_basic(MOD_MASK_SHIFT, KC_ESCAPE, KC_GRAVE);
+
+// clang-format off
+const key_override_t *key_overrides[] = {
+    &shift_backspace_override,
+    &shift_escape_override
+};
+// clang-format on
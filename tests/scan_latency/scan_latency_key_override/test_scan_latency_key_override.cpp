@@ -0,0 +1,46 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_benchmark.hpp"
+
+class ScanLatencyKeyOverride : public BenchmarkFixture {};
+
+TEST_F(ScanLatencyKeyOverride, trigger_keys_without_mods) {
+    KeymapKey key_backspace(0, 0, 0, KC_BACKSPACE);
+    KeymapKey key_escape(0, 1, 0, KC_ESCAPE);
+    KeymapKey key_a(0, 2, 0, KC_A);
+    set_keymap({key_backspace, key_escape, key_a});
+
+    std::vector<BenchmarkEvent> script;
+    for (auto key : {key_a, key_backspace, key_a, key_escape}) {
+        tap(script, key, 40, 60);
+    }
+
+    auto result = replay("override_idle", script);
+    report(result);
+
+    EXPECT_EQ(result.unanswered, 0);
+    EXPECT_EQ(result.latency_p99_ms, 0);
+    EXPECT_DOUBLE_EQ(result.reports_per_keystroke, 2.0);
+}
+
+TEST_F(ScanLatencyKeyOverride, overrides_activated) {
+    KeymapKey key_shift(0, 0, 1, KC_LEFT_SHIFT);
+    KeymapKey key_backspace(0, 0, 0, KC_BACKSPACE);
+    KeymapKey key_escape(0, 1, 0, KC_ESCAPE);
+    set_keymap({key_shift, key_backspace, key_escape});
+
+    std::vector<BenchmarkEvent> script;
+    press(script, key_shift, 30);
+    tap(script, key_backspace, 40, 30);
+    tap(script, key_escape, 40, 30);
+    release(script, key_shift, 60);
+
+    auto result = replay("override_active", script);
+    report(result);
+
+    EXPECT_EQ(result.unanswered, 0);
+    EXPECT_EQ(result.latency_p99_ms, 0);
+}
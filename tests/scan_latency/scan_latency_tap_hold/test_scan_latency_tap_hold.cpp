@@ -0,0 +1,72 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_benchmark.hpp"
+
+class ScanLatencyTapHold : public BenchmarkFixture {};
+
+TEST_F(ScanLatencyTapHold, mod_tap_keys_tapped) {
+    KeymapKey key_a(0, 0, 0, LGUI_T(KC_A));
+    KeymapKey key_s(0, 1, 0, LALT_T(KC_S));
+    KeymapKey key_d(0, 2, 0, LCTL_T(KC_D));
+    KeymapKey key_f(0, 3, 0, LSFT_T(KC_F));
+    set_keymap({key_a, key_s, key_d, key_f});
+
+    std::vector<BenchmarkEvent> script;
+    for (auto key : {key_a, key_s, key_d, key_f}) {
+        tap(script, key, 40, 60);
+    }
+
+    auto result = replay("mod_tap_tapped", script);
+    report(result);
+
+    /* A tap is only resolved on release, so presses wait for the hold time. */
+    EXPECT_EQ(result.unanswered, 0);
+    EXPECT_LE(result.latency_p99_ms, 40);
+    EXPECT_DOUBLE_EQ(result.reports_per_keystroke, 2.0);
+}
+
+TEST_F(ScanLatencyTapHold, mod_tap_keys_rolled) {
+    KeymapKey key_a(0, 0, 0, LGUI_T(KC_A));
+    KeymapKey key_s(0, 1, 0, LALT_T(KC_S));
+    KeymapKey key_d(0, 2, 0, LCTL_T(KC_D));
+    KeymapKey key_f(0, 3, 0, LSFT_T(KC_F));
+    set_keymap({key_a, key_s, key_d, key_f});
+
+    /* Overlapping taps well inside the tapping term, as in fast home row mod typing. */
+    std::vector<BenchmarkEvent> script;
+    press(script, key_a, 20);
+    press(script, key_s, 20);
+    release(script, key_a, 20);
+    press(script, key_d, 20);
+    release(script, key_s, 20);
+    press(script, key_f, 20);
+    release(script, key_d, 20);
+    release(script, key_f, 20);
+
+    auto result = replay("mod_tap_rolled", script);
+    report(result);
+
+    EXPECT_EQ(result.unanswered, 0);
+    EXPECT_LT(result.latency_p99_ms, TAPPING_TERM);
+}
+
+TEST_F(ScanLatencyTapHold, mod_tap_key_held) {
+    KeymapKey key_f(0, 3, 0, LSFT_T(KC_F));
+    KeymapKey key_j(0, 4, 0, KC_J);
+    set_keymap({key_f, key_j});
+
+    /* Shift is held past the tapping term and then used, as in capitalising a word. */
+    std::vector<BenchmarkEvent> script;
+    press(script, key_f, TAPPING_TERM + 10);
+    tap(script, key_j, 30, 30);
+    release(script, key_f, 30);
+
+    auto result = replay("mod_tap_held", script);
+    report(result);
+
+    EXPECT_EQ(result.unanswered, 0);
+    EXPECT_LE(result.latency_max_ms, TAPPING_TERM);
+}
@@ -0,0 +1,54 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_benchmark.hpp"
+
+class ScanLatency : public BenchmarkFixture {};
+
+TEST_F(ScanLatency, plain_keys_typed) {
+    KeymapKey key_a(0, 0, 0, KC_A);
+    KeymapKey key_s(0, 1, 0, KC_S);
+    KeymapKey key_d(0, 2, 0, KC_D);
+    KeymapKey key_f(0, 3, 0, KC_F);
+    set_keymap({key_a, key_s, key_d, key_f});
+
+    std::vector<BenchmarkEvent> script;
+    for (auto key : {key_a, key_s, key_d, key_f}) {
+        tap(script, key, 40, 60);
+    }
+
+    auto result = replay("plain_typed", script);
+    report(result);
+
+    EXPECT_EQ(result.unanswered, 0);
+    EXPECT_EQ(result.latency_p99_ms, 0);
+    EXPECT_DOUBLE_EQ(result.reports_per_keystroke, 2.0);
+}
+
+TEST_F(ScanLatency, plain_keys_rolled) {
+    KeymapKey key_a(0, 0, 0, KC_A);
+    KeymapKey key_s(0, 1, 0, KC_S);
+    KeymapKey key_d(0, 2, 0, KC_D);
+    KeymapKey key_f(0, 3, 0, KC_F);
+    set_keymap({key_a, key_s, key_d, key_f});
+
+    /* Each key is pressed before the previous one is released, as in fast typing. */
+    std::vector<BenchmarkEvent> script;
+    press(script, key_a, 20);
+    press(script, key_s, 20);
+    release(script, key_a, 20);
+    press(script, key_d, 20);
+    release(script, key_s, 20);
+    press(script, key_f, 20);
+    release(script, key_d, 20);
+    release(script, key_f, 20);
+
+    auto result = replay("plain_rolled", script);
+    report(result);
+
+    EXPECT_EQ(result.unanswered, 0);
+    EXPECT_EQ(result.latency_p99_ms, 0);
+    EXPECT_DOUBLE_EQ(result.reports_per_keystroke, 2.0);
+}
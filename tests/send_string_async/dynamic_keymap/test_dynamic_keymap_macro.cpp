@@ -0,0 +1,50 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string>
+#include <vector>
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "dynamic_keymap.h"
+#include "send_string.h"
+}
+
+using testing::_;
+using testing::AnyNumber;
+using testing::Invoke;
+
+class DynamicKeymapMacroAsync : public TestFixture {
+   public:
+    void TearDown() override {
+        send_string_async_cancel();
+    }
+};
+
+TEST_F(DynamicKeymapMacroAsync, macros_past_a_full_queue_are_dropped) {
+    TestDriver  driver;
+    std::string typed;
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber()).WillRepeatedly(Invoke([&](report_keyboard_t &report) {
+        if (report.keys[0] != KC_NO) {
+            typed += 'a' + report.keys[0] - KC_A;
+        }
+    }));
+
+    dynamic_keymap_macro_reset();
+    uint8_t macros[] = "abc\0def\0ghi\0jkl\0mno\0pqr";
+    dynamic_keymap_macro_set_buffer(0, sizeof(macros), macros);
+
+    // The macros that do not fit are reported, rather than waited for
+    for (uint8_t id = 0; id < SEND_STRING_ASYNC_QUEUE_SIZE + 2; id++) {
+        EXPECT_EQ(dynamic_keymap_macro_send(id), id < SEND_STRING_ASYNC_QUEUE_SIZE) << "macro " << +id;
+    }
+    EXPECT_TRUE(typed.empty());
+
+    while (send_string_async_busy()) {
+        run_one_scan_loop();
+    }
+    EXPECT_EQ(typed, std::string("abcdefghijklmnopqr").substr(0, 3 * SEND_STRING_ASYNC_QUEUE_SIZE));
+    VERIFY_AND_CLEAR(driver);
+}
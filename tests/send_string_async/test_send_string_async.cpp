@@ -0,0 +1,267 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "benchmark_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "send_string.h"
+
+void advance_time(uint32_t ms);
+}
+
+using testing::_;
+using testing::AnyNumber;
+using testing::Invoke;
+
+class SendStringAsync : public TestFixture {
+   public:
+    std::vector<report_keyboard_t> reports;
+    std::vector<uint32_t>          report_times;
+
+    void SetUp() override {
+        reports.clear();
+        report_times.clear();
+    }
+
+    void TearDown() override {
+        send_string_async_cancel();
+    }
+
+    void capture_reports(TestDriver &driver) {
+        EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber()).WillRepeatedly(Invoke([this](report_keyboard_t &report) {
+            reports.push_back(report);
+            report_times.push_back(timer_read32());
+        }));
+    }
+
+    static bool has_key(const report_keyboard_t &report, uint8_t keycode) {
+        for (uint8_t key : report.keys) {
+            if (key == keycode) return true;
+        }
+        return false;
+    }
+
+    /* Text typed by the captured reports, decoded from the key presses and the shift state. */
+    std::string typed_text() {
+        std::map<std::pair<uint8_t, bool>, char> chars;
+        for (int c = 0x7E; c >= 0; c--) {
+            if (c != '\n' && c != '\t' && c < ' ') continue;
+            bool shifted = (ascii_to_shift_lut[c / 8] >> (c % 8)) & 1;
+            chars[{ascii_to_keycode_lut[c], shifted}] = c;
+        }
+
+        std::string       text;
+        report_keyboard_t previous = {};
+        for (auto &report : reports) {
+            for (uint8_t key : report.keys) {
+                if (key == KC_NO || has_key(previous, key)) continue;
+                auto it = chars.find({key, (report.mods & MOD_BIT(KC_LEFT_SHIFT)) != 0});
+                text += it != chars.end() ? it->second : '\x01';
+            }
+            previous = report;
+        }
+        return text;
+    }
+
+    /* Runs the main loop until the queue is empty, and returns how many milliseconds that took. */
+    uint32_t run_until_idle(uint32_t timeout_ms) {
+        uint32_t start = timer_read32();
+        while (send_string_async_busy() && timer_read32() - start < timeout_ms) {
+            run_one_scan_loop();
+        }
+        return timer_read32() - start;
+    }
+};
+
+/* Printable text mixing shifted and unshifted characters, with a line break every 64 characters. */
+static std::string sample_text(size_t length) {
+    std::string text;
+    uint32_t    rng = 1;
+    while (text.size() < length) {
+        rng = rng * 1664525 + 1013904223;
+        text += text.size() % 64 == 63 ? '\n' : (char)(' ' + (rng >> 8) % 95);
+    }
+    return text;
+}
+
+static char get_next_ram(void *arg) {
+    send_string_state_t *state = (send_string_state_t *)arg;
+    return *state->string++;
+}
+
+static int done_count = 0;
+
+static void count_done(void *cb_arg) {
+    done_count++;
+    *(int *)cb_arg = done_count;
+}
+
+TEST_F(SendStringAsync, types_string) {
+    TestDriver driver;
+    capture_reports(driver);
+
+    int                 done_order = 0;
+    send_string_state_t state      = {.string = "Hello, World!\n"};
+    done_count                     = 0;
+    EXPECT_TRUE(send_string_with_delay_impl_async(get_next_ram, &state, 0, count_done, &done_order));
+    EXPECT_TRUE(send_string_async_busy());
+
+    run_until_idle(1000);
+    EXPECT_FALSE(send_string_async_busy());
+    EXPECT_EQ(done_count, 1);
+    EXPECT_EQ(typed_text(), "Hello, World!\n");
+    // Every key and its shift are released at the end
+    EXPECT_EQ(reports.back().mods, 0);
+    EXPECT_FALSE(has_key(reports.back(), KC_ENTER));
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+TEST_F(SendStringAsync, keys_are_scanned_while_typing) {
+    TestDriver driver;
+    KeymapKey  key_f1(0, 0, 0, KC_F1);
+    set_keymap({key_f1});
+    capture_reports(driver);
+
+    std::string text = sample_text(1024);
+    EXPECT_TRUE(send_string_with_delay_async(text.c_str(), 0));
+
+    // Press a key while about half of the string is typed
+    idle_for(1000);
+    EXPECT_TRUE(send_string_async_busy());
+    size_t pressed_at = reports.size();
+    key_f1.press();
+    run_one_scan_loop();
+    run_one_scan_loop();
+    bool seen = false;
+    for (size_t i = pressed_at; i < reports.size(); i++) {
+        seen |= has_key(reports[i], KC_F1);
+    }
+    EXPECT_TRUE(seen);
+    EXPECT_TRUE(send_string_async_busy());
+    key_f1.release();
+
+    run_until_idle(10000);
+    EXPECT_FALSE(send_string_async_busy());
+    // F1 is not part of the text, and leaves one unknown character behind
+    std::string typed = typed_text();
+    typed.erase(typed.find('\x01'), 1);
+    EXPECT_EQ(typed, text);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+TEST_F(SendStringAsync, tap_and_delay) {
+    TestDriver driver;
+    capture_reports(driver);
+
+    EXPECT_TRUE(SEND_STRING_ASYNC("a" SS_DELAY(100) "b" SS_TAP(X_ENTER) SS_DOWN(X_LCTL) "c" SS_UP(X_LCTL)));
+    run_until_idle(1000);
+
+    EXPECT_EQ(typed_text(), "ab\nc");
+    // The release of a and the press of b are 100 ms apart
+    size_t release_a = 0, press_b = 0;
+    for (size_t i = 1; i < reports.size(); i++) {
+        if (has_key(reports[i - 1], KC_A) && !has_key(reports[i], KC_A)) release_a = i;
+        if (!has_key(reports[i - 1], KC_B) && has_key(reports[i], KC_B)) press_b = i;
+    }
+    EXPECT_GE(report_times[press_b] - report_times[release_a], 100);
+    for (auto &report : reports) {
+        if (has_key(report, KC_C)) EXPECT_EQ(report.mods, MOD_BIT(KC_LEFT_CTRL));
+    }
+    EXPECT_EQ(reports.back().mods, 0);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+static const char nvm_macros[] = "first\0second";
+
+/* Reads from a buffer by offset, as the dynamic keymap getter reads from NVM. */
+static char get_next_nvm(void *arg) {
+    send_string_state_t *state = (send_string_state_t *)arg;
+    return nvm_macros[state->offset++];
+}
+
+TEST_F(SendStringAsync, queued_strings_run_in_order) {
+    TestDriver driver;
+    capture_reports(driver);
+
+    int                 first_done = 0, second_done = 0;
+    send_string_state_t first  = {.offset = 0};
+    send_string_state_t second = {.offset = 6};
+    done_count                 = 0;
+    EXPECT_TRUE(send_string_with_delay_impl_async(get_next_nvm, &first, 0, count_done, &first_done));
+    EXPECT_TRUE(send_string_with_delay_impl_async(get_next_nvm, &second, 0, count_done, &second_done));
+    EXPECT_TRUE(send_string_async(" third"));
+    EXPECT_TRUE(send_string_async(""));
+    // The queue is full
+    EXPECT_FALSE(send_string_async("fifth"));
+
+    run_until_idle(1000);
+    EXPECT_EQ(typed_text(), "firstsecond third");
+    EXPECT_EQ(first_done, 1);
+    EXPECT_EQ(second_done, 2);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+TEST_F(SendStringAsync, cancel_releases_keys) {
+    TestDriver driver;
+    capture_reports(driver);
+
+    int                 done_order = 0;
+    send_string_state_t state      = {.string = "ABCDEFGH"};
+    done_count                     = 0;
+    EXPECT_TRUE(send_string_with_delay_impl_async(get_next_ram, &state, 0, count_done, &done_order));
+    EXPECT_TRUE(send_string_async("ignored"));
+
+    // Stop with shift held
+    while (reports.empty() || reports.back().mods == 0 || typed_text().size() < 3) {
+        run_one_scan_loop();
+    }
+    send_string_async_cancel();
+    EXPECT_FALSE(send_string_async_busy());
+    EXPECT_EQ(done_count, 1);
+
+    size_t count = reports.size();
+    idle_for(100);
+    EXPECT_EQ(reports.size(), count);
+    EXPECT_EQ(reports.back().mods, 0);
+    EXPECT_EQ(typed_text().substr(0, 3), "ABC");
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+/* Types 1 kB of text with and without the queue, and reports the longest the main loop stalls. */
+TEST_F(SendStringAsync, benchmark_main_loop_stall) {
+    TestDriver  driver;
+    std::string text = sample_text(1024);
+    capture_reports(driver);
+
+    uint32_t start = timer_read32();
+    send_string_with_delay(text.c_str(), 1);
+    uint32_t blocking_ms = timer_read32() - start;
+    EXPECT_EQ(typed_text(), text);
+    reports.clear();
+
+    EXPECT_TRUE(send_string_with_delay_async(text.c_str(), 1));
+    uint32_t async_ms = 0;
+    start             = timer_read32();
+    while (send_string_async_busy()) {
+        uint32_t before = timer_read32();
+        keyboard_task();
+        if (timer_read32() - before > async_ms) async_ms = timer_read32() - before;
+        advance_time(1);
+    }
+    uint32_t async_total = timer_read32() - start;
+    EXPECT_EQ(typed_text(), text);
+
+    report_benchmark("send_string", {{"longest-stall", blocking_ms, "ms"}, {"rate", text.size() * 1000.0 / blocking_ms, "chars/s"}});
+    report_benchmark("send_string_async", {{"longest-stall", async_ms, "ms"}, {"rate", text.size() * 1000.0 / async_total, "chars/s"}});
+
+    EXPECT_EQ(async_ms, 0);
+    EXPECT_GT(blocking_ms, 1000);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
@@ -0,0 +1,240 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstdlib>
+#include <functional>
+#include <vector>
+
+#include "benchmark_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "eeconfig.h"
+#include "eeprom.h"
+#include "slider.h"
+}
+
+using testing::_;
+
+static uint16_t             adc_value    = 0;
+static uint32_t             sample_count = 0;
+static std::vector<uint8_t> updates;
+
+extern "C" uint16_t slider_sample(uint8_t index) {
+    sample_count++;
+    return adc_value;
+}
+
+extern "C" bool slider_update_user(uint8_t index, uint8_t position) {
+    updates.push_back(position);
+    return true;
+}
+
+/* Ideal position of the slider for a raw ADC value, with the default calibration. */
+static uint8_t ideal_position(int32_t raw) {
+    return raw * SLIDER_RESOLUTION / (SLIDER_ADC_MAX + 1);
+}
+
+class Slider : public TestFixture {
+   public:
+    uint32_t rng = 1;
+
+    void SetUp() override {
+        eeconfig_update_slider_default();
+        adc_value = 0;
+        slider_init();
+        sample_count = 0;
+        updates.clear();
+    }
+
+    /* Triangular noise of up to +-6 ADC units, as read from a cheap potentiometer. */
+    int32_t noise() {
+        rng = rng * 1664525 + 1013904223;
+        int32_t a = (rng >> 8) % 7;
+        rng = rng * 1664525 + 1013904223;
+        int32_t b = (rng >> 8) % 7;
+        return a + b - 6;
+    }
+
+    static uint16_t clamp(int32_t raw) {
+        return raw < 0 ? 0 : raw > SLIDER_ADC_MAX ? SLIDER_ADC_MAX : raw;
+    }
+
+    /* Runs the keyboard for `ms` milliseconds, reading `trace(t)` plus noise from the ADC. */
+    void replay(uint32_t ms, std::function<int32_t(uint32_t)> trace) {
+        for (uint32_t t = 0; t < ms; t++) {
+            adc_value = clamp(trace(t) + noise());
+            run_one_scan_loop();
+        }
+    }
+};
+
+TEST_F(Slider, first_sample_sets_position_silently) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+
+    adc_value = 512;
+    slider_init();
+    EXPECT_EQ(slider_get_position(0), ideal_position(512));
+    replay(20, [](uint32_t) { return 512; });
+    EXPECT_NEAR(slider_get_position(0), ideal_position(512), 1);
+    EXPECT_NEAR(slider_get_value(0), 512, 6);
+    EXPECT_TRUE(updates.empty());
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(Slider, samples_at_interval) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+
+    idle_for(10);
+    sample_count = 0;
+    idle_for(1000);
+    EXPECT_EQ(sample_count, 1000 / SLIDER_SAMPLE_INTERVAL);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(Slider, resting_on_position_boundary_does_not_trigger) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+
+    /* Every raw value from 500 to 520 includes a position boundary, rest on each for 10 seconds. */
+    uint32_t false_triggers = 0;
+    for (int32_t raw = 500; raw <= 520; raw++) {
+        replay(100, [&](uint32_t) { return raw; });
+        updates.clear();
+        replay(10000, [&](uint32_t) { return raw; });
+        false_triggers += updates.size();
+    }
+    report_benchmark("slider_rest", {{"resting", "210", "s"}, {"noise", "+-6"}, {"false_triggers", false_triggers}});
+    EXPECT_EQ(false_triggers, 0);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(Slider, follows_fast_move_quickly) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+
+    replay(100, [](uint32_t) { return 100; });
+    updates.clear();
+
+    /* Jump to the other end, and measure how long it takes for the position to settle. */
+    uint8_t  target  = ideal_position(900);
+    uint32_t latency = 0;
+    for (uint32_t t = 0; t < 500 && std::abs(slider_get_position(0) - target) > 1; t++, latency++) {
+        adc_value = clamp(900 + noise());
+        run_one_scan_loop();
+    }
+    report_benchmark("slider_step", {{"step", "100->900"}, {"latency", latency, "ms"}, {"updates", updates.size()}});
+    EXPECT_LE(latency, 40);
+
+    /* Then the slider rests at the new position. */
+    replay(200, [](uint32_t) { return 900; });
+    updates.clear();
+    replay(5000, [](uint32_t) { return 900; });
+    EXPECT_TRUE(updates.empty());
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(Slider, tracks_slow_move_monotonically) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+
+    replay(100, [](uint32_t) { return 0; });
+    updates.clear();
+
+    /* Move across the whole travel in two seconds. */
+    uint32_t max_lag = 0;
+    for (uint32_t t = 0; t < 2000; t++) {
+        int32_t raw = t * SLIDER_ADC_MAX / 2000;
+        adc_value   = clamp(raw + noise());
+        run_one_scan_loop();
+        uint32_t lag = std::abs(ideal_position(raw) - slider_get_position(0));
+        if (lag > max_lag) max_lag = lag;
+    }
+    replay(200, [](uint32_t) { return SLIDER_ADC_MAX; });
+
+    uint32_t reversals = 0;
+    for (size_t i = 1; i < updates.size(); i++) {
+        reversals += updates[i] < updates[i - 1];
+    }
+    report_benchmark("slider_ramp", {{"ramp", "2000", "ms"}, {"max_lag", max_lag, "positions"}, {"updates", updates.size()}, {"reversals", reversals}});
+    EXPECT_EQ(reversals, 0);
+    EXPECT_LE(max_lag, 3);
+    EXPECT_EQ(slider_get_position(0), SLIDER_RESOLUTION - 1);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(Slider, calibration_is_stored_in_eeprom) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+
+    /* Sweep a slider that only reaches from 200 to 800. */
+    replay(100, [](uint32_t) { return 500; });
+    slider_calibration_start(0);
+    replay(1000, [](uint32_t t) { return 500 - (int32_t)t * 300 / 1000; });
+    replay(500, [](uint32_t) { return 200; });
+    replay(1000, [](uint32_t t) { return 200 + (int32_t)t * 600 / 1000; });
+    replay(500, [](uint32_t) { return 800; });
+    EXPECT_TRUE(slider_calibration_end(0));
+
+    slider_calibration_t calibration;
+    eeconfig_read_slider_calibration(0, &calibration);
+    EXPECT_NEAR(calibration.min, 200, 4);
+    EXPECT_NEAR(calibration.max, 800, 4);
+    replay(20, [](uint32_t) { return 800; });
+    EXPECT_EQ(slider_get_position(0), SLIDER_RESOLUTION - 1);
+
+    /* The calibration survives a restart. */
+    slider_init();
+    slider_calibration_t restored;
+    slider_get_calibration(0, &restored);
+    EXPECT_EQ(restored.min, calibration.min);
+    EXPECT_EQ(restored.max, calibration.max);
+    replay(100, [](uint32_t) { return 500; });
+    EXPECT_NEAR(slider_get_position(0), SLIDER_RESOLUTION / 2, 2);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(Slider, short_calibration_is_rejected) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+
+    replay(100, [](uint32_t) { return 500; });
+    slider_calibration_start(0);
+    replay(500, [](uint32_t t) { return 500 + (int32_t)t / 10; });
+    EXPECT_FALSE(slider_calibration_end(0));
+
+    slider_calibration_t calibration;
+    slider_get_calibration(0, &calibration);
+    EXPECT_EQ(calibration.min, 0);
+    EXPECT_EQ(calibration.max, SLIDER_ADC_MAX);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(Slider, calibration_is_stored_at_the_end_of_eeprom) {
+    std::vector<uint8_t> erased(TOTAL_EEPROM_BYTE_COUNT, 0xFF);
+    eeprom_update_block(erased.data(), (void *)0, erased.size());
+
+    /* Never calibrated, the slider uses its default travel. */
+    slider_init();
+    slider_calibration_t calibration;
+    slider_get_calibration(0, &calibration);
+    EXPECT_EQ(calibration.min, SLIDER_CALIBRATION_DEFAULT_MIN);
+    EXPECT_EQ(calibration.max, SLIDER_CALIBRATION_DEFAULT_MAX);
+
+    /* Storing a calibration leaves eeconfig and the data blocks after it alone. */
+    calibration = {.min = 100, .max = 900};
+    slider_set_calibration(0, &calibration);
+    std::vector<uint8_t> stored(TOTAL_EEPROM_BYTE_COUNT);
+    eeprom_read_block(stored.data(), (const void *)0, stored.size());
+    for (size_t i = 0; i < stored.size() - 16; i++) {
+        EXPECT_EQ(stored[i], 0xFF) << "at " << i;
+    }
+
+    slider_init();
+    slider_get_calibration(0, &calibration);
+    EXPECT_EQ(calibration.min, 100);
+    EXPECT_EQ(calibration.max, 900);
+}
@@ -0,0 +1,10 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define SLIDER_COUNT 2
+#define SLIDER_MIDI_14BIT
+#define SLIDER_MIDI_CC {7, 10}
@@ -0,0 +1,13 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+SLIDER_ENABLE = yes
+SLIDER_DRIVER = custom
+SLIDER_MIDI_ENABLE = yes
+
+# The MIDI library on its own, MIDI_ENABLE also pulls in the USB transport
+VPATH += $(QUANTUM_PATH)/midi
+SRC += $(QUANTUM_DIR)/midi/midi.c
+SRC += $(QUANTUM_DIR)/midi/midi_device.c
+SRC += $(QUANTUM_DIR)/midi/bytequeue/bytequeue.c
+SRC += $(QUANTUM_DIR)/midi/bytequeue/interrupt_setting.c
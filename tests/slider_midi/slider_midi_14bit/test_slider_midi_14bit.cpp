@@ -0,0 +1,163 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <functional>
+#include <vector>
+
+#include "benchmark_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "eeconfig.h"
+#include "midi.h"
+#include "slider.h"
+#include "slider_midi.h"
+#include "timer.h"
+}
+
+using testing::_;
+
+/* A 14-bit value, decoded from a fine controller message and the last coarse value. */
+typedef struct {
+    uint8_t  index;
+    uint16_t value;
+    uint32_t time;
+} cc_update_t;
+
+extern "C" MidiDevice midi_device;
+MidiDevice            midi_device;
+
+static const uint8_t            controllers[] = SLIDER_MIDI_CC;
+static uint16_t                 adc_values[SLIDER_COUNT];
+static uint8_t                  coarse[SLIDER_COUNT];
+static uint32_t                 coarse_messages;
+static uint32_t                 fine_messages;
+static std::vector<uint8_t>     sent_controllers;
+static std::vector<cc_update_t> updates;
+
+extern "C" uint16_t slider_sample(uint8_t index) {
+    return adc_values[index];
+}
+
+static void capture(MidiDevice *device, uint16_t count, uint8_t byte0, uint8_t byte1, uint8_t byte2) {
+    EXPECT_EQ(count, 3);
+    EXPECT_EQ(byte0, MIDI_CC);
+    sent_controllers.push_back(byte1);
+    for (uint8_t i = 0; i < SLIDER_COUNT; i++) {
+        if (byte1 == controllers[i]) {
+            coarse[i] = byte2;
+            coarse_messages++;
+            return;
+        }
+        if (byte1 == controllers[i] + 32) {
+            updates.push_back({i, (uint16_t)(coarse[i] << 7 | byte2), timer_read32()});
+            fine_messages++;
+            return;
+        }
+    }
+    ADD_FAILURE() << "Unexpected controller " << (int)byte1;
+}
+
+class SliderMidi14Bit : public TestFixture {
+   public:
+    uint32_t rng = 1;
+
+    void SetUp() override {
+        midi_device_init(&midi_device);
+        midi_device_set_send_func(&midi_device, capture);
+        eeconfig_update_slider_default();
+        for (auto &value : adc_values) {
+            value = 0;
+        }
+        slider_init();
+        slider_midi_init();
+        clear();
+    }
+
+    void clear() {
+        updates.clear();
+        sent_controllers.clear();
+        coarse_messages = 0;
+        fine_messages   = 0;
+    }
+
+    /* Triangular noise of up to +-6 ADC units, as read from a cheap potentiometer. */
+    int32_t noise() {
+        rng = rng * 1664525 + 1013904223;
+        int32_t a = (rng >> 8) % 7;
+        rng = rng * 1664525 + 1013904223;
+        int32_t b = (rng >> 8) % 7;
+        return a + b - 6;
+    }
+
+    static uint16_t clamp(int32_t raw) {
+        return raw < 0 ? 0 : raw > SLIDER_ADC_MAX ? SLIDER_ADC_MAX : raw;
+    }
+
+    /* Runs the keyboard for `ms` milliseconds, reading `trace(index, t)` plus noise from every slider. */
+    void replay(uint32_t ms, std::function<int32_t(uint8_t, uint32_t)> trace) {
+        for (uint32_t t = 0; t < ms; t++) {
+            for (uint8_t i = 0; i < SLIDER_COUNT; i++) {
+                adc_values[i] = clamp(trace(i, t) + noise());
+            }
+            run_one_scan_loop();
+        }
+    }
+};
+
+TEST_F(SliderMidi14Bit, first_update_sends_coarse_value) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+
+    /* Stays within the first coarse value, the host doesn't know it yet even though it did not change. */
+    replay(1000, [](uint8_t index, uint32_t) { return index == 0 ? 6 : 0; });
+    ASSERT_FALSE(updates.empty());
+    EXPECT_LT(slider_midi_get_value(0), 128);
+    EXPECT_EQ(updates.back().value, slider_midi_get_value(0));
+
+    /* Then only fine values follow. */
+    EXPECT_EQ(coarse_messages, 1);
+    EXPECT_EQ(sent_controllers[0], controllers[0]);
+    for (size_t i = 1; i < sent_controllers.size(); i++) {
+        EXPECT_EQ(sent_controllers[i], controllers[0] + 32);
+    }
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SliderMidi14Bit, slow_sweep_sends_coarse_values_on_change) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+
+    replay(100, [](uint8_t, uint32_t) { return -50; });
+    clear();
+    replay(5000, [](uint8_t index, uint32_t t) { return index == 0 ? -50 + (int32_t)(t * (SLIDER_ADC_MAX + 100) / 5000) : 0; });
+    replay(500, [](uint8_t index, uint32_t) { return index == 0 ? SLIDER_ADC_MAX + 50 : 0; });
+
+    report_benchmark("slider_midi_14bit_sweep", {{"travel", "5000", "ms"}, {"updates", updates.size()}, {"coarse", coarse_messages}, {"fine", fine_messages}});
+
+    /* Rate limited to one update per interval, each with a coarse value at most when it changed. */
+    ASSERT_FALSE(updates.empty());
+    EXPECT_LE(updates.size(), 5500 / SLIDER_MIDI_INTERVAL + 1);
+    EXPECT_LE(coarse_messages, 128);
+    EXPECT_EQ(fine_messages, updates.size());
+    for (size_t i = 1; i < updates.size(); i++) {
+        EXPECT_GT(updates[i].value, updates[i - 1].value);
+        EXPECT_GE(updates[i].time - updates[i - 1].time, SLIDER_MIDI_INTERVAL);
+    }
+    EXPECT_EQ(updates.back().value, SLIDER_MIDI_VALUE_MAX);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SliderMidi14Bit, resting_slider_does_not_flicker) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+
+    replay(1000, [](uint8_t, uint32_t) { return 500; });
+    clear();
+    replay(60000, [](uint8_t, uint32_t) { return 500; });
+
+    report_benchmark("slider_midi_14bit_rest", {{"resting", "60", "s"}, {"noise", "+-6"}, {"messages", coarse_messages + fine_messages}});
+    EXPECT_EQ(coarse_messages + fine_messages, 0);
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,219 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+#include "benchmark_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "eeconfig.h"
+#include "midi.h"
+#include "slider.h"
+#include "slider_midi.h"
+#include "timer.h"
+}
+
+using testing::_;
+
+typedef struct {
+    uint8_t  status;
+    uint8_t  cc;
+    uint8_t  value;
+    uint32_t time;
+} cc_message_t;
+
+extern "C" MidiDevice midi_device;
+MidiDevice            midi_device;
+
+static uint16_t                  adc_values[SLIDER_COUNT];
+static std::vector<cc_message_t> messages;
+static bool                      suppress = false;
+
+extern "C" uint16_t slider_sample(uint8_t index) {
+    return adc_values[index];
+}
+
+extern "C" bool slider_midi_update_user(uint8_t index, uint16_t value) {
+    return !suppress;
+}
+
+static void capture(MidiDevice *device, uint16_t count, uint8_t byte0, uint8_t byte1, uint8_t byte2) {
+    EXPECT_EQ(count, 3);
+    messages.push_back({byte0, byte1, byte2, timer_read32()});
+}
+
+class SliderMidi : public TestFixture {
+   public:
+    uint32_t rng = 1;
+
+    void SetUp() override {
+        midi_device_init(&midi_device);
+        midi_device_set_send_func(&midi_device, capture);
+        eeconfig_update_slider_default();
+        for (auto &value : adc_values) {
+            value = 0;
+        }
+        suppress = false;
+        slider_init();
+        slider_midi_init();
+        messages.clear();
+    }
+
+    /* Triangular noise of up to +-6 ADC units, as read from a cheap potentiometer. */
+    int32_t noise() {
+        rng = rng * 1664525 + 1013904223;
+        int32_t a = (rng >> 8) % 7;
+        rng = rng * 1664525 + 1013904223;
+        int32_t b = (rng >> 8) % 7;
+        return a + b - 6;
+    }
+
+    static uint16_t clamp(int32_t raw) {
+        return raw < 0 ? 0 : raw > SLIDER_ADC_MAX ? SLIDER_ADC_MAX : raw;
+    }
+
+    /* Runs the keyboard for `ms` milliseconds, reading `trace(index, t)` plus noise from every slider. */
+    void replay(uint32_t ms, std::function<int32_t(uint8_t, uint32_t)> trace) {
+        for (uint32_t t = 0; t < ms; t++) {
+            for (uint8_t i = 0; i < SLIDER_COUNT; i++) {
+                adc_values[i] = clamp(trace(i, t) + noise());
+            }
+            run_one_scan_loop();
+        }
+    }
+
+    /* Moves slider 0 from one end to the other in `ms` milliseconds, going slightly past both ends. */
+    void sweep(uint32_t ms) {
+        replay(100, [](uint8_t, uint32_t) { return -50; });
+        messages.clear();
+        replay(ms, [=](uint8_t index, uint32_t t) { return index == 0 ? -50 + (int32_t)(t * (SLIDER_ADC_MAX + 100) / ms) : 0; });
+        replay(500, [](uint8_t index, uint32_t) { return index == 0 ? SLIDER_ADC_MAX + 50 : 0; });
+    }
+
+    static uint32_t shortest_gap() {
+        uint32_t gap = UINT32_MAX;
+        for (size_t i = 1; i < messages.size(); i++) {
+            gap = std::min(gap, messages[i].time - messages[i - 1].time);
+        }
+        return gap;
+    }
+};
+
+TEST_F(SliderMidi, resting_slider_does_not_flicker) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+
+    /* Creep from 500 to 520 ADC units, across the value boundaries at 504, 512 and 520, resting on each raw value for 10 seconds. */
+    replay(1000, [](uint8_t, uint32_t) { return 500; });
+    messages.clear();
+    for (int32_t raw = 500; raw <= 520; raw++) {
+        replay(10000, [&](uint8_t, uint32_t) { return raw; });
+    }
+
+    /* Every slider may step up once per boundary, anything going back down is noise. */
+    uint32_t flickers           = 0;
+    uint8_t  last[SLIDER_COUNT] = {500 / 8, 500 / 8};
+    for (auto &message : messages) {
+        if (message.value <= last[message.cc - 16]) {
+            flickers++;
+        }
+        last[message.cc - 16] = message.value;
+    }
+    report_benchmark("slider_midi_rest", {{"resting", "210", "s"}, {"noise", "+-6"}, {"messages", messages.size()}, {"flickers", flickers}});
+    EXPECT_EQ(flickers, 0);
+    EXPECT_LE(messages.size(), 3 * SLIDER_COUNT);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SliderMidi, slow_sweep_sends_every_value_once) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+
+    sweep(5000);
+    report_benchmark("slider_midi_slow_sweep", {{"travel", "5000", "ms"}, {"messages", messages.size()}});
+
+    ASSERT_FALSE(messages.empty());
+    EXPECT_GE(messages.size(), SLIDER_MIDI_VALUE_MAX * 9 / 10);
+    EXPECT_LE(messages.size(), SLIDER_MIDI_VALUE_MAX);
+    for (size_t i = 0; i < messages.size(); i++) {
+        EXPECT_EQ(messages[i].status, MIDI_CC);
+        EXPECT_EQ(messages[i].cc, 16);
+        if (i > 0) {
+            EXPECT_GT(messages[i].value, messages[i - 1].value);
+        }
+    }
+    EXPECT_EQ(messages.back().value, SLIDER_MIDI_VALUE_MAX);
+    EXPECT_GE(shortest_gap(), SLIDER_MIDI_INTERVAL);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SliderMidi, fast_sweep_is_rate_limited) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+
+    sweep(200);
+    report_benchmark("slider_midi_fast_sweep", {{"travel", "200", "ms"}, {"messages", messages.size()}, {"shortest_gap", shortest_gap(), "ms"}});
+
+    /* The sweep and the filter settling take a few hundred ms, at most one message per interval. */
+    ASSERT_FALSE(messages.empty());
+    EXPECT_LE(messages.size(), 700 / SLIDER_MIDI_INTERVAL + 1);
+    EXPECT_GE(shortest_gap(), SLIDER_MIDI_INTERVAL);
+    EXPECT_EQ(messages.back().value, SLIDER_MIDI_VALUE_MAX);
+    EXPECT_EQ(slider_midi_get_value(0), SLIDER_MIDI_VALUE_MAX);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SliderMidi, sliders_share_the_rate_limit) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+
+    /* Both sliders move up and down quickly, for one second. */
+    replay(1000, [](uint8_t index, uint32_t t) {
+        int32_t phase = (t * (index + 2)) % 400;
+        return (phase < 200 ? phase : 400 - phase) * SLIDER_ADC_MAX / 200;
+    });
+    replay(500, [](uint8_t index, uint32_t) { return index == 0 ? 300 : 700; });
+
+    size_t counts[SLIDER_COUNT] = {0};
+    for (auto &message : messages) {
+        ASSERT_GE(message.cc, 16);
+        ASSERT_LT(message.cc, 16 + SLIDER_COUNT);
+        counts[message.cc - 16]++;
+    }
+    report_benchmark("slider_midi_two_sliders", {{"duration", "1500", "ms"}, {"messages_0", counts[0]}, {"messages_1", counts[1]}});
+
+    EXPECT_LE(messages.size(), 1500 / SLIDER_MIDI_INTERVAL + 1);
+    EXPECT_GE(shortest_gap(), SLIDER_MIDI_INTERVAL);
+    EXPECT_GT(counts[0], 10);
+    EXPECT_GT(counts[1], 10);
+
+    /* Whatever was dropped on the way, the last value sent for each slider is where it stopped. */
+    for (uint8_t i = 0; i < SLIDER_COUNT; i++) {
+        auto last = std::find_if(messages.rbegin(), messages.rend(), [&](const cc_message_t &message) { return message.cc == 16 + i; });
+        ASSERT_NE(last, messages.rend());
+        EXPECT_EQ(last->value, slider_midi_get_value(i));
+    }
+    EXPECT_NEAR(slider_midi_get_value(0), 300 * 128 / 1024, 1);
+    EXPECT_NEAR(slider_midi_get_value(1), 700 * 128 / 1024, 1);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SliderMidi, callback_can_suppress_messages) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+
+    suppress = true;
+    sweep(500);
+    EXPECT_TRUE(messages.empty());
+    EXPECT_EQ(slider_midi_get_value(0), SLIDER_MIDI_VALUE_MAX);
+
+    suppress = false;
+    replay(500, [](uint8_t index, uint32_t) { return index == 0 ? 512 : 0; });
+    ASSERT_FALSE(messages.empty());
+    EXPECT_EQ(messages.back().value, slider_midi_get_value(0));
+    VERIFY_AND_CLEAR(driver);
+}
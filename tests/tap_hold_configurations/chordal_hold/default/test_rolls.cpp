@@ -0,0 +1,36 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_common.hpp"
+#include "test_rolls.hpp"
+
+/* The keys typed during tap-hold keys settled as held were recorded with the
+ * linear scans of the waiting buffer, so any change in how the rolls settle
+ * shows up as a mismatch.
+ */
+class ChordalHoldDefaultRolls : public RollFixture {};
+
+TEST_F(ChordalHoldDefaultRolls, roll_seed_1) {
+    RollResult roll = type_roll(1, 400);
+    EXPECT_GE(roll.wpm, 100);
+    EXPECT_EQ(roll.reports.size(), 796);
+    EXPECT_EQ(chords(roll), "RSFT+T RSFT+E LEFT 5 1 3");
+    EXPECT_EQ(lost_keystrokes(roll), 0);
+}
+
+TEST_F(ChordalHoldDefaultRolls, roll_seed_2) {
+    RollResult roll = type_roll(2, 400);
+    EXPECT_GE(roll.wpm, 100);
+    EXPECT_EQ(roll.reports.size(), 788);
+    EXPECT_EQ(chords(roll), "");
+    // The default waiting buffer overflows once in this roll, and the keys it held are dropped
+    EXPECT_EQ(lost_keystrokes(roll), 4);
+}
+
+TEST_F(ChordalHoldDefaultRolls, roll_seed_3) {
+    RollResult roll = type_roll(3, 400);
+    EXPECT_GE(roll.wpm, 100);
+    EXPECT_EQ(roll.reports.size(), 800);
+    EXPECT_EQ(chords(roll), "");
+    EXPECT_EQ(lost_keystrokes(roll), 0);
+}
@@ -0,0 +1,35 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_common.hpp"
+#include "test_rolls.hpp"
+
+/* The keys typed during tap-hold keys settled as held were recorded with the
+ * linear scans of the waiting buffer, so any change in how the rolls settle
+ * shows up as a mismatch.
+ */
+class ChordalHoldPermissiveHoldFlowTapRolls : public RollFixture {};
+
+TEST_F(ChordalHoldPermissiveHoldFlowTapRolls, roll_seed_1) {
+    RollResult roll = type_roll(1, 400);
+    EXPECT_GE(roll.wpm, 100);
+    EXPECT_EQ(roll.reports.size(), 796);
+    EXPECT_EQ(chords(roll), "RCTL+S RCTL+U LEFT 5 1 3");
+    EXPECT_EQ(lost_keystrokes(roll), 0);
+}
+
+TEST_F(ChordalHoldPermissiveHoldFlowTapRolls, roll_seed_2) {
+    RollResult roll = type_roll(2, 400);
+    EXPECT_GE(roll.wpm, 100);
+    EXPECT_EQ(roll.reports.size(), 794);
+    EXPECT_EQ(chords(roll), "5 2 UP RCTL+S LEFT");
+    EXPECT_EQ(lost_keystrokes(roll), 0);
+}
+
+TEST_F(ChordalHoldPermissiveHoldFlowTapRolls, roll_seed_3) {
+    RollResult roll = type_roll(3, 400);
+    EXPECT_GE(roll.wpm, 100);
+    EXPECT_EQ(roll.reports.size(), 798);
+    EXPECT_EQ(chords(roll), "3");
+    EXPECT_EQ(lost_keystrokes(roll), 0);
+}
@@ -0,0 +1,167 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "action_tapping.h"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+class LosslessBufferTapHold : public TestFixture {
+   public:
+    /* Adds 32 keys on `layer`, at every matrix position after (0, 0). */
+    std::vector<KeymapKey> add_typing_keys(layer_t layer, uint16_t first_keycode) {
+        std::vector<KeymapKey> keys;
+        for (uint8_t i = 1; i <= 32; i++) {
+            keys.push_back(KeymapKey(layer, i % MATRIX_COLS, i / MATRIX_COLS, first_keycode + i - 1));
+            add_key(keys.back());
+        }
+        return keys;
+    }
+};
+
+TEST_F(LosslessBufferTapHold, type_32_keys_within_tapping_term_of_mod_tap) {
+    TestDriver driver;
+    InSequence s;
+    auto       mod_tap_key = KeymapKey(0, 0, 0, SFT_T(KC_P));
+
+    set_keymap({mod_tap_key});
+    auto keys = add_typing_keys(0, KC_A);
+
+    /* Press mod-tap key. */
+    EXPECT_NO_REPORT(driver);
+    mod_tap_key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    /* Type 32 keys, far more events than the waiting buffer holds, within the
+     * tapping term. The mod-tap key settles as held once the buffer is full and
+     * every key still reaches the host, in order. */
+    EXPECT_REPORT(driver, (KC_LSFT));
+    for (auto &key : keys) {
+        EXPECT_REPORT(driver, (KC_LSFT, key.report_code));
+        EXPECT_REPORT(driver, (KC_LSFT));
+    }
+    uint16_t start = timer_read();
+    for (auto &key : keys) {
+        tap_key(key);
+    }
+    EXPECT_LT(timer_elapsed(start), TAPPING_TERM);
+    VERIFY_AND_CLEAR(driver);
+
+    /* Release mod-tap key. */
+    EXPECT_EMPTY_REPORT(driver);
+    mod_tap_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LosslessBufferTapHold, type_32_keys_within_tapping_term_of_layer_tap) {
+    TestDriver driver;
+    InSequence s;
+    auto       layer_tap_key = KeymapKey(0, 0, 0, LT(1, KC_P));
+
+    set_keymap({layer_tap_key});
+    add_typing_keys(0, KC_A);
+    auto layer_keys = add_typing_keys(1, KC_F1);
+
+    /* Press layer-tap key. */
+    EXPECT_NO_REPORT(driver);
+    layer_tap_key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    /* Type 32 keys within the tapping term. All of them come from layer 1. */
+    for (auto &key : layer_keys) {
+        EXPECT_REPORT(driver, (key.report_code));
+        EXPECT_EMPTY_REPORT(driver);
+    }
+    for (auto &key : layer_keys) {
+        tap_key(key);
+    }
+    VERIFY_AND_CLEAR(driver);
+
+    /* Release layer-tap key. */
+    EXPECT_NO_REPORT(driver);
+    layer_tap_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LosslessBufferTapHold, mod_tap_released_before_buffer_fills_is_tapped) {
+    TestDriver driver;
+    InSequence s;
+    auto       mod_tap_key = KeymapKey(0, 0, 0, SFT_T(KC_P));
+
+    set_keymap({mod_tap_key});
+    auto keys = add_typing_keys(0, KC_A);
+
+    /* Press mod-tap key and type three keys, which fit in the waiting buffer. */
+    EXPECT_NO_REPORT(driver);
+    mod_tap_key.press();
+    run_one_scan_loop();
+    for (uint8_t i = 0; i < 3; i++) {
+        tap_key(keys[i]);
+    }
+    VERIFY_AND_CLEAR(driver);
+
+    /* Release mod-tap key within the tapping term, it is still a tap. */
+    EXPECT_REPORT(driver, (KC_P));
+    for (uint8_t i = 0; i < 3; i++) {
+        EXPECT_REPORT(driver, (KC_P, keys[i].report_code));
+        EXPECT_REPORT(driver, (KC_P));
+    }
+    EXPECT_EMPTY_REPORT(driver);
+    mod_tap_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LosslessBufferTapHold, second_mod_tap_in_full_buffer_is_tapped) {
+    TestDriver driver;
+    InSequence s;
+    auto       first_mod_tap_key  = KeymapKey(0, 0, 0, SFT_T(KC_P));
+    auto       second_mod_tap_key = KeymapKey(0, 1, 0, RCTL_T(KC_Q));
+    auto       key_a              = KeymapKey(0, 2, 0, KC_A);
+    auto       key_b              = KeymapKey(0, 3, 0, KC_B);
+    auto       key_c              = KeymapKey(0, 4, 0, KC_C);
+
+    set_keymap({first_mod_tap_key, second_mod_tap_key, key_a, key_b, key_c});
+
+    /* Press both mod-tap keys and type three keys, which fills the waiting
+     * buffer with the second mod-tap key as its oldest event. */
+    EXPECT_NO_REPORT(driver);
+    first_mod_tap_key.press();
+    run_one_scan_loop();
+    second_mod_tap_key.press();
+    run_one_scan_loop();
+    tap_keys(key_a, key_b, key_c);
+    VERIFY_AND_CLEAR(driver);
+
+    /* Release the first mod-tap key, it is a tap. Its release does not fit in
+     * the buffer, which makes the second mod-tap key the next tapping key. */
+    EXPECT_REPORT(driver, (KC_P));
+    first_mod_tap_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    /* Release the second mod-tap key within its tapping term, it is a tap too. */
+    EXPECT_REPORT(driver, (KC_P, KC_Q));
+    EXPECT_REPORT(driver, (KC_P, KC_Q, KC_A));
+    EXPECT_REPORT(driver, (KC_P, KC_Q));
+    EXPECT_REPORT(driver, (KC_P, KC_Q, KC_B));
+    EXPECT_REPORT(driver, (KC_P, KC_Q));
+    EXPECT_REPORT(driver, (KC_P, KC_Q, KC_C));
+    EXPECT_REPORT(driver, (KC_P, KC_Q));
+    EXPECT_REPORT(driver, (KC_Q));
+    EXPECT_EMPTY_REPORT(driver);
+    second_mod_tap_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
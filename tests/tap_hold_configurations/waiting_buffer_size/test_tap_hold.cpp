@@ -0,0 +1,50 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "action_tapping.h"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+class WaitingBufferSizeTapHold : public TestFixture {};
+
+TEST_F(WaitingBufferSizeTapHold, seven_keys_fit_within_tapping_term_of_mod_tap) {
+    TestDriver driver;
+    InSequence s;
+    auto       mod_tap_key = KeymapKey(0, 0, 0, SFT_T(KC_P));
+
+    set_keymap({mod_tap_key});
+    std::vector<KeymapKey> keys;
+    for (uint8_t i = 1; i <= (WAITING_BUFFER_SIZE - 1) / 2; i++) {
+        keys.push_back(KeymapKey(0, i % MATRIX_COLS, i / MATRIX_COLS, KC_A + i - 1));
+        add_key(keys.back());
+    }
+
+    /* Tap seven keys within the tapping term of a mod-tap key. Their fourteen
+     * events would overflow the default buffer, and all fit in this one. */
+    EXPECT_NO_REPORT(driver);
+    mod_tap_key.press();
+    run_one_scan_loop();
+    for (auto &key : keys) {
+        tap_key(key);
+    }
+    VERIFY_AND_CLEAR(driver);
+
+    /* Release the mod-tap key: it is a tap, around every buffered key. */
+    EXPECT_REPORT(driver, (KC_P));
+    for (auto &key : keys) {
+        EXPECT_REPORT(driver, (KC_P, key.report_code));
+        EXPECT_REPORT(driver, (KC_P));
+    }
+    EXPECT_EMPTY_REPORT(driver);
+    mod_tap_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
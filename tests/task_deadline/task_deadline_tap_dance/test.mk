@@ -0,0 +1,8 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+TASK_DEADLINE_ENABLE = yes
+
+TAP_DANCE_ENABLE = yes
+
+INTROSPECTION_KEYMAP_C = test_tap_dance.c
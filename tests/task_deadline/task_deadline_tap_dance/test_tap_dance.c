@@ -0,0 +1,11 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "quantum.h"
+
+enum tap_dances { td_b_c };
+
+// clang-format off
+tap_dance_action_t tap_dance_actions[] = {
+    [td_b_c] = ACTION_TAP_DANCE_DOUBLE(KC_B, KC_C)
+};
+// clang-format on
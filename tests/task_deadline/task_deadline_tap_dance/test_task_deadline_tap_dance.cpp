@@ -0,0 +1,47 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "task_deadline.h"
+}
+
+using testing::_;
+using testing::InSequence;
+
+class TaskDeadlineTapDance : public TestFixture {};
+
+TEST_F(TaskDeadlineTapDance, dance_buffered_behind_mod_tap_finishes) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  mod_tap_key(0, 0, 0, LSFT_T(KC_A));
+    KeymapKey  tap_dance_key(0, 1, 0, TD(0));
+    set_keymap({mod_tap_key, tap_dance_key});
+
+    /* The tap dance key is tapped while the mod-tap is still undecided, so it waits in the tapping buffer. */
+    EXPECT_NO_REPORT(driver);
+    mod_tap_key.press();
+    run_one_scan_loop();
+    tap_key(tap_dance_key);
+    VERIFY_AND_CLEAR(driver);
+
+    /* The mod-tap is decided on a scan without key events, which replays the tap dance key. */
+    EXPECT_REPORT(driver, (KC_LSFT));
+    idle_for(TAPPING_TERM);
+    VERIFY_AND_CLEAR(driver);
+
+    /* No key event follows, still the dance finishes at its tapping term. */
+    EXPECT_REPORT(driver, (KC_LSFT, KC_B));
+    EXPECT_REPORT(driver, (KC_LSFT));
+    idle_for(TAPPING_TERM + 1);
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_FALSE(task_deadline_due(TASK_DEADLINE_TAP_DANCE));
+
+    EXPECT_EMPTY_REPORT(driver);
+    mod_tap_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,10 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+TASK_DEADLINE_ENABLE = yes
+
+CAPS_WORD_ENABLE = yes
+COMBO_ENABLE = yes
+SECURE_ENABLE = yes
+
+INTROSPECTION_KEYMAP_C = test_combos.c
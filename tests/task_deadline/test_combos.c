@@ -0,0 +1,13 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "quantum.h"
+
+enum combos { jk_escape };
+
+uint16_t const jk_escape_combo[] = {KC_J, KC_K, COMBO_END};
+
+// clang-format off
+combo_t key_combos[] = {
+    [jk_escape] = COMBO(jk_escape_combo, KC_ESCAPE)
+};
+// clang-format on
@@ -0,0 +1,176 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "task_deadline.h"
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+using testing::_;
+
+class TaskDeadline : public TestFixture {
+   public:
+    void SetUp() override {
+        caps_word_off();
+        secure_lock();
+    }
+};
+
+TEST_F(TaskDeadline, tasks_start_out_due) {
+    for (int task = 0; task < TASK_DEADLINE_COUNT; task++) {
+        EXPECT_TRUE(task_deadline_due((task_deadline_t)task));
+    }
+}
+
+TEST_F(TaskDeadline, deferred_task_becomes_due_at_deadline) {
+    task_deadline_defer(TASK_DEADLINE_WPM, 10);
+    advance_time(9);
+    EXPECT_FALSE(task_deadline_due(TASK_DEADLINE_WPM));
+    advance_time(1);
+    EXPECT_TRUE(task_deadline_due(TASK_DEADLINE_WPM));
+    /* Stays due until the task publishes a new deadline. */
+    advance_time(100);
+    EXPECT_TRUE(task_deadline_due(TASK_DEADLINE_WPM));
+}
+
+TEST_F(TaskDeadline, defer_zero_is_due_immediately) {
+    task_deadline_sleep(TASK_DEADLINE_WPM);
+    task_deadline_defer(TASK_DEADLINE_WPM, 0);
+    EXPECT_TRUE(task_deadline_due(TASK_DEADLINE_WPM));
+}
+
+TEST_F(TaskDeadline, deferred_task_survives_timer_wraparound) {
+    set_time(UINT32_MAX - 4);
+    task_deadline_defer(TASK_DEADLINE_WPM, 10);
+    advance_time(9);
+    EXPECT_FALSE(task_deadline_due(TASK_DEADLINE_WPM));
+    advance_time(1);
+    EXPECT_TRUE(task_deadline_due(TASK_DEADLINE_WPM));
+}
+
+TEST_F(TaskDeadline, sleeping_task_waits_for_wake) {
+    task_deadline_sleep(TASK_DEADLINE_WPM);
+    task_deadline_sleep(TASK_DEADLINE_LEADER);
+    advance_time(60000);
+    EXPECT_FALSE(task_deadline_due(TASK_DEADLINE_WPM));
+    EXPECT_FALSE(task_deadline_due(TASK_DEADLINE_LEADER));
+
+    task_deadline_wake(TASK_DEADLINE_WPM);
+    EXPECT_TRUE(task_deadline_due(TASK_DEADLINE_WPM));
+    EXPECT_FALSE(task_deadline_due(TASK_DEADLINE_LEADER));
+
+    task_deadline_wake_all();
+    EXPECT_TRUE(task_deadline_due(TASK_DEADLINE_LEADER));
+}
+
+TEST_F(TaskDeadline, idle_keyboard_skips_all_tasks) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    run_one_scan_loop();
+    EXPECT_FALSE(task_deadline_due(TASK_DEADLINE_COMBO));
+    EXPECT_FALSE(task_deadline_due(TASK_DEADLINE_CAPS_WORD));
+    EXPECT_FALSE(task_deadline_due(TASK_DEADLINE_SECURE));
+    idle_for(10000);
+    EXPECT_FALSE(task_deadline_due(TASK_DEADLINE_COMBO));
+    EXPECT_FALSE(task_deadline_due(TASK_DEADLINE_CAPS_WORD));
+    EXPECT_FALSE(task_deadline_due(TASK_DEADLINE_SECURE));
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(TaskDeadline, key_event_wakes_tasks) {
+    TestDriver driver;
+    KeymapKey  key_a(0, 0, 0, KC_A);
+    set_keymap({key_a});
+
+    run_one_scan_loop();
+    EXPECT_FALSE(task_deadline_due(TASK_DEADLINE_COMBO));
+
+    EXPECT_REPORT(driver, (KC_A));
+    key_a.press();
+    keyboard_task();
+    /* The combo task saw the event in the same scan, so it can go back to sleep. */
+    EXPECT_FALSE(task_deadline_due(TASK_DEADLINE_COMBO));
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_a.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(TaskDeadline, combo_key_released_at_combo_term) {
+    TestDriver driver;
+    KeymapKey  key_j(0, 0, 0, KC_J);
+    KeymapKey  key_k(0, 1, 0, KC_K);
+    set_keymap({key_j, key_k});
+
+    /* A combo timer started at time zero reads as unset, so start a little later. */
+    EXPECT_NO_REPORT(driver);
+    run_one_scan_loop();
+    key_j.press();
+    run_one_scan_loop();
+    /* Waiting on the combo term, the task is only called when it expires. */
+    EXPECT_FALSE(task_deadline_due(TASK_DEADLINE_COMBO));
+    idle_for(COMBO_TERM);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_J));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_j.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(TaskDeadline, combo_still_fires) {
+    TestDriver driver;
+    KeymapKey  key_j(0, 0, 0, KC_J);
+    KeymapKey  key_k(0, 1, 0, KC_K);
+    set_keymap({key_j, key_k});
+
+    EXPECT_REPORT(driver, (KC_ESCAPE));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_j, key_k});
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(TaskDeadline, caps_word_idle_timeout) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    caps_word_on();
+    EXPECT_TRUE(task_deadline_due(TASK_DEADLINE_CAPS_WORD));
+    run_one_scan_loop();
+    EXPECT_FALSE(task_deadline_due(TASK_DEADLINE_CAPS_WORD));
+
+    idle_for(CAPS_WORD_IDLE_TIMEOUT - 1);
+    EXPECT_TRUE(is_caps_word_on());
+    run_one_scan_loop();
+    EXPECT_FALSE(is_caps_word_on());
+    EXPECT_FALSE(task_deadline_due(TASK_DEADLINE_CAPS_WORD));
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(TaskDeadline, secure_unlock_request_times_out) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    secure_request_unlock();
+    EXPECT_TRUE(secure_is_unlocking());
+    run_one_scan_loop();
+    EXPECT_FALSE(task_deadline_due(TASK_DEADLINE_SECURE));
+
+    idle_for(SECURE_UNLOCK_TIMEOUT - 1);
+    EXPECT_TRUE(secure_is_unlocking());
+    run_one_scan_loop();
+    EXPECT_TRUE(secure_is_locked());
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,9 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define TASK_PROFILE_INTERVAL 100
+#define CAPS_WORD_IDLE_TIMEOUT 1000
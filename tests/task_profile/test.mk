@@ -0,0 +1,6 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+TASK_PROFILE_ENABLE = yes
+TASK_DEADLINE_ENABLE = yes
+CAPS_WORD_ENABLE = yes
@@ -0,0 +1,129 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "task_profile.h"
+void advance_time(uint32_t ms);
+}
+
+using testing::_;
+
+static uint32_t fake_ticks = 0;
+
+extern "C" uint32_t task_profile_ticks(void) {
+    return fake_ticks;
+}
+
+class TaskProfile : public TestFixture {
+   public:
+    void SetUp() override {
+        fake_ticks = 0;
+        task_profile_reset();
+    }
+
+    /* Records a single call of `task` lasting `ticks`. */
+    void record(task_profile_t task, uint32_t ticks) {
+        uint32_t start = fake_ticks;
+        fake_ticks += ticks;
+        task_profile_record(task, start);
+    }
+
+    static uint32_t read_u32(const uint8_t* data) {
+        return data[0] | (data[1] << 8) | (data[2] << 16) | ((uint32_t)data[3] << 24);
+    }
+};
+
+TEST_F(TaskProfile, counts_every_scan) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    idle_for(50);
+    EXPECT_EQ(task_profile_get(TASK_PROFILE_MATRIX)->count, 50);
+    EXPECT_EQ(task_profile_get(TASK_PROFILE_QUANTUM)->count, 50);
+    EXPECT_EQ(task_profile_get(TASK_PROFILE_LED)->count, 50);
+    EXPECT_EQ(task_profile_get(TASK_PROFILE_MATRIX)->histogram[0], 50);
+    /* Disabled features are never called. */
+    EXPECT_EQ(task_profile_get(TASK_PROFILE_RGB_MATRIX)->count, 0);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(TaskProfile, counts_only_tasks_that_ran) {
+    TestDriver driver;
+
+    /* An idle Caps Word task is put to sleep by its deadline after the first scan. */
+    EXPECT_NO_REPORT(driver);
+    idle_for(50);
+    EXPECT_EQ(task_profile_get(TASK_PROFILE_CAPS_WORD)->count, 1);
+
+    caps_word_on();
+    idle_for(10);
+    EXPECT_EQ(task_profile_get(TASK_PROFILE_CAPS_WORD)->count, 2);
+    caps_word_off();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(TaskProfile, records_total_max_and_histogram) {
+    record(TASK_PROFILE_COMBO, 0);
+    record(TASK_PROFILE_COMBO, 3);
+    record(TASK_PROFILE_COMBO, 4);
+    record(TASK_PROFILE_COMBO, 100);
+    record(TASK_PROFILE_COMBO, 1000000);
+
+    const task_profile_stats_t* stats = task_profile_get(TASK_PROFILE_COMBO);
+    EXPECT_EQ(stats->count, 5);
+    EXPECT_EQ(stats->total_ticks, 1000107);
+    EXPECT_EQ(stats->max_ticks, 1000000);
+    EXPECT_EQ(stats->histogram[0], 1);
+    EXPECT_EQ(stats->histogram[1], 1);
+    EXPECT_EQ(stats->histogram[2], 1);
+    EXPECT_EQ(stats->histogram[4], 1);
+    EXPECT_EQ(stats->histogram[TASK_PROFILE_HISTOGRAM_BUCKETS - 1], 1);
+}
+
+TEST_F(TaskProfile, window_restarts_after_interval) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    idle_for(TASK_PROFILE_INTERVAL);
+    EXPECT_EQ(task_profile_get(TASK_PROFILE_MATRIX)->count, TASK_PROFILE_INTERVAL);
+    /* The window is emitted and cleared at the end of the first scan past the interval. */
+    idle_for(1);
+    EXPECT_EQ(task_profile_get(TASK_PROFILE_MATRIX)->count, 0);
+    idle_for(10);
+    EXPECT_EQ(task_profile_get(TASK_PROFILE_MATRIX)->count, 10);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(TaskProfile, packs_raw_hid_packets) {
+    uint8_t data[32];
+
+    record(TASK_PROFILE_RGB_MATRIX, 20);
+    record(TASK_PROFILE_RGB_MATRIX, 60);
+    task_profile_pack(TASK_PROFILE_RGB_MATRIX, data);
+    EXPECT_EQ(data[0], TASK_PROFILE_RAW_HID_ID);
+    EXPECT_EQ(data[1], TASK_PROFILE_RGB_MATRIX);
+    EXPECT_EQ(data[2], TASK_PROFILE_COUNT);
+    EXPECT_EQ(data[3], TASK_PROFILE_HISTOGRAM_SHIFT);
+    EXPECT_EQ(read_u32(&data[4]), 2);
+    EXPECT_EQ(read_u32(&data[8]), 80);
+    EXPECT_EQ(read_u32(&data[12]), 60);
+    EXPECT_EQ(data[16 + 3 * 2], 2);
+
+    advance_time(42);
+    task_profile_pack(TASK_PROFILE_RAW_HID_HEADER, data);
+    EXPECT_EQ(data[1], TASK_PROFILE_RAW_HID_HEADER);
+    EXPECT_EQ(read_u32(&data[4]), 42);
+    EXPECT_EQ(read_u32(&data[8]), task_profile_tick_hz());
+}
+
+TEST_F(TaskProfile, names_tasks) {
+    EXPECT_STREQ(task_profile_name(TASK_PROFILE_MATRIX), "matrix");
+    EXPECT_STREQ(task_profile_name(TASK_PROFILE_OS_DETECTION), "os_detection");
+    for (int task = 0; task < TASK_PROFILE_COUNT; task++) {
+        EXPECT_NE(task_profile_name((task_profile_t)task), nullptr);
+    }
+}
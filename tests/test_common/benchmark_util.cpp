@@ -0,0 +1,39 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "benchmark_util.hpp"
+#include <cctype>
+#include <cstdio>
+#include "gtest/gtest.h"
+
+namespace {
+/* Property names end up as XML attribute names. */
+std::string property_name(std::string name) {
+    for (char &c : name) {
+        if (!std::isalnum(static_cast<unsigned char>(c))) {
+            c = '_';
+        }
+    }
+    return name;
+}
+} // namespace
+
+std::string BenchmarkValue::format(double value) {
+    char text[32];
+    std::snprintf(text, sizeof(text), "%.2f", value);
+    return text;
+}
+
+void report_benchmark(const std::string &benchmark, std::initializer_list<BenchmarkValue> values) {
+    std::string line;
+    for (auto &value : values) {
+        line += " " + value.name + "=" + value.value + value.unit;
+
+        std::string property = benchmark + "_" + value.name;
+        if (!value.unit.empty()) {
+            property += "_" + value.unit;
+        }
+        testing::Test::RecordProperty(property_name(property), value.value);
+    }
+    std::printf("[ BENCH    ] %-24s%s\n", benchmark.c_str(), line.c_str());
+}
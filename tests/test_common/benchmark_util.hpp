@@ -0,0 +1,36 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <initializer_list>
+#include <string>
+#include <type_traits>
+
+/**
+ * @brief One measurement of a benchmark, printed as `name=value` followed by its unit.
+ *
+ * Integers are printed as they are, floating point values with two decimals.
+ */
+struct BenchmarkValue {
+    template <typename T, typename = typename std::enable_if<std::is_arithmetic<T>::value>::type>
+    BenchmarkValue(const char *name, T value, const char *unit = "") : name(name), value(format(value)), unit(unit) {}
+    BenchmarkValue(const char *name, const std::string &value, const char *unit = "") : name(name), value(value), unit(unit) {}
+
+    std::string name;
+    std::string value;
+    std::string unit;
+
+   private:
+    static std::string format(double value);
+    template <typename T>
+    static std::string format(T value, typename std::enable_if<std::is_integral<T>::value>::type * = nullptr) {
+        return std::to_string(value);
+    }
+};
+
+/**
+ * @brief Prints `values` as a single `[ BENCH    ]` line to stdout, and records each of
+ * them as a property of the running test, named after the benchmark, the value and its unit.
+ */
+void report_benchmark(const std::string &benchmark, std::initializer_list<BenchmarkValue> values);
@@ -0,0 +1,79 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_rgb_matrix_driver.h"
+
+#if defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_CUSTOM)
+#    include <string.h>
+#    include "rgb_matrix.h"
+
+static rgb_t                            rgb_buffer[RGB_MATRIX_LED_COUNT];
+static rgb_t                            rgb_frame[RGB_MATRIX_LED_COUNT];
+static uint32_t                         flush_count;
+static uint32_t                         set_color_count;
+static rgb_matrix_test_flush_callback_t flush_callback;
+
+const rgb_t *rgb_matrix_test_get_buffer(void) {
+    return rgb_buffer;
+}
+
+const rgb_t *rgb_matrix_test_get_frame(void) {
+    return rgb_frame;
+}
+
+uint32_t rgb_matrix_test_get_flush_count(void) {
+    return flush_count;
+}
+
+uint32_t rgb_matrix_test_get_set_color_count(void) {
+    return set_color_count;
+}
+
+void rgb_matrix_test_set_flush_callback(rgb_matrix_test_flush_callback_t callback) {
+    flush_callback = callback;
+}
+
+void rgb_matrix_test_reset(void) {
+    memset(rgb_buffer, 0, sizeof(rgb_buffer));
+    memset(rgb_frame, 0, sizeof(rgb_frame));
+    flush_count     = 0;
+    set_color_count = 0;
+}
+
+static void test_init(void) {
+    rgb_matrix_test_reset();
+}
+
+static void test_set_color(int index, uint8_t r, uint8_t g, uint8_t b) {
+    rgb_buffer[index] = (rgb_t){.r = r, .g = g, .b = b};
+    set_color_count++;
+}
+
+static void test_set_color_all(uint8_t r, uint8_t g, uint8_t b) {
+    for (int i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        test_set_color(i, r, g, b);
+    }
+}
+
+/* Only the given LEDs are copied, so the frame shows anything left out by mistake. */
+static void test_flush_range(int start, int end) {
+    memcpy(&rgb_frame[start], &rgb_buffer[start], (end - start) * sizeof(rgb_t));
+    flush_count++;
+    if (flush_callback) {
+        flush_callback(rgb_frame, RGB_MATRIX_LED_COUNT);
+    }
+}
+
+static void test_flush(void) {
+    test_flush_range(0, RGB_MATRIX_LED_COUNT);
+}
+
+/* Tests can still bring their own driver. */
+__attribute__((weak)) const rgb_matrix_driver_t rgb_matrix_driver = {
+    .init          = test_init,
+    .flush         = test_flush,
+    .set_color     = test_set_color,
+    .set_color_all = test_set_color_all,
+    .flush_range   = test_flush_range,
+};
+#endif
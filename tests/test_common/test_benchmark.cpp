@@ -0,0 +1,122 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_benchmark.hpp"
+#include <algorithm>
+#include <chrono>
+#include "benchmark_util.hpp"
+#include "gmock/gmock.h"
+#include "test_driver.hpp"
+#include "timer.h"
+
+extern "C" {
+#include "keyboard.h"
+void advance_time(uint32_t ms);
+}
+
+using testing::_;
+using testing::AnyNumber;
+using testing::Invoke;
+
+namespace {
+uint32_t percentile(const std::vector<uint32_t>& sorted, unsigned pct) {
+    if (sorted.empty()) {
+        return 0;
+    }
+    size_t index = (sorted.size() * pct + 99) / 100;
+    return sorted[std::min(sorted.size(), std::max<size_t>(index, 1)) - 1];
+}
+} // namespace
+
+void BenchmarkFixture::press(std::vector<BenchmarkEvent>& script, KeymapKey key, unsigned delay_ms) {
+    script.push_back({key, true, delay_ms});
+}
+
+void BenchmarkFixture::release(std::vector<BenchmarkEvent>& script, KeymapKey key, unsigned delay_ms) {
+    script.push_back({key, false, delay_ms});
+}
+
+void BenchmarkFixture::tap(std::vector<BenchmarkEvent>& script, KeymapKey key, unsigned hold_ms, unsigned gap_ms) {
+    press(script, key, hold_ms);
+    release(script, key, gap_ms);
+}
+
+BenchmarkResult BenchmarkFixture::replay(const std::string& name, const std::vector<BenchmarkEvent>& script, unsigned iterations, unsigned settle_ms) {
+    using clock = std::chrono::steady_clock;
+
+    TestDriver            driver;
+    BenchmarkResult       result;
+    std::vector<uint32_t> event_times;
+    std::vector<uint32_t> report_times;
+    std::vector<uint32_t> latencies;
+    clock::duration       cpu_event  = clock::duration::zero();
+    clock::duration       cpu_idle   = clock::duration::zero();
+    clock::duration       cpu_max    = clock::duration::zero();
+    uint32_t              idle_scans = 0;
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber()).WillRepeatedly(Invoke([&](report_keyboard_t&) { report_times.push_back(timer_read32()); }));
+
+    /* The first scan after a matrix change is the one that processes it, the rest are idle. */
+    auto scan = [&](unsigned loops, bool has_event) {
+        for (unsigned i = 0; i < loops; i++) {
+            auto start = clock::now();
+            keyboard_task();
+            auto elapsed = clock::now() - start;
+            if (has_event && i == 0) {
+                cpu_event += elapsed;
+            } else {
+                cpu_idle += elapsed;
+                idle_scans++;
+            }
+            cpu_max = std::max(cpu_max, elapsed);
+            housekeeping_task();
+            advance_time(1);
+        }
+    };
+
+    for (unsigned iteration = 0; iteration < iterations; iteration++) {
+        for (auto event : script) {
+            if (event.pressed) {
+                event.key.press();
+                result.keystrokes++;
+            } else {
+                event.key.release();
+            }
+            event_times.push_back(timer_read32());
+            scan(std::max(event.delay_ms, 1u), true);
+        }
+        scan(settle_ms, false);
+        /* The per-test log is only useful on failure and grows without bound otherwise. */
+        test_logger.reset();
+    }
+
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    /* Reports arrive in time order, so each event is answered by the first report at or after it. */
+    auto next_report = report_times.begin();
+    for (uint32_t event_time : event_times) {
+        next_report = std::lower_bound(next_report, report_times.end(), event_time);
+        if (next_report == report_times.end()) {
+            result.unanswered++;
+            continue;
+        }
+        latencies.push_back(*next_report - event_time);
+    }
+    std::sort(latencies.begin(), latencies.end());
+
+    result.name                  = name;
+    result.events                = event_times.size();
+    result.reports               = report_times.size();
+    result.cpu_ns_per_event      = result.events ? std::chrono::duration<double, std::nano>(cpu_event).count() / result.events : 0;
+    result.cpu_ns_per_idle_scan  = idle_scans ? std::chrono::duration<double, std::nano>(cpu_idle).count() / idle_scans : 0;
+    result.cpu_ns_max_scan       = std::chrono::duration<double, std::nano>(cpu_max).count();
+    result.latency_p50_ms        = percentile(latencies, 50);
+    result.latency_p99_ms        = percentile(latencies, 99);
+    result.latency_max_ms        = latencies.empty() ? 0 : latencies.back();
+    result.reports_per_keystroke = result.keystrokes ? static_cast<double>(result.reports) / result.keystrokes : 0;
+    return result;
+}
+
+void BenchmarkFixture::report(const BenchmarkResult& result) {
+    report_benchmark(result.name, {{"events", result.events}, {"cpu/event", result.cpu_ns_per_event, "ns"}, {"cpu/idle-scan", result.cpu_ns_per_idle_scan, "ns"}, {"max-scan", result.cpu_ns_max_scan, "ns"}, {"p50", result.latency_p50_ms, "ms"}, {"p99", result.latency_p99_ms, "ms"}, {"max", result.latency_max_ms, "ms"}, {"reports/keystroke", result.reports_per_keystroke}, {"unanswered", result.unanswered}});
+}
@@ -0,0 +1,80 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+extern "C" {
+#include "action.h"
+#include "action_tapping.h"
+}
+
+/**
+ * @brief A single scripted matrix change, followed by `delay_ms` of idle scan loops.
+ */
+struct BenchmarkEvent {
+    KeymapKey key;
+    bool      pressed;
+    unsigned  delay_ms;
+};
+
+/**
+ * @brief Aggregated result of replaying a key script through `keyboard_task()`.
+ *
+ * Latency is measured in simulated milliseconds, from the scan loop that observes a
+ * matrix change to the next keyboard report handed to the `TestDriver`. CPU cost is
+ * host wall-clock time spent inside `keyboard_task()`, split into the scan that
+ * processes a matrix change and the idle scans in between, and is only meaningful
+ * when compared against other runs on the same machine.
+ */
+struct BenchmarkResult {
+    std::string name;
+    uint32_t    events                = 0;
+    uint32_t    keystrokes            = 0;
+    uint32_t    reports               = 0;
+    uint32_t    unanswered            = 0;
+    double      cpu_ns_per_event      = 0;
+    double      cpu_ns_per_idle_scan  = 0;
+    double      cpu_ns_max_scan       = 0;
+    uint32_t    latency_p50_ms        = 0;
+    uint32_t    latency_p99_ms        = 0;
+    uint32_t    latency_max_ms        = 0;
+    double      reports_per_keystroke = 0;
+};
+
+class BenchmarkFixture : public TestFixture {
+   public:
+    /**
+     * @brief Appends a press of `key` followed by `delay_ms` of scan loops to `script`.
+     */
+    static void press(std::vector<BenchmarkEvent>& script, KeymapKey key, unsigned delay_ms = 1);
+
+    /**
+     * @brief Appends a release of `key` followed by `delay_ms` of scan loops to `script`.
+     */
+    static void release(std::vector<BenchmarkEvent>& script, KeymapKey key, unsigned delay_ms = 1);
+
+    /**
+     * @brief Appends a tap of `key`, held for `hold_ms` and followed by `gap_ms` of idle time.
+     */
+    static void tap(std::vector<BenchmarkEvent>& script, KeymapKey key, unsigned hold_ms = 1, unsigned gap_ms = 1);
+
+    /**
+     * @brief Replays `script` `iterations` times and collects latency and CPU statistics.
+     *
+     * The script must leave every key released. After each iteration the keyboard is
+     * idled for `settle_ms` so that pending tap-hold, combo and autocorrect decisions
+     * are resolved before the next iteration starts.
+     */
+    BenchmarkResult replay(const std::string& name, const std::vector<BenchmarkEvent>& script, unsigned iterations = 100, unsigned settle_ms = TAPPING_TERM * 2);
+
+    /**
+     * @brief Prints `result` and records it as test properties, see `report_benchmark()`.
+     */
+    void report(const BenchmarkResult& result);
+};
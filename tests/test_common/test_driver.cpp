@@ -32,6 +32,7 @@ uint8_t hex_digit_to_keycode(uint8_t digit) {
 } // namespace
 
 TestDriver::TestDriver() : m_driver{&TestDriver::keyboard_leds, &TestDriver::send_keyboard, &TestDriver::send_nkro, &TestDriver::send_mouse, &TestDriver::send_extra} {
+    m_driver.can_send = &TestDriver::can_send;
     host_set_driver(&m_driver);
     m_this = this;
 }
@@ -44,6 +45,10 @@ uint8_t TestDriver::keyboard_leds(void) {
     return m_this->m_leds;
 }
 
+bool TestDriver::can_send(uint8_t report_id) {
+    return m_this->m_ready;
+}
+
 void TestDriver::send_keyboard(report_keyboard_t* report) {
     test_logger.trace() << *report;
     m_this->send_keyboard_mock(*report);
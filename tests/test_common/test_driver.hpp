@@ -32,6 +32,10 @@ class TestDriver {
     void set_leds(uint8_t leds) {
         m_leds = leds;
     }
+    // Whether the driver accepts reports right away, rather than asking the report queue to wait
+    void set_ready(bool ready) {
+        m_ready = ready;
+    }
 
     MOCK_METHOD1(send_keyboard_mock, void(report_keyboard_t&));
     MOCK_METHOD1(send_nkro_mock, void(report_nkro_t&));
@@ -44,8 +48,10 @@ class TestDriver {
     static void        send_nkro(report_nkro_t* report);
     static void        send_mouse(report_mouse_t* report);
     static void        send_extra(report_extra_t* report);
+    static bool        can_send(uint8_t report_id);
     host_driver_t      m_driver;
-    uint8_t            m_leds = 0;
+    uint8_t            m_leds  = 0;
+    bool               m_ready = true;
     static TestDriver* m_this;
 };
 
@@ -23,6 +23,7 @@ extern "C" {
 #include "debug.h"
 #include "eeconfig.h"
 #include "keyboard.h"
+#include "task_deadline.h"
 
 void set_time(uint32_t t);
 void advance_time(uint32_t ms);
@@ -59,6 +60,12 @@ void TestFixture::TearDownTestCase() {}
 TestFixture::TestFixture() {
     m_this = this;
     timer_clear();
+    /* Deadlines published by the previous test refer to the old timeline. */
+    task_deadline_wake_all();
+#if !defined(NO_ACTION_LAYER) && defined(LAYER_RESOLUTION_CACHE)
+    /* Layers resolved by the previous test refer to its keymap. */
+    layer_resolution_cache_clear();
+#endif
     keyrecord_t empty_keyrecord = {0};
     test_logger.info() << "tapping term is " << +GET_TAPPING_TERM(KC_TRANSPARENT, &empty_keyrecord) << "ms" << std::endl;
 }
@@ -104,6 +111,9 @@ void TestFixture::add_key(KeymapKey key) {
     }
 
     this->keymap.push_back(key);
+#if !defined(NO_ACTION_LAYER) && defined(LAYER_RESOLUTION_CACHE)
+    layer_resolution_cache_clear();
+#endif
 }
 
 void TestFixture::tap_key(KeymapKey key, unsigned delay_ms) {
@@ -131,6 +141,9 @@ void TestFixture::tap_combo(const std::vector<KeymapKey>& chord_keys, unsigned d
 
 void TestFixture::set_keymap(std::initializer_list<KeymapKey> keys) {
     this->keymap.clear();
+#if !defined(NO_ACTION_LAYER) && defined(LAYER_RESOLUTION_CACHE)
+    layer_resolution_cache_clear();
+#endif
     for (auto& key : keys) {
         add_key(key);
     }
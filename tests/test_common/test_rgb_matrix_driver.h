@@ -0,0 +1,32 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include "color.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef void (*rgb_matrix_test_flush_callback_t)(const rgb_t *frame, uint8_t count);
+
+/* Colours set since the last flush, as held in the PWM buffer of a real driver. */
+const rgb_t *rgb_matrix_test_get_buffer(void);
+
+/* Colours of the last flushed frame, as shown by the LEDs. */
+const rgb_t *rgb_matrix_test_get_frame(void);
+
+uint32_t rgb_matrix_test_get_flush_count(void);
+uint32_t rgb_matrix_test_get_set_color_count(void);
+
+/* Called with every flushed frame, NULL to stop capturing. */
+void rgb_matrix_test_set_flush_callback(rgb_matrix_test_flush_callback_t callback);
+
+/* Blanks the buffer and the frame, and clears the counters. Done by the driver init. */
+void rgb_matrix_test_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,174 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_rolls.hpp"
+#include <algorithm>
+#include <iterator>
+#include <map>
+#include <utility>
+#include "gmock/gmock.h"
+#include "test_driver.hpp"
+
+extern "C" {
+#include "action.h"
+#include "action_tapping.h"
+#include "keycode_string.h"
+#include "quantum_keycodes.h"
+}
+
+using testing::_;
+using testing::AnyNumber;
+using testing::Invoke;
+
+namespace {
+// clang-format off
+const uint16_t layer1_keycodes[] = {
+    KC_1,    KC_2,    KC_3,    KC_4,    KC_5,    KC_6,    KC_7,    KC_8,    KC_9,    KC_0,
+    KC_TRNS, KC_TRNS, KC_TRNS, KC_LEFT, KC_DOWN, KC_UP,   KC_RGHT, KC_TRNS, KC_TRNS, KC_TRNS,
+    KC_MINS, KC_TRNS, KC_TRNS,
+};
+// clang-format on
+
+const char* const mod_names[] = {"LCTL", "LSFT", "LALT", "LGUI", "RCTL", "RSFT", "RALT", "RGUI"};
+
+bool has_key(const report_keyboard_t& report, uint8_t keycode) {
+    for (uint8_t key : report.keys) {
+        if (key == keycode) return true;
+    }
+    return false;
+}
+
+/* Calls `pressed` with every key that goes down in a report, and the report it goes down in. */
+template <typename F>
+void for_each_key_down(const RollResult& roll, F pressed) {
+    report_keyboard_t previous = {};
+    for (auto& report : roll.reports) {
+        for (uint8_t key : report.keys) {
+            if (key != KC_NO && !has_key(previous, key)) {
+                pressed(key, report);
+            }
+        }
+        previous = report;
+    }
+}
+
+uint16_t tap_keycode(uint16_t keycode) {
+    if (IS_QK_MOD_TAP(keycode)) return QK_MOD_TAP_GET_TAP_KEYCODE(keycode);
+    if (IS_QK_LAYER_TAP(keycode)) return QK_LAYER_TAP_GET_TAP_KEYCODE(keycode);
+    return KC_NO;
+}
+} // namespace
+
+RollResult RollFixture::type_roll(uint32_t seed, uint32_t keystrokes) {
+    // clang-format off
+    std::vector<KeymapKey> layout = {
+        KeymapKey(0, 0, 0, KC_Q),         KeymapKey(0, 1, 0, KC_W),         KeymapKey(0, 2, 0, KC_E),        KeymapKey(0, 3, 0, KC_R),          KeymapKey(0, 4, 0, KC_T),
+        KeymapKey(0, 5, 0, KC_Y),         KeymapKey(0, 6, 0, KC_U),         KeymapKey(0, 7, 0, KC_I),        KeymapKey(0, 8, 0, KC_O),          KeymapKey(0, 9, 0, KC_P),
+        KeymapKey(0, 0, 1, LSFT_T(KC_A)), KeymapKey(0, 1, 1, LCTL_T(KC_S)), KeymapKey(0, 2, 1, LT(1, KC_D)), KeymapKey(0, 3, 1, KC_F),          KeymapKey(0, 4, 1, KC_G),
+        KeymapKey(0, 5, 1, KC_H),         KeymapKey(0, 6, 1, KC_J),         KeymapKey(0, 7, 1, LT(1, KC_K)), KeymapKey(0, 8, 1, RCTL_T(KC_L)),  KeymapKey(0, 9, 1, RSFT_T(KC_SCLN)),
+        KeymapKey(0, 0, 2, KC_Z),         KeymapKey(0, 4, 2, KC_SPC),       KeymapKey(0, 5, 2, LT(1, KC_ENT)),
+    };
+    // clang-format on
+    keys.clear();
+    set_keymap({});
+    for (auto& key : layout) {
+        keys.push_back(key);
+    }
+    for (size_t k = 0; k < keys.size(); k++) {
+        add_key(keys[k]);
+        add_key(KeymapKey(1, keys[k].position.col, keys[k].position.row, layer1_keycodes[k]));
+    }
+
+    TestDriver driver;
+    RollResult roll;
+    roll.keystrokes.assign(keys.size(), 0);
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber()).WillRepeatedly(Invoke([&](report_keyboard_t& report) { roll.reports.push_back(report); }));
+
+    uint32_t rng    = seed;
+    auto     random = [&](uint32_t range) {
+        rng = rng * 1664525 + 1013904223;
+        return (rng >> 8) % range;
+    };
+    std::vector<std::vector<std::pair<size_t, bool>>> events;
+    std::vector<uint32_t>                             released_at(keys.size(), 0);
+    uint32_t                                          time = 0;
+    for (uint32_t n = 0; n < keystrokes; n++) {
+        time += 20 + random(80);
+        size_t k;
+        do {
+            k = random(keys.size());
+        } while (released_at[k] >= time);
+        released_at[k] = time + 40 + random(180);
+        if (events.size() <= released_at[k]) {
+            events.resize(released_at[k] + 1);
+        }
+        events[time].push_back({k, true});
+        events[released_at[k]].push_back({k, false});
+        roll.keystrokes[k]++;
+    }
+
+    for (auto& scan : events) {
+        for (auto& event : scan) {
+            if (event.second) {
+                keys[event.first].press();
+            } else {
+                keys[event.first].release();
+            }
+        }
+        run_one_scan_loop();
+    }
+    idle_for(TAPPING_TERM + 1);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    // One word is five keystrokes.
+    roll.wpm = keystrokes * 60000 / 5 / time;
+    return roll;
+}
+
+std::string RollFixture::chords(const RollResult& roll) {
+    std::string typed;
+    for_each_key_down(roll, [&](uint8_t key, const report_keyboard_t& report) {
+        bool layer1 = std::find(std::begin(layer1_keycodes), std::end(layer1_keycodes), key) != std::end(layer1_keycodes);
+        if (report.mods == 0 && !layer1) return;
+        if (!typed.empty()) typed += ' ';
+        for (uint8_t mod = 0; mod < 8; mod++) {
+            if (report.mods & (1 << mod)) {
+                typed += mod_names[mod];
+                typed += '+';
+            }
+        }
+        std::string name = get_keycode_string(key);
+        typed += name.compare(0, 3, "KC_") == 0 ? name.substr(3) : name;
+    });
+    return typed;
+}
+
+uint32_t RollFixture::lost_keystrokes(const RollResult& roll) {
+    std::map<uint8_t, uint32_t> sent;
+    for_each_key_down(roll, [&](uint8_t key, const report_keyboard_t&) { sent[key]++; });
+
+    uint32_t lost = 0;
+    for (size_t k = 0; k < keys.size(); k++) {
+        uint16_t tap = tap_keycode(keys[k].code);
+        if (tap != KC_NO) {
+            EXPECT_LE(sent[tap], roll.keystrokes[k]) << keys[k].name << " was tapped more often than typed";
+            continue;
+        }
+        uint32_t both_layers = sent[keys[k].code];
+        if (layer1_keycodes[k] != KC_TRNS) {
+            both_layers += sent[layer1_keycodes[k]];
+        }
+        EXPECT_LE(both_layers, roll.keystrokes[k]) << keys[k].name << " was sent more often than typed";
+        lost += roll.keystrokes[k] - std::min(both_layers, roll.keystrokes[k]);
+    }
+
+    EXPECT_FALSE(roll.reports.empty());
+    if (!roll.reports.empty()) {
+        const report_keyboard_t& last = roll.reports.back();
+        EXPECT_EQ(last.mods, 0) << "a modifier is still held on the host";
+        for (uint8_t key : last.keys) {
+            EXPECT_EQ(key, KC_NO) << "a key is still held on the host";
+        }
+    }
+    return lost;
+}
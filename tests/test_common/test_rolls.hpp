@@ -0,0 +1,59 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+extern "C" {
+#include "report.h"
+}
+
+/**
+ * @brief What the host got from a roll typed by `RollFixture::type_roll()`.
+ */
+struct RollResult {
+    uint32_t                       wpm = 0;
+    std::vector<report_keyboard_t> reports;
+    /** Number of keystrokes of each key of the roll layout, in `RollFixture::keys` order. */
+    std::vector<uint32_t> keystrokes;
+};
+
+/**
+ * @brief Types pseudo-random overlapping rolls of home row mods, layer-taps and plain keys.
+ *
+ * The layout is a 23 key split with mod-taps on A, S, L and ;, layer-taps on D, K and
+ * Enter, and numbers, arrows and - on layer 1. Presses are 20-99 ms apart and each is
+ * held for 40-219 ms, so up to a handful of keys overlap at any time, at well over
+ * 100 wpm.
+ */
+class RollFixture : public TestFixture {
+   public:
+    std::vector<KeymapKey> keys;
+
+    /**
+     * @brief Types `keystrokes` keys from the sequence given by `seed`, and idles past the tapping term.
+     */
+    RollResult type_roll(uint32_t seed, uint32_t keystrokes);
+
+    /**
+     * @brief The keys the host saw go down with a modifier held, or from layer 1, in order.
+     *
+     * These are the keys typed while a tap-hold key was settled as held. Keys are written
+     * without their `KC_` prefix and separated by spaces, with held modifiers in front, as
+     * in `LSFT+E`.
+     */
+    std::string chords(const RollResult& roll);
+
+    /**
+     * @brief Counts the keystrokes of plain keys that never reached the host, on either layer.
+     *
+     * Also checks that no key reached the host more often than it was typed, tap-hold
+     * keys included, and that the host ends up with every key and modifier released.
+     */
+    uint32_t lost_keystrokes(const RollResult& roll);
+};
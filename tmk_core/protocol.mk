@@ -58,6 +58,10 @@ ifeq ($(strip $(USB_WAIT_FOR_ENUMERATION)), yes)
     OPT_DEFS += -DUSB_WAIT_FOR_ENUMERATION
 endif
 
+ifeq ($(strip $(HOST_REPORT_QUEUE_ENABLE)), yes)
+    OPT_DEFS += -DHOST_REPORT_QUEUE_ENABLE
+endif
+
 ifeq ($(strip $(JOYSTICK_SHARED_EP)), yes)
     OPT_DEFS += -DJOYSTICK_SHARED_EP
     SHARED_EP_ENABLE = yes
@@ -63,6 +63,7 @@ void send_keyboard(report_keyboard_t *report);
 void send_nkro(report_nkro_t *report);
 void send_mouse(report_mouse_t *report);
 void send_extra(report_extra_t *report);
+bool can_send(uint8_t report_id);
 void send_raw_hid(uint8_t *data, uint8_t length);
 
 /* host struct */
@@ -72,6 +73,7 @@ host_driver_t chibios_driver = {
     .send_nkro     = send_nkro,
     .send_mouse    = send_mouse,
     .send_extra    = send_extra,
+    .can_send      = can_send,
 #ifdef RAW_ENABLE
     .send_raw_hid = send_raw_hid,
 #endif
@@ -320,6 +320,17 @@ bool usb_endpoint_in_is_inactive(usb_endpoint_in_t *endpoint) {
     return inactive;
 }
 
+bool usb_endpoint_in_is_full(usb_endpoint_in_t *endpoint) {
+    osalDbgCheck(endpoint != NULL);
+
+    osalSysLock();
+    // Sending to an inactive driver fails right away, so it never has to wait
+    bool full = usbGetDriverStateI(endpoint->config.usbp) == USB_ACTIVE && obqIsFullI(&endpoint->obqueue);
+    osalSysUnlock();
+
+    return full;
+}
+
 bool usb_endpoint_out_receive(usb_endpoint_out_t *endpoint, uint8_t *data, size_t size, sysinterval_t timeout) {
     osalDbgCheck((endpoint != NULL) && (data != NULL) && (size > 0U));
 
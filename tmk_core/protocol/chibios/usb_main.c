@@ -434,6 +434,22 @@ static bool receive_report(usb_endpoint_out_lut_t endpoint, void *report, size_t
     return usb_endpoint_out_receive(&usb_endpoints_out[endpoint], (uint8_t *)report, size, TIME_IMMEDIATE);
 }
 
+bool can_send(uint8_t report_id) {
+    switch (report_id) {
+        case REPORT_ID_KEYBOARD:
+            return !usb_endpoint_in_is_full(&usb_endpoints_in[USB_ENDPOINT_IN_KEYBOARD]);
+#ifdef NKRO_ENABLE
+        case REPORT_ID_NKRO:
+            return !usb_endpoint_in_is_full(&usb_endpoints_in[USB_ENDPOINT_IN_SHARED]);
+#endif
+#ifdef MOUSE_ENABLE
+        case REPORT_ID_MOUSE:
+            return !usb_endpoint_in_is_full(&usb_endpoints_in[USB_ENDPOINT_IN_MOUSE]);
+#endif
+    }
+    return true;
+}
+
 void send_keyboard(report_keyboard_t *report) {
     /* If we're in Boot Protocol, don't send any report ID or other funky fields */
     if (usb_device_state_get_protocol() == USB_PROTOCOL_BOOT) {
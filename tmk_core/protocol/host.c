@@ -16,6 +16,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 */
 
 #include <stdint.h>
+#include <string.h>
 #include "keyboard.h"
 #include "keycode.h"
 #include "host.h"
@@ -134,13 +135,7 @@ led_t host_keyboard_led_state(void) {
 }
 
 /* send report */
-void host_keyboard_send(report_keyboard_t *report) {
-    host_driver_t *driver = host_get_active_driver();
-    if (!driver || !driver->send_keyboard) return;
-
-#ifdef KEYBOARD_SHARED_EP
-    report->report_id = REPORT_ID_KEYBOARD;
-#endif
+static void host_keyboard_send_now(host_driver_t *driver, report_keyboard_t *report) {
     (*driver->send_keyboard)(report);
 
     if (debug_keyboard) {
@@ -152,11 +147,7 @@ void host_keyboard_send(report_keyboard_t *report) {
     }
 }
 
-void host_nkro_send(report_nkro_t *report) {
-    host_driver_t *driver = host_get_active_driver();
-    if (!driver || !driver->send_nkro) return;
-
-    report->report_id = REPORT_ID_NKRO;
+static void host_nkro_send_now(host_driver_t *driver, report_nkro_t *report) {
     (*driver->send_nkro)(report);
 
     if (debug_keyboard) {
@@ -168,6 +159,247 @@ void host_nkro_send(report_nkro_t *report) {
     }
 }
 
+static void host_mouse_send_now(host_driver_t *driver, report_mouse_t *report) {
+#ifdef MOUSE_EXTENDED_REPORT
+    // clip and copy to Boot protocol XY
+    report->boot_x = (report->x > 127) ? 127 : ((report->x < -127) ? -127 : report->x);
+    report->boot_y = (report->y > 127) ? 127 : ((report->y < -127) ? -127 : report->y);
+#endif
+    (*driver->send_mouse)(report);
+}
+
+#ifdef HOST_REPORT_QUEUE_ENABLE
+typedef struct {
+    uint8_t report_id; // REPORT_ID_KEYBOARD, REPORT_ID_NKRO or REPORT_ID_MOUSE
+    union {
+        report_keyboard_t keyboard;
+        report_nkro_t     nkro;
+        report_mouse_t    mouse;
+    };
+} host_report_t;
+
+static host_report_t             report_queue[HOST_REPORT_QUEUE_SIZE];
+static uint8_t                   report_queue_head  = 0;
+static uint8_t                   report_queue_count = 0;
+static host_report_queue_stats_t report_queue_stats;
+// The keyboard and NKRO reports last handed to the driver
+static report_keyboard_t last_keyboard_report;
+static report_nkro_t     last_nkro_report;
+
+static host_report_t *report_queue_at(uint8_t index) {
+    return &report_queue[(report_queue_head + index) % HOST_REPORT_QUEUE_SIZE];
+}
+
+/** \brief Hands the oldest queued report to the driver.
+ *
+ * \param force Send it even if the driver is not ready, which makes the driver wait as it would without the queue.
+ * \return false if the driver is not ready.
+ */
+static bool host_report_queue_send_next(bool force) {
+    host_report_t *report = report_queue_at(0);
+    host_driver_t *driver = host_get_active_driver();
+
+    if (driver && !force && driver->can_send && !(*driver->can_send)(report->report_id)) {
+        report_queue_stats.deferred++;
+        return false;
+    }
+
+    report_queue_head = (report_queue_head + 1) % HOST_REPORT_QUEUE_SIZE;
+    report_queue_count--;
+
+    switch (driver ? report->report_id : 0) {
+        case REPORT_ID_KEYBOARD:
+            if (!driver->send_keyboard) break;
+            last_keyboard_report = report->keyboard;
+            host_keyboard_send_now(driver, &report->keyboard);
+            report_queue_stats.sent++;
+            return true;
+        case REPORT_ID_NKRO:
+            if (!driver->send_nkro) break;
+            last_nkro_report = report->nkro;
+            host_nkro_send_now(driver, &report->nkro);
+            report_queue_stats.sent++;
+            return true;
+        case REPORT_ID_MOUSE:
+            if (!driver->send_mouse) break;
+            host_mouse_send_now(driver, &report->mouse);
+            report_queue_stats.sent++;
+            return true;
+    }
+    report_queue_stats.dropped++;
+    return true;
+}
+
+/** \brief Whether every key held in `a` is also held in `b`, leaving the modifiers aside. */
+static bool keyboard_report_keys_subset(const report_keyboard_t *a, const report_keyboard_t *b) {
+    for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+        if (a->keys[i] == KC_NO) continue;
+        uint8_t j = 0;
+        while (j < KEYBOARD_REPORT_KEYS && b->keys[j] != a->keys[i]) {
+            j++;
+        }
+        if (j == KEYBOARD_REPORT_KEYS) return false;
+    }
+    return true;
+}
+
+static bool keyboard_report_keys_equal(const report_keyboard_t *a, const report_keyboard_t *b) {
+    return keyboard_report_keys_subset(a, b) && keyboard_report_keys_subset(b, a);
+}
+
+static bool nkro_report_keys_subset(const report_nkro_t *a, const report_nkro_t *b) {
+    for (uint8_t i = 0; i < NKRO_REPORT_BITS; i++) {
+        if (a->bits[i] & ~b->bits[i]) return false;
+    }
+    return true;
+}
+
+static bool nkro_report_keys_equal(const report_nkro_t *a, const report_nkro_t *b) {
+    return memcmp(a->bits, b->bits, NKRO_REPORT_BITS) == 0;
+}
+
+/** \brief Whether going from `before` to `queued` to `next` only releases keys, or only releases modifiers.
+ *
+ * Releases type nothing, so the host ends up with the same text whether it sees
+ * them one at a time or all at once. Presses are never merged: which key went
+ * down first, and whether a modifier was down at the time, is what gets typed.
+ */
+static bool report_only_releases(uint8_t mods_before, uint8_t mods_queued, uint8_t mods_next, bool keys_released, bool keys_unchanged) {
+    if (mods_before == mods_queued && mods_queued == mods_next) return keys_released;
+    return keys_unchanged && (mods_queued & ~mods_before) == 0 && (mods_next & ~mods_queued) == 0;
+}
+
+/** \brief Finds the report of the same type that the host has, or will have, before the queued one at `index`. */
+static const host_report_t *report_queue_previous(uint8_t index) {
+    uint8_t report_id = report_queue_at(index)->report_id;
+    while (index-- > 0) {
+        if (report_queue_at(index)->report_id == report_id) {
+            return report_queue_at(index);
+        }
+    }
+    return NULL;
+}
+
+/** \brief Merges `next` into the last queued report, if the host would not tell the difference.
+ *
+ * Keyboard reports are merged when the next one repeats the queued one, or when
+ * both only release keys, or both only release modifiers, from the report before
+ * the queued one. Mouse reports are merged while the buttons do not change, by
+ * adding up the movement.
+ */
+static bool host_report_queue_coalesce(const host_report_t *next) {
+    if (report_queue_count == 0) return false;
+
+    host_report_t *queued = report_queue_at(report_queue_count - 1);
+    if (queued->report_id != next->report_id) return false;
+
+    const host_report_t *previous = report_queue_previous(report_queue_count - 1);
+    switch (next->report_id) {
+        case REPORT_ID_KEYBOARD: {
+            const report_keyboard_t *before    = previous ? &previous->keyboard : &last_keyboard_report;
+            bool                     repeat    = queued->keyboard.mods == next->keyboard.mods && keyboard_report_keys_equal(&queued->keyboard, &next->keyboard);
+            bool                     released  = keyboard_report_keys_subset(&queued->keyboard, before) && keyboard_report_keys_subset(&next->keyboard, &queued->keyboard);
+            bool                     unchanged = keyboard_report_keys_equal(before, &queued->keyboard) && keyboard_report_keys_equal(&queued->keyboard, &next->keyboard);
+            if (!repeat && !report_only_releases(before->mods, queued->keyboard.mods, next->keyboard.mods, released, unchanged)) return false;
+            queued->keyboard = next->keyboard;
+            return true;
+        }
+        case REPORT_ID_NKRO: {
+            const report_nkro_t *before    = previous ? &previous->nkro : &last_nkro_report;
+            bool                 repeat    = queued->nkro.mods == next->nkro.mods && nkro_report_keys_equal(&queued->nkro, &next->nkro);
+            bool                 released  = nkro_report_keys_subset(&queued->nkro, before) && nkro_report_keys_subset(&next->nkro, &queued->nkro);
+            bool                 unchanged = nkro_report_keys_equal(before, &queued->nkro) && nkro_report_keys_equal(&queued->nkro, &next->nkro);
+            if (!repeat && !report_only_releases(before->mods, queued->nkro.mods, next->nkro.mods, released, unchanged)) return false;
+            queued->nkro = next->nkro;
+            return true;
+        }
+        case REPORT_ID_MOUSE: {
+            if (queued->mouse.buttons != next->mouse.buttons) return false;
+            int32_t x = (int32_t)queued->mouse.x + next->mouse.x;
+            int32_t y = (int32_t)queued->mouse.y + next->mouse.y;
+            int32_t v = (int32_t)queued->mouse.v + next->mouse.v;
+            int32_t h = (int32_t)queued->mouse.h + next->mouse.h;
+            if (x < MOUSE_REPORT_XY_MIN || x > MOUSE_REPORT_XY_MAX || y < MOUSE_REPORT_XY_MIN || y > MOUSE_REPORT_XY_MAX) return false;
+            if (v < MOUSE_REPORT_HV_MIN || v > MOUSE_REPORT_HV_MAX || h < MOUSE_REPORT_HV_MIN || h > MOUSE_REPORT_HV_MAX) return false;
+            queued->mouse.x = x;
+            queued->mouse.y = y;
+            queued->mouse.v = v;
+            queued->mouse.h = h;
+            return true;
+        }
+    }
+    return false;
+}
+
+static void host_report_queue_push(const host_report_t *report) {
+    if (host_report_queue_coalesce(report)) {
+        report_queue_stats.coalesced++;
+    } else {
+        if (report_queue_count == HOST_REPORT_QUEUE_SIZE) {
+            // Make room by waiting on the driver, as without the queue
+            report_queue_stats.forced++;
+            host_report_queue_send_next(true);
+        }
+        *report_queue_at(report_queue_count++) = *report;
+        if (report_queue_count > report_queue_stats.max_depth) {
+            report_queue_stats.max_depth = report_queue_count;
+        }
+    }
+    host_report_queue_task();
+}
+
+uint8_t host_report_queue_pending(void) {
+    return report_queue_count;
+}
+
+void host_report_queue_task(void) {
+    while (report_queue_count > 0 && host_report_queue_send_next(false)) {
+    }
+}
+
+void host_report_queue_flush(void) {
+    while (report_queue_count > 0) {
+        host_report_queue_send_next(true);
+    }
+}
+
+void host_report_queue_get_stats(host_report_queue_stats_t *stats) {
+    *stats = report_queue_stats;
+}
+
+void host_report_queue_clear_stats(void) {
+    memset(&report_queue_stats, 0, sizeof(report_queue_stats));
+}
+#endif
+
+void host_keyboard_send(report_keyboard_t *report) {
+    host_driver_t *driver = host_get_active_driver();
+    if (!driver || !driver->send_keyboard) return;
+
+#ifdef KEYBOARD_SHARED_EP
+    report->report_id = REPORT_ID_KEYBOARD;
+#endif
+#ifdef HOST_REPORT_QUEUE_ENABLE
+    host_report_t queued = {.report_id = REPORT_ID_KEYBOARD, .keyboard = *report};
+    host_report_queue_push(&queued);
+#else
+    host_keyboard_send_now(driver, report);
+#endif
+}
+
+void host_nkro_send(report_nkro_t *report) {
+    host_driver_t *driver = host_get_active_driver();
+    if (!driver || !driver->send_nkro) return;
+
+    report->report_id = REPORT_ID_NKRO;
+#ifdef HOST_REPORT_QUEUE_ENABLE
+    host_report_t queued = {.report_id = REPORT_ID_NKRO, .nkro = *report};
+    host_report_queue_push(&queued);
+#else
+    host_nkro_send_now(driver, report);
+#endif
+}
+
 void host_mouse_send(report_mouse_t *report) {
     host_driver_t *driver = host_get_active_driver();
     if (!driver || !driver->send_mouse) return;
@@ -175,12 +407,12 @@ void host_mouse_send(report_mouse_t *report) {
 #ifdef MOUSE_SHARED_EP
     report->report_id = REPORT_ID_MOUSE;
 #endif
-#ifdef MOUSE_EXTENDED_REPORT
-    // clip and copy to Boot protocol XY
-    report->boot_x = (report->x > 127) ? 127 : ((report->x < -127) ? -127 : report->x);
-    report->boot_y = (report->y > 127) ? 127 : ((report->y < -127) ? -127 : report->y);
+#ifdef HOST_REPORT_QUEUE_ENABLE
+    host_report_t queued = {.report_id = REPORT_ID_MOUSE, .mouse = *report};
+    host_report_queue_push(&queued);
+#else
+    host_mouse_send_now(driver, report);
 #endif
-    (*driver->send_mouse)(report);
 }
 
 void host_system_send(uint16_t usage) {
@@ -46,6 +46,28 @@ void    host_raw_hid_send(uint8_t *data, uint8_t length);
 uint16_t host_last_system_usage(void);
 uint16_t host_last_consumer_usage(void);
 
+#ifdef HOST_REPORT_QUEUE_ENABLE
+/* report queue */
+#    ifndef HOST_REPORT_QUEUE_SIZE
+#        define HOST_REPORT_QUEUE_SIZE 8
+#    endif
+
+typedef struct {
+    uint32_t sent;      // Reports handed to the driver
+    uint32_t coalesced; // Reports merged into one still queued
+    uint32_t deferred;  // Times the driver was not ready for the next queued report
+    uint32_t forced;    // Reports sent while the driver was not ready, because the queue was full
+    uint32_t dropped;   // Queued reports discarded because no driver could send them
+    uint8_t  max_depth; // Most reports queued at once
+} host_report_queue_stats_t;
+
+uint8_t host_report_queue_pending(void);
+void    host_report_queue_task(void);
+void    host_report_queue_flush(void);
+void    host_report_queue_get_stats(host_report_queue_stats_t *stats);
+void    host_report_queue_clear_stats(void);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
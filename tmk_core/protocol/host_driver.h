@@ -17,6 +17,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #pragma once
 
+#include <stdbool.h>
 #include <stdint.h>
 #include "report.h"
 #ifdef MIDI_ENABLE
@@ -29,6 +30,8 @@ typedef struct {
     void (*send_nkro)(report_nkro_t *);
     void (*send_mouse)(report_mouse_t *);
     void (*send_extra)(report_extra_t *);
+    /* Whether a report with the given ID can be sent without waiting, may be NULL */
+    bool (*can_send)(uint8_t report_id);
 #ifdef RAW_ENABLE
     void (*send_raw_hid)(uint8_t *, uint8_t);
 #endif
@@ -76,6 +76,7 @@ static void send_keyboard(report_keyboard_t *report);
 static void send_nkro(report_nkro_t *report);
 static void send_mouse(report_mouse_t *report);
 static void send_extra(report_extra_t *report);
+static bool can_send(uint8_t report_id);
 #ifdef RAW_ENABLE
 static void send_raw_hid(uint8_t *data, uint8_t length);
 #endif
@@ -86,6 +87,7 @@ host_driver_t lufa_driver = {
     .send_nkro     = send_nkro,
     .send_mouse    = send_mouse,
     .send_extra    = send_extra,
+    .can_send      = can_send,
 #ifdef RAW_ENABLE
     .send_raw_hid = send_raw_hid,
 #endif
@@ -553,6 +555,36 @@ static void send_extra(report_extra_t *report) {
 #endif
 }
 
+/** \brief Whether a report can be sent without waiting for the host to poll its endpoint
+ */
+static bool can_send(uint8_t report_id) {
+    uint8_t endpoint;
+
+    // send_report() returns right away when not configured
+    if (USB_DeviceState != DEVICE_STATE_Configured) return true;
+
+    switch (report_id) {
+        case REPORT_ID_KEYBOARD:
+            endpoint = KEYBOARD_IN_EPNUM;
+            break;
+#ifdef NKRO_ENABLE
+        case REPORT_ID_NKRO:
+            endpoint = SHARED_IN_EPNUM;
+            break;
+#endif
+#ifdef MOUSE_ENABLE
+        case REPORT_ID_MOUSE:
+            endpoint = MOUSE_IN_EPNUM;
+            break;
+#endif
+        default:
+            return true;
+    }
+
+    Endpoint_SelectEndpoint(endpoint);
+    return Endpoint_IsReadWriteAllowed();
+}
+
 void send_joystick(report_joystick_t *report) {
 #ifdef JOYSTICK_ENABLE
     send_report(JOYSTICK_IN_EPNUM, report, sizeof(report_joystick_t));
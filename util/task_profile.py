@@ -0,0 +1,191 @@
+#!/usr/bin/env python3
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+"""Decodes the summaries emitted by TASK_PROFILE_ENABLE.
+
+Console mode reads the `tprof` lines printed by the keyboard, for example:
+
+    qmk console | util/task_profile.py console
+
+Raw HID mode reads the packets sent when TASK_PROFILE_RAW_HID is defined, and needs
+the `hid` package (hidapi):
+
+    util/task_profile.py hid --vid 0xFEED --pid 0x0000
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+RAW_HID_USAGE_PAGE = 0xFF60
+RAW_HID_USAGE = 0x61
+RAW_HID_HEADER = 0xFF
+HISTOGRAM_BUCKETS = 8
+
+# Must match task_profile_t in quantum/task_profile.h.
+TASK_NAMES = [
+    'matrix',
+    'quantum',
+    'audio',
+    'music',
+    'key_override',
+    'sequencer',
+    'tap_dance',
+    'combo',
+    'leader',
+    'wpm',
+    'dip_switch',
+    'auto_shift',
+    'caps_word',
+    'secure',
+    'layer_lock',
+    'split_watchdog',
+    'rgblight',
+    'led_matrix',
+    'rgb_matrix',
+    'backlight',
+    'encoder',
+    'pointing_device',
+    'oled',
+    'st7565',
+    'mousekey',
+    'ps2_mouse',
+    'midi',
+    'joystick',
+    'battery',
+    'bluetooth',
+    'haptic',
+    'led',
+    'os_detection',
+    'slider',
+    'send_string',
+    'host_report_queue',
+    'dynamic_macro',
+    'slider_midi',
+]
+
+
+class Window:
+    """One summary window: a header followed by one entry per task that ran."""
+    def __init__(self, window_ms, tick_hz, shift):
+        self.window_ms = window_ms
+        self.tick_hz = tick_hz
+        self.shift = shift
+        self.tasks = []
+
+    def add(self, name, count, total, maximum, histogram):
+        self.tasks.append((name, count, total, maximum, histogram))
+
+    def bucket_labels(self):
+        """Upper bound of each histogram bucket, in ticks."""
+        return [(4**i) << self.shift for i in range(HISTOGRAM_BUCKETS - 1)]
+
+    def format_ticks(self, ticks):
+        if self.tick_hz:
+            return f'{ticks * 1000000 / self.tick_hz:10.1f}us'
+        return f'{ticks:10d}t'
+
+    def render(self):
+        lines = []
+        unit = f'{self.tick_hz} Hz ticks' if self.tick_hz else 'raw ticks, pass --tick-hz to convert'
+        lines.append(f'window {self.window_ms} ms ({unit}), histogram bucket limits: {", ".join("<" + self.format_ticks(b).strip() for b in self.bucket_labels())}')
+        lines.append(f'{"task":<16} {"calls/s":>9} {"avg":>12} {"max":>12} {"load":>7}  histogram')
+        budget = self.window_ms * self.tick_hz / 1000 if self.tick_hz else 0
+        for name, count, total, maximum, histogram in sorted(self.tasks, key=lambda t: -t[2]):
+            rate = count * 1000 / self.window_ms if self.window_ms else 0
+            avg = total / count if count else 0
+            load = f'{total * 100 / budget:6.2f}%' if budget else '    n/a'
+            avg_str = f'{avg * 1000000 / self.tick_hz:10.1f}us' if self.tick_hz else f'{avg:10.1f}t'
+            lines.append(f'{name:<16} {rate:9.0f} {avg_str:>12} {self.format_ticks(maximum):>12} {load}  {" ".join(str(h) for h in histogram)}')
+        return '\n'.join(lines)
+
+
+def decode_packet(data, window, tick_hz=None):
+    """Decodes one 32 byte raw HID packet. Returns a finished window when a new header arrives."""
+    finished = None
+    task = data[1]
+    shift = data[3]
+    if task == RAW_HID_HEADER:
+        window_ms, hz = struct.unpack_from('<II', bytes(data), 4)
+        finished = window
+        window = Window(window_ms, tick_hz if tick_hz is not None else hz, shift)
+    elif window is not None:
+        count, total, maximum = struct.unpack_from('<III', bytes(data), 4)
+        histogram = struct.unpack_from(f'<{HISTOGRAM_BUCKETS}H', bytes(data), 16)
+        name = TASK_NAMES[task] if task < len(TASK_NAMES) else f'task{task}'
+        window.add(name, count, total, maximum, histogram)
+    return finished, window
+
+
+HEADER_RE = re.compile(r'tprof window=(\d+) tick_hz=(\d+) shift=(\d+)')
+TASK_RE = re.compile(r'tprof (\w+) n=(\d+) total=(\d+) max=(\d+) hist=([\d,]+)')
+
+
+def decode_line(line, window, tick_hz=None):
+    """Decodes one console line. Returns a finished window when a new header arrives."""
+    finished = None
+    match = HEADER_RE.search(line)
+    if match:
+        window_ms, hz, shift = (int(g) for g in match.groups())
+        finished = window
+        window = Window(window_ms, tick_hz if tick_hz is not None else hz, shift)
+        return finished, window
+    match = TASK_RE.search(line)
+    if match and window is not None:
+        name = match.group(1)
+        count, total, maximum = (int(g) for g in match.groups()[1:4])
+        histogram = [int(h) for h in match.group(5).split(',')]
+        window.add(name, count, total, maximum, histogram)
+    return finished, window
+
+
+def run_console(args):
+    window = None
+    for line in sys.stdin:
+        finished, window = decode_line(line, window, args.tick_hz)
+        if finished:
+            print(finished.render(), end='\n\n', flush=True)
+    if window:
+        print(window.render())
+
+
+def run_hid(args):
+    import hid
+
+    devices = [d for d in hid.enumerate(args.vid, args.pid) if d['usage_page'] == RAW_HID_USAGE_PAGE and d['usage'] == RAW_HID_USAGE]
+    if not devices:
+        sys.exit(f'No raw HID interface found for {args.vid:04X}:{args.pid:04X}')
+
+    device = hid.device()
+    device.open_path(devices[0]['path'])
+    window = None
+    try:
+        while True:
+            data = device.read(32)
+            if len(data) < 32 or data[0] != args.id:
+                continue
+            finished, window = decode_packet(data, window, args.tick_hz)
+            if finished:
+                print(finished.render(), end='\n\n', flush=True)
+    except KeyboardInterrupt:
+        pass
+    finally:
+        device.close()
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description='Decode TASK_PROFILE_ENABLE summaries.')
+    parser.add_argument('--tick-hz', type=int, default=None, help='override the tick frequency reported by the keyboard')
+    subparsers = parser.add_subparsers(dest='mode', required=True)
+    subparsers.add_parser('console', help='read tprof lines from stdin')
+    hid_parser = subparsers.add_parser('hid', help='read raw HID packets')
+    hid_parser.add_argument('--vid', type=lambda x: int(x, 0), required=True)
+    hid_parser.add_argument('--pid', type=lambda x: int(x, 0), required=True)
+    hid_parser.add_argument('--id', type=lambda x: int(x, 0), default=0xF7, help='TASK_PROFILE_RAW_HID_ID')
+    args = parser.parse_args()
+
+    if args.mode == 'console':
+        run_console(args)
+    else:
+        run_hid(args)